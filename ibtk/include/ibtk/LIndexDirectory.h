@@ -0,0 +1 @@
+../../src/lagrangian/LIndexDirectory.h
\ No newline at end of file
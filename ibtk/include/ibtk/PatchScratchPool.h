@@ -0,0 +1 @@
+../../src/utilities/PatchScratchPool.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../src/utilities/PatchTaskExecutor.h
\ No newline at end of file
@@ -144,6 +144,7 @@
 #include "ibtk/ParallelEdgeMap.h"
 #include "ibtk/ParallelMap.h"
 #include "ibtk/ParallelSet.h"
+#include "ibtk/PatchScratchPool.h"
 #include "ibtk/RefinePatchStrategySet.h"
 #include "ibtk/SideDataSynchronization.h"
 #include "ibtk/SideNoCornersFillPattern.h"
@@ -0,0 +1,52 @@
+# -------------------------------------------------------------
+# -------------------------------------------------------------
+AC_DEFUN([CONFIGURE_OPENMP],[
+echo
+echo "==================================="
+echo "Configuring optional OpenMP support"
+echo "==================================="
+AC_ARG_ENABLE([openmp],
+  AS_HELP_STRING(--enable-openmp,enable OpenMP threading of patch-based operations @<:@default=no@:>@),
+                 [case "$enableval" in
+                    yes)  OPENMP_ENABLED=yes ;;
+                    no)   OPENMP_ENABLED=no ;;
+                    *)    AC_MSG_ERROR(--enable-openmp=$enableval is invalid; choices are "yes" and "no") ;;
+                  esac],[OPENMP_ENABLED=no])
+
+OPENMP_CXXFLAGS=""
+if test "$OPENMP_ENABLED" = yes ; then
+  AC_MSG_CHECKING([for $CXX option to enable OpenMP])
+  openmp_flag_found=no
+  SAVE_CXXFLAGS="$CXXFLAGS"
+  for openmp_flag in "" -fopenmp -qopenmp -openmp -xopenmp -mp -qsmp=omp ; do
+    CXXFLAGS="$SAVE_CXXFLAGS $openmp_flag"
+    AC_LINK_IFELSE([AC_LANG_PROGRAM([[
+#if !defined(_OPENMP)
+#error OpenMP is not enabled
+#endif
+#include <omp.h>
+]], [[
+    return omp_get_max_threads() > 0 ? 0 : 1;
+]])],[openmp_flag_found=yes])
+    CXXFLAGS="$SAVE_CXXFLAGS"
+    if test "$openmp_flag_found" = yes ; then
+      OPENMP_CXXFLAGS="$openmp_flag"
+      break
+    fi
+  done
+  if test "$openmp_flag_found" = no ; then
+    AC_MSG_RESULT(unsupported)
+    AC_MSG_ERROR([--enable-openmp was specified, but $CXX does not support OpenMP])
+  fi
+  if test x"$OPENMP_CXXFLAGS" = x ; then
+    AC_MSG_RESULT(none needed)
+  else
+    AC_MSG_RESULT($OPENMP_CXXFLAGS)
+  fi
+  CXXFLAGS_APPEND($OPENMP_CXXFLAGS)
+  LDFLAGS_APPEND($OPENMP_CXXFLAGS)
+else
+  AC_MSG_NOTICE([OpenMP support is disabled; patch-based operations will be executed serially])
+fi
+AC_SUBST(OPENMP_CXXFLAGS)
+])
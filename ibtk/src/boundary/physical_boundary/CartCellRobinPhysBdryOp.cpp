@@ -45,7 +45,6 @@
 #include "RobinBcCoefStrategy.h"
 #include "Variable.h"
 #include "VariableDatabase.h"
-#include "ibtk/ExtendedRobinBcCoefStrategy.h"
 #include "ibtk/PhysicalBoundaryUtilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Array.h"
@@ -474,26 +473,20 @@ void CartCellRobinPhysBdryOp::fillGhostCellValuesCodim1(
                                                  bdry_box.getLocationIndex());
         const Box<NDIM> bc_coef_box =
             PhysicalBoundaryUtilities::makeSideBoundaryCodim1Box(trimmed_bdry_box);
-        Pointer<ArrayData<NDIM, double> > acoef_data =
-            new ArrayData<NDIM, double>(bc_coef_box, 1);
-        Pointer<ArrayData<NDIM, double> > bcoef_data =
-            new ArrayData<NDIM, double>(bc_coef_box, 1);
-        Pointer<ArrayData<NDIM, double> > gcoef_data =
-            new ArrayData<NDIM, double>(bc_coef_box, 1);
+        Pointer<ArrayData<NDIM, double> > acoef_data, bcoef_data, gcoef_data;
         for (int d = 0; d < patch_data_depth; ++d)
         {
-            RobinBcCoefStrategy<NDIM>* bc_coef = d_bc_coefs[d];
-            ExtendedRobinBcCoefStrategy* const extended_bc_coef =
-                dynamic_cast<ExtendedRobinBcCoefStrategy*>(bc_coef);
-            if (extended_bc_coef)
-            {
-                extended_bc_coef->setTargetPatchDataIndex(patch_data_idx);
-                extended_bc_coef->setHomogeneousBc(d_homogeneous_bc);
-            }
-            bc_coef->setBcCoefs(
-                acoef_data, bcoef_data, gcoef_data, var, patch, trimmed_bdry_box, fill_time);
-            if (d_homogeneous_bc && !extended_bc_coef) gcoef_data->fillAll(0.0);
-            if (extended_bc_coef) extended_bc_coef->clearTargetPatchDataIndex();
+            setBcCoefData(acoef_data,
+                          bcoef_data,
+                          gcoef_data,
+                          d_bc_coefs[d],
+                          patch_data_idx,
+                          0,
+                          var,
+                          patch,
+                          trimmed_bdry_box,
+                          bc_coef_box,
+                          fill_time);
             switch (location_index)
             {
             case 0: // lower x
@@ -49,7 +49,6 @@
 #include "Variable.h"
 #include "VariableDatabase.h"
 #include "boost/array.hpp"
-#include "ibtk/ExtendedRobinBcCoefStrategy.h"
 #include "ibtk/PhysicalBoundaryUtilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Array.h"
@@ -583,26 +582,20 @@ void CartSideRobinPhysBdryOp::fillGhostCellValuesCodim1Normal(
             bdry_box.getBox() * bc_fill_box, bdry_box.getBoundaryType(), location_index);
         const Box<NDIM> bc_coef_box =
             PhysicalBoundaryUtilities::makeSideBoundaryCodim1Box(trimmed_bdry_box);
-        Pointer<ArrayData<NDIM, double> > acoef_data =
-            new ArrayData<NDIM, double>(bc_coef_box, 1);
-        Pointer<ArrayData<NDIM, double> > bcoef_data =
-            new ArrayData<NDIM, double>(bc_coef_box, 1);
-        Pointer<ArrayData<NDIM, double> > gcoef_data =
-            new ArrayData<NDIM, double>(bc_coef_box, 1);
+        Pointer<ArrayData<NDIM, double> > acoef_data, bcoef_data, gcoef_data;
         for (int d = 0; d < patch_data_depth; ++d)
         {
-            RobinBcCoefStrategy<NDIM>* bc_coef = d_bc_coefs[NDIM * d + bdry_normal_axis];
-            ExtendedRobinBcCoefStrategy* const extended_bc_coef =
-                dynamic_cast<ExtendedRobinBcCoefStrategy*>(bc_coef);
-            if (extended_bc_coef)
-            {
-                extended_bc_coef->setTargetPatchDataIndex(patch_data_idx);
-                extended_bc_coef->setHomogeneousBc(d_homogeneous_bc);
-            }
-            bc_coef->setBcCoefs(
-                acoef_data, bcoef_data, gcoef_data, var, patch, trimmed_bdry_box, fill_time);
-            if (d_homogeneous_bc && !extended_bc_coef) gcoef_data->fillAll(0.0);
-            if (extended_bc_coef) extended_bc_coef->clearTargetPatchDataIndex();
+            setBcCoefData(acoef_data,
+                          bcoef_data,
+                          gcoef_data,
+                          d_bc_coefs[NDIM * d + bdry_normal_axis],
+                          patch_data_idx,
+                          bdry_normal_axis,
+                          var,
+                          patch,
+                          trimmed_bdry_box,
+                          bc_coef_box,
+                          fill_time);
             if (location_index == 0 || location_index == 1)
             {
                 SC_ROBIN_PHYS_BDRY_OP_1_X_FC(patch_data->getPointer(bdry_normal_axis, d),
@@ -754,12 +747,7 @@ void CartSideRobinPhysBdryOp::fillGhostCellValuesCodim1Transverse(
                 const Box<NDIM> bc_coef_box = compute_tangential_extension(
                     PhysicalBoundaryUtilities::makeSideBoundaryCodim1Box(trimmed_bdry_box),
                     axis);
-                Pointer<ArrayData<NDIM, double> > acoef_data =
-                    new ArrayData<NDIM, double>(bc_coef_box, 1);
-                Pointer<ArrayData<NDIM, double> > bcoef_data =
-                    new ArrayData<NDIM, double>(bc_coef_box, 1);
-                Pointer<ArrayData<NDIM, double> > gcoef_data =
-                    new ArrayData<NDIM, double>(bc_coef_box, 1);
+                Pointer<ArrayData<NDIM, double> > acoef_data, bcoef_data, gcoef_data;
 
                 // Temporarily reset the patch geometry object associated with
                 // the patch so that boundary conditions are set at the correct
@@ -783,23 +771,17 @@ void CartSideRobinPhysBdryOp::fillGhostCellValuesCodim1Transverse(
                 // Set the boundary condition coefficients.
                 for (int d = 0; d < patch_data_depth; ++d)
                 {
-                    RobinBcCoefStrategy<NDIM>* bc_coef = d_bc_coefs[NDIM * d + axis];
-                    ExtendedRobinBcCoefStrategy* const extended_bc_coef =
-                        dynamic_cast<ExtendedRobinBcCoefStrategy*>(bc_coef);
-                    if (extended_bc_coef)
-                    {
-                        extended_bc_coef->setTargetPatchDataIndex(patch_data_idx);
-                        extended_bc_coef->setHomogeneousBc(d_homogeneous_bc);
-                    }
-                    bc_coef->setBcCoefs(acoef_data,
-                                        bcoef_data,
-                                        gcoef_data,
-                                        var,
-                                        patch,
-                                        trimmed_bdry_box,
-                                        fill_time);
-                    if (d_homogeneous_bc && !extended_bc_coef) gcoef_data->fillAll(0.0);
-                    if (extended_bc_coef) extended_bc_coef->clearTargetPatchDataIndex();
+                    setBcCoefData(acoef_data,
+                                  bcoef_data,
+                                  gcoef_data,
+                                  d_bc_coefs[NDIM * d + axis],
+                                  patch_data_idx,
+                                  axis,
+                                  var,
+                                  patch,
+                                  trimmed_bdry_box,
+                                  bc_coef_box,
+                                  fill_time);
 
                     // Restore the original patch geometry object.
                     patch.setPatchGeometry(pgeom);
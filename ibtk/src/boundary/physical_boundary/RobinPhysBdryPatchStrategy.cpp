@@ -34,8 +34,17 @@
 
 #include <ostream>
 
+#include "ArrayData.h"
+#include "BoundaryBox.h"
+#include "Box.h"
+#include "Patch.h"
+#include "RobinBcCoefStrategy.h"
 #include "RobinPhysBdryPatchStrategy.h"
+#include "ibtk/ExtendedRobinBcCoefStrategy.h"
+#include "ibtk/muParserRobinBcCoefs.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/MathUtilities.h"
+#include "tbox/Pointer.h"
 #include "tbox/Utilities.h"
 
 namespace SAMRAI
@@ -43,13 +52,8 @@ namespace SAMRAI
 namespace hier
 {
 template <int DIM>
-class Patch;
+class Variable;
 } // namespace hier
-namespace solv
-{
-template <int DIM>
-class RobinBcCoefStrategy;
-} // namespace solv
 } // namespace SAMRAI
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -61,7 +65,8 @@ namespace IBTK
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 RobinPhysBdryPatchStrategy::RobinPhysBdryPatchStrategy()
-    : d_patch_data_indices(), d_bc_coefs(), d_homogeneous_bc(false)
+    : d_patch_data_indices(), d_bc_coefs(), d_homogeneous_bc(false), d_cache_bc_coefs(true),
+      d_bc_coef_cache()
 {
     // intentionally blank
     return;
@@ -120,6 +125,7 @@ void RobinPhysBdryPatchStrategy::setPhysicalBcCoefs(
     }
 #endif
     d_bc_coefs = bc_coefs;
+    clearBcCoefCache();
     return;
 } // setPhysicalBcCoefs
 
@@ -134,6 +140,19 @@ bool RobinPhysBdryPatchStrategy::getHomogeneousBc() const
     return d_homogeneous_bc;
 } // getHomogeneousBc
 
+void RobinPhysBdryPatchStrategy::setBcCoefCaching(const bool cache_bc_coefs)
+{
+    d_cache_bc_coefs = cache_bc_coefs;
+    if (!d_cache_bc_coefs) clearBcCoefCache();
+    return;
+} // setBcCoefCaching
+
+void RobinPhysBdryPatchStrategy::clearBcCoefCache()
+{
+    d_bc_coef_cache.clear();
+    return;
+} // clearBcCoefCache
+
 void RobinPhysBdryPatchStrategy::preprocessRefine(Patch<NDIM>& /*fine*/,
                                                   const Patch<NDIM>& /*coarse*/,
                                                   const Box<NDIM>& /*fine_box*/,
@@ -164,8 +183,118 @@ void RobinPhysBdryPatchStrategy::accumulateFromPhysicalBoundaryData(
 
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
+void RobinPhysBdryPatchStrategy::setBcCoefData(Pointer<ArrayData<NDIM, double> >& acoef_data,
+                                               Pointer<ArrayData<NDIM, double> >& bcoef_data,
+                                               Pointer<ArrayData<NDIM, double> >& gcoef_data,
+                                               RobinBcCoefStrategy<NDIM>* const bc_coef,
+                                               const int patch_data_idx,
+                                               const int cache_slot,
+                                               const Pointer<Variable<NDIM> >& var,
+                                               const Patch<NDIM>& patch,
+                                               const BoundaryBox<NDIM>& bdry_box,
+                                               const Box<NDIM>& bc_coef_box,
+                                               const double fill_time)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(bc_coef);
+#endif
+    // Only coefficients whose time dependence is known are cached.  Extended
+    // Robin coefficients may depend on the data being filled and are always
+    // re-evaluated.
+    const muParserRobinBcCoefs* const parser_bc_coef =
+        d_cache_bc_coefs ? dynamic_cast<const muParserRobinBcCoefs*>(bc_coef) : NULL;
+    if (!parser_bc_coef)
+    {
+        acoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+        bcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+        gcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+        ExtendedRobinBcCoefStrategy* const extended_bc_coef =
+            dynamic_cast<ExtendedRobinBcCoefStrategy*>(bc_coef);
+        if (extended_bc_coef)
+        {
+            extended_bc_coef->setTargetPatchDataIndex(patch_data_idx);
+            extended_bc_coef->setHomogeneousBc(d_homogeneous_bc);
+        }
+        bc_coef->setBcCoefs(
+            acoef_data, bcoef_data, gcoef_data, var, patch, bdry_box, fill_time);
+        if (d_homogeneous_bc && !extended_bc_coef) gcoef_data->fillAll(0.0);
+        if (extended_bc_coef) extended_bc_coef->clearTargetPatchDataIndex();
+        return;
+    }
+
+    // Look up the cached coefficients, (re-)evaluating them as needed.
+    BcCoefCacheKey key;
+    key.bc_coef = bc_coef;
+    key.level_number = patch.getPatchLevelNumber();
+    key.patch_number = patch.getPatchNumber();
+    key.location_index = bdry_box.getLocationIndex();
+    key.cache_slot = cache_slot;
+    std::map<BcCoefCacheKey, BcCoefCacheEntry>::iterator it = d_bc_coef_cache.find(key);
+    if (it == d_bc_coef_cache.end() || !(it->second.bc_coef_box == bc_coef_box))
+    {
+        BcCoefCacheEntry& entry = d_bc_coef_cache[key];
+        entry.bc_coef_box = bc_coef_box;
+        entry.acoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+        entry.bcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+        entry.gcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+        bc_coef->setBcCoefs(entry.acoef_data,
+                            entry.bcoef_data,
+                            entry.gcoef_data,
+                            var,
+                            patch,
+                            bdry_box,
+                            fill_time);
+        entry.ab_time = fill_time;
+        entry.g_time = fill_time;
+        it = d_bc_coef_cache.find(key);
+    }
+    BcCoefCacheEntry& entry = it->second;
+    if (parser_bc_coef->hasTimeDependentABCoefs() &&
+        !MathUtilities<double>::equalEps(entry.ab_time, fill_time))
+    {
+        bc_coef->setBcCoefs(entry.acoef_data,
+                            entry.bcoef_data,
+                            entry.gcoef_data,
+                            var,
+                            patch,
+                            bdry_box,
+                            fill_time);
+        entry.ab_time = fill_time;
+        entry.g_time = fill_time;
+    }
+    if (!d_homogeneous_bc && parser_bc_coef->hasTimeDependentGCoefs() &&
+        !MathUtilities<double>::equalEps(entry.g_time, fill_time))
+    {
+        Pointer<ArrayData<NDIM, double> > null_data;
+        bc_coef->setBcCoefs(
+            null_data, null_data, entry.gcoef_data, var, patch, bdry_box, fill_time);
+        entry.g_time = fill_time;
+    }
+    acoef_data = entry.acoef_data;
+    bcoef_data = entry.bcoef_data;
+    if (d_homogeneous_bc)
+    {
+        gcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+        gcoef_data->fillAll(0.0);
+    }
+    else
+    {
+        gcoef_data = entry.gcoef_data;
+    }
+    return;
+} // setBcCoefData
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+bool RobinPhysBdryPatchStrategy::BcCoefCacheKey::operator<(const BcCoefCacheKey& that) const
+{
+    if (bc_coef != that.bc_coef) return bc_coef < that.bc_coef;
+    if (level_number != that.level_number) return level_number < that.level_number;
+    if (patch_number != that.patch_number) return patch_number < that.patch_number;
+    if (location_index != that.location_index) return location_index < that.location_index;
+    return cache_slot < that.cache_slot;
+} // operator<
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
@@ -35,20 +35,27 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <map>
 #include <set>
 #include <vector>
 
+#include "ArrayData.h"
 #include "Box.h"
 #include "ComponentSelector.h"
 #include "IntVector.h"
 #include "RefinePatchStrategy.h"
+#include "tbox/Pointer.h"
 
 namespace SAMRAI
 {
 namespace hier
 {
 template <int DIM>
+class BoundaryBox;
+template <int DIM>
 class Patch;
+template <int DIM>
+class Variable;
 } // namespace hier
 namespace solv
 {
@@ -127,6 +134,26 @@ public:
      */
     bool getHomogeneousBc() const;
 
+    /*!
+     * \brief Set whether Robin coefficients provided by muParserRobinBcCoefs
+     * objects should be cached between boundary fills.
+     *
+     * When caching is enabled, the \f$ a \f$ and \f$ b \f$ coefficients are
+     * evaluated once per boundary box and are only re-evaluated when the patch
+     * boundary changes (e.g., following regridding) or when the coefficient
+     * functions depend on time.  The \f$ g \f$ coefficients are re-evaluated
+     * only when they depend on time and the fill time changes.  Coefficients
+     * provided by other RobinBcCoefStrategy objects are always re-evaluated.
+     *
+     * \note By default, caching is enabled.
+     */
+    void setBcCoefCaching(bool cache_bc_coefs);
+
+    /*!
+     * \brief Discard all cached Robin coefficients.
+     */
+    void clearBcCoefCache();
+
     /*!
      * \name Partial implementation of SAMRAI::xfer::RefinePatchStrategy
      * interface.
@@ -205,6 +232,33 @@ public:
         const SAMRAI::hier::IntVector<NDIM>& ghost_width_to_fill);
 
 protected:
+    /*!
+     * \brief Set the Robin coefficients for the boundary box \a bdry_box of
+     * patch \a patch.
+     *
+     * This routine handles the setup required by ExtendedRobinBcCoefStrategy
+     * objects and homogeneous boundary conditions.  Upon return, \a acoef_data,
+     * \a bcoef_data, and \a gcoef_data point to arrays defined over
+     * \a bc_coef_box.  These arrays may be owned by the coefficient cache and
+     * must not be modified by the caller.
+     *
+     * The integer \a cache_slot distinguishes different coefficient boxes
+     * associated with the same boundary box, e.g., the normal and tangential
+     * components of side-centered data.
+     */
+    void
+    setBcCoefData(SAMRAI::tbox::Pointer<SAMRAI::pdat::ArrayData<NDIM, double> >& acoef_data,
+                  SAMRAI::tbox::Pointer<SAMRAI::pdat::ArrayData<NDIM, double> >& bcoef_data,
+                  SAMRAI::tbox::Pointer<SAMRAI::pdat::ArrayData<NDIM, double> >& gcoef_data,
+                  SAMRAI::solv::RobinBcCoefStrategy<NDIM>* bc_coef,
+                  int patch_data_idx,
+                  int cache_slot,
+                  const SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> >& var,
+                  const SAMRAI::hier::Patch<NDIM>& patch,
+                  const SAMRAI::hier::BoundaryBox<NDIM>& bdry_box,
+                  const SAMRAI::hier::Box<NDIM>& bc_coef_box,
+                  double fill_time);
+
     /*
      * The patch data indices corresponding to the "scratch" patch data that
      * requires extrapolation of ghost cell values at physical boundaries.
@@ -222,6 +276,26 @@ protected:
     bool d_homogeneous_bc;
 
 private:
+    /*!
+     * \brief Key and value types for the Robin coefficient cache.
+     */
+    struct BcCoefCacheKey
+    {
+        bool operator<(const BcCoefCacheKey& that) const;
+
+        const SAMRAI::solv::RobinBcCoefStrategy<NDIM>* bc_coef;
+        int level_number, patch_number, location_index, cache_slot;
+    };
+
+    struct BcCoefCacheEntry
+    {
+        SAMRAI::hier::Box<NDIM> bc_coef_box;
+        SAMRAI::tbox::Pointer<SAMRAI::pdat::ArrayData<NDIM, double> > acoef_data, bcoef_data,
+            gcoef_data;
+        double ab_time, g_time;
+    };
+
+
     /*!
      * \brief Copy constructor.
      *
@@ -241,6 +315,13 @@ private:
      * \return A reference to this object.
      */
     RobinPhysBdryPatchStrategy& operator=(const RobinPhysBdryPatchStrategy& that);
+
+    /*
+     * Cached Robin coefficients for time-independent (or infrequently updated)
+     * boundary conditions.
+     */
+    bool d_cache_bc_coefs;
+    std::map<BcCoefCacheKey, BcCoefCacheEntry> d_bc_coef_cache;
 };
 } // namespace IBTK
 
@@ -66,6 +66,27 @@ namespace IBTK
 namespace
 {
 static const int EXTENSIONS_FILLABLE = 128;
+
+inline bool uses_time(const mu::Parser& parser)
+{
+    try
+    {
+        const mu::varmap_type& used_vars = parser.GetUsedVar();
+        return used_vars.count("t") > 0 || used_vars.count("T") > 0;
+    }
+    catch (mu::ParserError& e)
+    {
+        TBOX_ERROR("muParserRobinBcCoefs::muParserRobinBcCoefs():\n"
+                   << "  error: " << e.GetMsg() << "\n"
+                   << "  in:    " << e.GetExpr() << "\n");
+    }
+    catch (...)
+    {
+        TBOX_ERROR("muParserRobinBcCoefs::muParserRobinBcCoefs():\n"
+                   << "  unrecognized exception generated by muParser library.\n");
+    }
+    return true;
+} // uses_time
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -76,7 +97,7 @@ muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
     : d_grid_geom(grid_geom), d_constants(), d_acoef_function_strings(),
       d_bcoef_function_strings(), d_gcoef_function_strings(), d_acoef_parsers(2 * NDIM),
       d_bcoef_parsers(2 * NDIM), d_gcoef_parsers(2 * NDIM), d_parser_time(new double),
-      d_parser_posn(new Point)
+      d_parser_posn(new Point), d_ab_time_dependent(false), d_g_time_dependent(false)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(!object_name.empty());
@@ -301,6 +322,14 @@ muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
             (*cit)->DefineVar("x_" + postfix, &d_parser_posn->data()[d]);
         }
     }
+
+    // Determine which coefficients depend on time.
+    for (int d = 0; d < 2 * NDIM; ++d)
+    {
+        d_ab_time_dependent = d_ab_time_dependent || uses_time(d_acoef_parsers[d]) ||
+                              uses_time(d_bcoef_parsers[d]);
+        d_g_time_dependent = d_g_time_dependent || uses_time(d_gcoef_parsers[d]);
+    }
     return;
 } // muParserRobinBcCoefs
 
@@ -385,6 +414,16 @@ IntVector<NDIM> muParserRobinBcCoefs::numberOfExtensionsFillable() const
     return EXTENSIONS_FILLABLE;
 } // numberOfExtensionsFillable
 
+bool muParserRobinBcCoefs::hasTimeDependentABCoefs() const
+{
+    return d_ab_time_dependent;
+} // hasTimeDependentABCoefs
+
+bool muParserRobinBcCoefs::hasTimeDependentGCoefs() const
+{
+    return d_g_time_dependent;
+} // hasTimeDependentGCoefs
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
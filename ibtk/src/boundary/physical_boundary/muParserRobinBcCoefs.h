@@ -158,6 +158,18 @@ public:
 
     //\}
 
+    /*!
+     * \brief Indicate whether any of the \f$ a \f$ or \f$ b \f$ coefficient
+     * functions depend on the simulation time.
+     */
+    bool hasTimeDependentABCoefs() const;
+
+    /*!
+     * \brief Indicate whether any of the \f$ g \f$ coefficient functions
+     * depend on the simulation time.
+     */
+    bool hasTimeDependentGCoefs() const;
+
 private:
     /*!
      * \brief Default constructor.
@@ -217,6 +229,11 @@ private:
      */
     double* d_parser_time;
     Point* d_parser_posn;
+
+    /*!
+     * Whether the coefficient functions refer to the time variable.
+     */
+    bool d_ab_time_dependent, d_g_time_dependent;
 };
 } // namespace IBTK
 
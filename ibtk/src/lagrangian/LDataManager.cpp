@@ -38,6 +38,8 @@
 #include <numeric>
 #include <ostream>
 #include <set>
+#include <sstream>
+#include <string>
 #include <vector>
 
 #include "BasePatchHierarchy.h"
@@ -56,6 +58,7 @@
 #include "HierarchyCellDataOpsReal.h"
 #include "HierarchyDataOpsManager.h"
 #include "HierarchyDataOpsReal.h"
+#include "Index.h"
 #include "LDataManager.h"
 #include "MultiblockDataTranslator.h"
 #include "NodeData.h"
@@ -92,6 +95,7 @@
 #include "ibtk/compiler_hints.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "mpi.h"
 #include "petscis.h"
 #include "petscsys.h"
 #include "tbox/Array.h"
@@ -106,15 +110,6 @@
 #include "tbox/Transaction.h"
 #include "tbox/Utilities.h"
 
-namespace SAMRAI
-{
-namespace hier
-{
-template <int DIM>
-class Index;
-} // namespace hier
-} // namespace SAMRAI
-
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 namespace IBTK
@@ -140,6 +135,9 @@ static Timer* t_begin_nonlocal_data_fill;
 static Timer* t_end_nonlocal_data_fill;
 static Timer* t_compute_node_distribution;
 static Timer* t_compute_node_offsets;
+static Timer* t_begin_lagrangian_checkpoint;
+static Timer* t_end_lagrangian_checkpoint;
+static Timer* t_read_lagrangian_checkpoint;
 
 // Assume max(U)dt/dx <= 2.
 static const int CFL_WIDTH = 2;
@@ -151,6 +149,33 @@ inline int round(double x)
 {
     return floor(x + 0.5);
 } // round
+
+// Blocks of cells used for occupancy-based tagging are identified by their
+// index in the index space coarsened by the block size.  Block indices are
+// ordered lexicographically.
+typedef boost::array<int, NDIM> BlockIndex;
+
+// Add the block that contains the specified cell to a list of occupied blocks.
+// Consecutive duplicates are skipped.
+inline void add_occupied_block(std::vector<BlockIndex>& blocks,
+                               const Index<NDIM>& i,
+                               const IntVector<NDIM>& block_size)
+{
+    const Index<NDIM> b = Index<NDIM>::coarsen(i, block_size);
+    BlockIndex block;
+    for (unsigned int d = 0; d < NDIM; ++d) block[d] = b(d);
+    if (blocks.empty() || blocks.back() != block) blocks.push_back(block);
+    return;
+} // add_occupied_block
+
+std::string checkpoint_file_name(const std::string& dirname,
+                                 const int level_number,
+                                 const std::string& data_name)
+{
+    std::ostringstream stream;
+    stream << dirname << "/level_" << level_number << "." << data_name << ".dat";
+    return stream.str();
+} // checkpoint_file_name
 }
 
 const std::string LDataManager::POSN_DATA_NAME = "X";
@@ -159,7 +184,6 @@ const std::string LDataManager::VEL_DATA_NAME = "U";
 std::map<std::string, LDataManager*> LDataManager::s_data_manager_instances;
 bool LDataManager::s_registered_callback = false;
 unsigned char LDataManager::s_shutdown_priority = 200;
-std::vector<int> LDataManager::s_ao_dummy(1, -1);
 
 LDataManager* LDataManager::getManager(const std::string& name,
                                        const std::string& default_interp_kernel_fcn,
@@ -229,25 +253,12 @@ void LDataManager::setPatchLevels(const int coarsest_ln, const int finest_ln)
     TBOX_ASSERT((coarsest_ln >= 0) && (finest_ln >= coarsest_ln) &&
                 (finest_ln <= d_hierarchy->getFinestLevelNumber()));
 #endif
-    // Destroy any unneeded AO objects.
-    int ierr;
+    // Destroy any unneeded index directories.
     for (int level_number = std::max(d_coarsest_ln, 0);
          (level_number <= d_finest_ln) && (level_number < coarsest_ln);
          ++level_number)
     {
-        if (d_ao[level_number])
-        {
-            ierr = AODestroy(&d_ao[level_number]);
-            IBTK_CHKERRQ(ierr);
-        }
-    }
-    for (int level_number = finest_ln + 1; level_number <= d_finest_ln; ++level_number)
-    {
-        if (d_ao[level_number])
-        {
-            ierr = AODestroy(&d_ao[level_number]);
-            IBTK_CHKERRQ(ierr);
-        }
+        d_idx_directory[level_number].setNull();
     }
 
     // Reset the level numbers.
@@ -268,7 +279,7 @@ void LDataManager::setPatchLevels(const int coarsest_ln, const int finest_ln)
     d_lag_mesh.resize(d_finest_ln + 1);
     d_lag_mesh_data.resize(d_finest_ln + 1);
     d_needs_synch.resize(d_finest_ln + 1, false);
-    d_ao.resize(d_finest_ln + 1);
+    d_idx_directory.resize(d_finest_ln + 1);
     d_num_nodes.resize(d_finest_ln + 1);
     d_node_offset.resize(d_finest_ln + 1);
     d_local_lag_indices.resize(d_finest_ln + 1);
@@ -906,6 +917,17 @@ void LDataManager::registerLoadBalancer(Pointer<LoadBalancer<NDIM> > load_balanc
     return;
 } // return
 
+void LDataManager::setUseOccupancyTagging(const bool use_occupancy_tagging,
+                                          const int block_size)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(block_size >= 1);
+#endif
+    d_use_occupancy_tagging = use_occupancy_tagging;
+    d_occupancy_block_size = block_size;
+    return;
+} // setUseOccupancyTagging
+
 Pointer<LData> LDataManager::createLData(const std::string& quantity_name,
                                          const int level_number,
                                          const unsigned int depth,
@@ -1325,11 +1347,7 @@ void LDataManager::mapLagrangianToPETSc(std::vector<int>& inds, const int level_
     TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
 #endif
 
-    const int ierr = AOApplicationToPetsc(
-        d_ao[level_number],
-        (!inds.empty() ? static_cast<int>(inds.size()) : static_cast<int>(s_ao_dummy.size())),
-        (!inds.empty() ? &inds[0] : &s_ao_dummy[0]));
-    IBTK_CHKERRQ(ierr);
+    d_idx_directory[level_number]->mapLagrangianToPETSc(inds);
 
     IBTK_TIMER_STOP(t_map_lagrangian_to_petsc);
     return;
@@ -1343,11 +1361,7 @@ void LDataManager::mapPETScToLagrangian(std::vector<int>& inds, const int level_
     TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
 #endif
 
-    const int ierr = AOPetscToApplication(
-        d_ao[level_number],
-        (!inds.empty() ? static_cast<int>(inds.size()) : static_cast<int>(s_ao_dummy.size())),
-        (!inds.empty() ? &inds[0] : &s_ao_dummy[0]));
-    IBTK_CHKERRQ(ierr);
+    d_idx_directory[level_number]->mapPETScToLagrangian(inds);
 
     IBTK_TIMER_STOP(t_map_petsc_to_lagrangian);
     return;
@@ -1401,6 +1415,201 @@ void LDataManager::scatterToZero(Vec& parallel_vec, Vec& sequential_vec) const
     return;
 } // scatterToZero
 
+void LDataManager::beginLagrangianCheckpoint(const std::string& dirname,
+                                             const int coarsest_ln_in,
+                                             const int finest_ln_in)
+{
+    IBTK_TIMER_START(t_begin_lagrangian_checkpoint);
+
+    const int coarsest_ln = (coarsest_ln_in == -1) ? d_coarsest_ln : coarsest_ln_in;
+    const int finest_ln = (finest_ln_in == -1) ? d_finest_ln : finest_ln_in;
+
+#if !defined(NDEBUG)
+    TBOX_ASSERT(!dirname.empty());
+    TBOX_ASSERT(coarsest_ln >= d_coarsest_ln && coarsest_ln <= d_finest_ln);
+    TBOX_ASSERT(finest_ln >= d_coarsest_ln && finest_ln <= d_finest_ln);
+#endif
+
+    // Complete any previously posted writes before starting new ones.
+    if (!d_pending_checkpoint_writes.empty()) endLagrangianCheckpoint();
+
+    Utilities::recursiveMkdir(dirname);
+    SAMRAI_MPI::barrier();
+
+    int ierr;
+    for (int level_number = coarsest_ln; level_number <= finest_ln; ++level_number)
+    {
+        if (!d_level_contains_lag_data[level_number]) continue;
+        for (std::map<std::string, Pointer<LData> >::iterator it =
+                 d_lag_mesh_data[level_number].begin();
+             it != d_lag_mesh_data[level_number].end();
+             ++it)
+        {
+            Pointer<LData> data = it->second;
+            const int depth = data->getDepth();
+            Vec petsc_vec = data->getVec();
+
+            // Copy the data into a buffer that uses the global Lagrangian
+            // ordering.
+            CheckpointWrite write;
+            int local_sz;
+            ierr = VecGetLocalSize(petsc_vec, &local_sz);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecCreateMPI(PETSC_COMM_WORLD, local_sz, PETSC_DETERMINE, &write.lag_vec);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecSetBlockSize(write.lag_vec, depth);
+            IBTK_CHKERRQ(ierr);
+            scatterPETScToLagrangian(petsc_vec, write.lag_vec, level_number);
+            int ilo, ihi, global_sz;
+            ierr = VecGetOwnershipRange(write.lag_vec, &ilo, &ihi);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecGetSize(write.lag_vec, &global_sz);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecGetArray(write.lag_vec, &write.lag_vec_array);
+            IBTK_CHKERRQ(ierr);
+
+            // Post a split collective write of the locally owned part of the
+            // buffer.  The write is completed in endLagrangianCheckpoint().
+            const std::string file_name =
+                checkpoint_file_name(dirname, level_number, it->first);
+            if (MPI_File_open(PETSC_COMM_WORLD,
+                              const_cast<char*>(file_name.c_str()),
+                              MPI_MODE_WRONLY | MPI_MODE_CREATE,
+                              MPI_INFO_NULL,
+                              &write.file) != MPI_SUCCESS)
+            {
+                TBOX_ERROR("LDataManager::beginLagrangianCheckpoint():\n"
+                           << "  unable to open file " << file_name << " for writing.\n");
+            }
+            MPI_File_set_size(write.file, static_cast<MPI_Offset>(global_sz) * sizeof(double));
+            MPI_File_write_at_all_begin(write.file,
+                                        static_cast<MPI_Offset>(ilo) * sizeof(double),
+                                        write.lag_vec_array,
+                                        ihi - ilo,
+                                        MPI_DOUBLE);
+            d_pending_checkpoint_writes.push_back(write);
+        }
+    }
+
+    IBTK_TIMER_STOP(t_begin_lagrangian_checkpoint);
+    return;
+} // beginLagrangianCheckpoint
+
+void LDataManager::endLagrangianCheckpoint()
+{
+    IBTK_TIMER_START(t_end_lagrangian_checkpoint);
+
+    int ierr;
+    for (std::vector<CheckpointWrite>::iterator it = d_pending_checkpoint_writes.begin();
+         it != d_pending_checkpoint_writes.end();
+         ++it)
+    {
+        MPI_Status status;
+        MPI_File_write_at_all_end(it->file, it->lag_vec_array, &status);
+        MPI_File_close(&it->file);
+        ierr = VecRestoreArray(it->lag_vec, &it->lag_vec_array);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecDestroy(&it->lag_vec);
+        IBTK_CHKERRQ(ierr);
+    }
+    d_pending_checkpoint_writes.clear();
+
+    IBTK_TIMER_STOP(t_end_lagrangian_checkpoint);
+    return;
+} // endLagrangianCheckpoint
+
+void LDataManager::readLagrangianCheckpoint(const std::string& dirname,
+                                            const int coarsest_ln_in,
+                                            const int finest_ln_in)
+{
+    IBTK_TIMER_START(t_read_lagrangian_checkpoint);
+
+    const int coarsest_ln = (coarsest_ln_in == -1) ? d_coarsest_ln : coarsest_ln_in;
+    const int finest_ln = (finest_ln_in == -1) ? d_finest_ln : finest_ln_in;
+
+#if !defined(NDEBUG)
+    TBOX_ASSERT(!dirname.empty());
+    TBOX_ASSERT(coarsest_ln >= d_coarsest_ln && coarsest_ln <= d_finest_ln);
+    TBOX_ASSERT(finest_ln >= d_coarsest_ln && finest_ln <= d_finest_ln);
+#endif
+
+    int ierr;
+    for (int level_number = coarsest_ln; level_number <= finest_ln; ++level_number)
+    {
+        if (!d_level_contains_lag_data[level_number]) continue;
+        for (std::map<std::string, Pointer<LData> >::iterator it =
+                 d_lag_mesh_data[level_number].begin();
+             it != d_lag_mesh_data[level_number].end();
+             ++it)
+        {
+            Pointer<LData> data = it->second;
+            const int depth = data->getDepth();
+            Vec petsc_vec = data->getVec();
+
+            // Read the locally owned part of the data in the global Lagrangian
+            // ordering.
+            int local_sz;
+            ierr = VecGetLocalSize(petsc_vec, &local_sz);
+            IBTK_CHKERRQ(ierr);
+            Vec lag_vec;
+            ierr = VecCreateMPI(PETSC_COMM_WORLD, local_sz, PETSC_DETERMINE, &lag_vec);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecSetBlockSize(lag_vec, depth);
+            IBTK_CHKERRQ(ierr);
+            int ilo, ihi, global_sz;
+            ierr = VecGetOwnershipRange(lag_vec, &ilo, &ihi);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecGetSize(lag_vec, &global_sz);
+            IBTK_CHKERRQ(ierr);
+
+            const std::string file_name =
+                checkpoint_file_name(dirname, level_number, it->first);
+            MPI_File file;
+            if (MPI_File_open(PETSC_COMM_WORLD,
+                              const_cast<char*>(file_name.c_str()),
+                              MPI_MODE_RDONLY,
+                              MPI_INFO_NULL,
+                              &file) != MPI_SUCCESS)
+            {
+                TBOX_ERROR("LDataManager::readLagrangianCheckpoint():\n"
+                           << "  unable to open file " << file_name << " for reading.\n");
+            }
+            MPI_Offset file_sz;
+            MPI_File_get_size(file, &file_sz);
+            if (file_sz != static_cast<MPI_Offset>(global_sz) * sizeof(double))
+            {
+                TBOX_ERROR("LDataManager::readLagrangianCheckpoint():\n"
+                           << "  file " << file_name << " does not contain " << global_sz
+                           << " values.\n");
+            }
+            double* lag_vec_array;
+            ierr = VecGetArray(lag_vec, &lag_vec_array);
+            IBTK_CHKERRQ(ierr);
+            MPI_Status status;
+            MPI_File_read_at_all(file,
+                                 static_cast<MPI_Offset>(ilo) * sizeof(double),
+                                 lag_vec_array,
+                                 ihi - ilo,
+                                 MPI_DOUBLE,
+                                 &status);
+            MPI_File_close(&file);
+            ierr = VecRestoreArray(lag_vec, &lag_vec_array);
+            IBTK_CHKERRQ(ierr);
+
+            // Scatter the data back into the global PETSc ordering and update
+            // the ghost values.
+            scatterLagrangianToPETSc(lag_vec, petsc_vec, level_number);
+            ierr = VecDestroy(&lag_vec);
+            IBTK_CHKERRQ(ierr);
+            data->beginGhostUpdate();
+            data->endGhostUpdate();
+        }
+    }
+
+    IBTK_TIMER_STOP(t_read_lagrangian_checkpoint);
+    return;
+} // readLagrangianCheckpoint
+
 void LDataManager::beginDataRedistribution(const int coarsest_ln_in, const int finest_ln_in)
 {
     IBTK_TIMER_START(t_begin_data_redistribution);
@@ -1774,8 +1983,6 @@ void LDataManager::endDataRedistribution(const int coarsest_ln_in, const int fin
     // old configuration to its new configuration.
     int ierr;
 
-    std::vector<AO> new_ao(finest_ln + 1);
-
     std::vector<std::vector<Vec> > src_vec(finest_ln + 1);
     std::vector<std::vector<Vec> > dst_vec(finest_ln + 1);
     std::vector<std::vector<VecScatter> > scatter(finest_ln + 1);
@@ -1809,8 +2016,9 @@ void LDataManager::endDataRedistribution(const int coarsest_ln_in, const int fin
     // In the following loop over patch levels, we first compute the new
     // distribution data (e.g., all of these indices).
     //
-    // Next, we use the old and new PETSc AO (application ordering) objects to
-    // define a mapping from the old distribution to the new distribution.
+    // Next, we use the PETSc indices of the local nodes in the old and new
+    // distributions to define a mapping from the old distribution to the new
+    // distribution.
     //
     // Finally, we create the new PETSc Vec (vector) objects that are used to
     // store the Lagrangian data in the new distribution.
@@ -1828,7 +2036,9 @@ void LDataManager::endDataRedistribution(const int coarsest_ln_in, const int fin
         //
         // NOTE: This process updates the local PETSc indices of the LNodeSet
         // objects contained in the current patch.
-        computeNodeDistribution(new_ao[level_number],
+        std::vector<int> src_inds;
+        computeNodeDistribution(*d_idx_directory[level_number],
+                                src_inds,
                                 d_local_lag_indices[level_number],
                                 d_nonlocal_lag_indices[level_number],
                                 d_local_petsc_indices[level_number],
@@ -1839,27 +2049,9 @@ void LDataManager::endDataRedistribution(const int coarsest_ln_in, const int fin
         num_local_nodes[level_number] = d_local_lag_indices[level_number].size();
         num_nonlocal_nodes[level_number] = d_nonlocal_lag_indices[level_number].size();
 
-        // Setup src indices.
-        std::vector<int> src_inds(num_local_nodes[level_number]);
-        for (int k = 0; k < num_local_nodes[level_number]; ++k)
-        {
-            src_inds[k] = d_node_offset[level_number] + k;
-        }
-
-        // Convert dst indices from the old ordering to the new ordering.
-        std::vector<int> dst_inds = d_local_petsc_indices[level_number];
-        ierr = AOPetscToApplication(
-            d_ao[level_number], // the old AO
-            (num_local_nodes[level_number] > 0 ? num_local_nodes[level_number] :
-                                                 static_cast<int>(s_ao_dummy.size())),
-            (num_local_nodes[level_number] > 0 ? &dst_inds[0] : &s_ao_dummy[0]));
-        IBTK_CHKERRQ(ierr);
-        ierr = AOApplicationToPetsc(
-            new_ao[level_number], // the new AO
-            (num_local_nodes[level_number] > 0 ? num_local_nodes[level_number] :
-                                                 static_cast<int>(s_ao_dummy.size())),
-            (num_local_nodes[level_number] > 0 ? &dst_inds[0] : &s_ao_dummy[0]));
-        IBTK_CHKERRQ(ierr);
+        // The src indices are the old PETSc indices of the local nodes, and
+        // the dst indices are their new PETSc indices.
+        const std::vector<int>& dst_inds = d_local_petsc_indices[level_number];
 
         // Setup VecScatter objects for each LData object and start scattering
         // data.
@@ -2024,18 +2216,11 @@ void LDataManager::endDataRedistribution(const int coarsest_ln_in, const int fin
     endNonlocalDataFill(coarsest_ln, finest_ln);
 
     // Indicate that the levels have been synchronized and destroy unneeded
-    // ordering and indexing objects.
+    // indexing objects.
     for (int level_number = coarsest_ln; level_number <= finest_ln; ++level_number)
     {
         d_needs_synch[level_number] = false;
 
-        if (d_ao[level_number])
-        {
-            ierr = AODestroy(&d_ao[level_number]);
-            IBTK_CHKERRQ(ierr);
-        }
-        d_ao[level_number] = new_ao[level_number];
-
         for (std::map<int, IS>::iterator it = src_IS[level_number].begin();
              it != src_IS[level_number].end();
              ++it)
@@ -2054,10 +2239,11 @@ void LDataManager::endDataRedistribution(const int coarsest_ln_in, const int fin
     }
 
     // If a Silo data writer is registered with the manager, give it access to
-    // the new application orderings.
+    // the new index mappings.
     if (d_silo_writer)
     {
-        d_silo_writer->registerLagrangianAO(d_ao, coarsest_ln, finest_ln);
+        d_silo_writer->registerLagrangianIndexDirectory(
+            d_idx_directory, coarsest_ln, finest_ln);
     }
 
     IBTK_TIMER_STOP(t_end_data_redistribution);
@@ -2233,7 +2419,7 @@ void LDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> >
         d_lag_mesh.resize(level_number + 1);
         d_lag_mesh_data.resize(level_number + 1);
         d_needs_synch.resize(level_number + 1, false);
-        d_ao.resize(level_number + 1);
+        d_idx_directory.resize(level_number + 1);
         d_num_nodes.resize(level_number + 1);
         d_node_offset.resize(level_number + 1);
         d_local_lag_indices.resize(level_number + 1);
@@ -2384,30 +2570,22 @@ void LDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> >
                       std::vector<LNode*>(local_nodes.begin(), local_nodes.end()),
                       std::vector<LNode*>(ghost_nodes.begin(), ghost_nodes.end()));
 
-        // 5. The AO (application order) is determined by the initial values of
-        //    the local Lagrangian indices.
-        if (d_ao[level_number])
-        {
-            ierr = AODestroy(&d_ao[level_number]);
-            IBTK_CHKERRQ(ierr);
-        }
-
-        ierr = AOCreateMapping(
-            PETSC_COMM_WORLD,
-            num_local_nodes,
-            num_local_nodes > 0 ? &d_local_lag_indices[level_number][0] : NULL,
-            num_local_nodes > 0 ? &d_local_petsc_indices[level_number][0] : NULL,
-            &d_ao[level_number]);
-        IBTK_CHKERRQ(ierr);
+        // 5. The index directory is determined by the initial values of the
+        //    local Lagrangian indices.
+        d_idx_directory[level_number] = new LIndexDirectory();
+        d_idx_directory[level_number]->resetIndices(d_local_lag_indices[level_number],
+                                                    d_num_nodes[level_number],
+                                                    d_node_offset[level_number]);
     }
 
     // If a Silo data writer is registered with the manager, give it access to
-    // the new application ordering.
+    // the new index mapping.
     if (d_silo_writer && d_level_contains_lag_data[level_number])
     {
         d_silo_writer->registerCoordsData(d_lag_mesh_data[level_number][POSN_DATA_NAME],
                                           level_number);
-        d_silo_writer->registerLagrangianAO(d_ao[level_number], level_number);
+        d_silo_writer->registerLagrangianIndexDirectory(d_idx_directory[level_number],
+                                                        level_number);
     }
 
     IBTK_TIMER_STOP(t_initialize_level_data);
@@ -2500,46 +2678,58 @@ void LDataManager::applyGradientDetector(const Pointer<BasePatchHierarchy<NDIM>
         // Lagrangian structure.
         d_lag_init->tagCellsForInitialRefinement(
             hierarchy, level_number, error_data_time, tag_index);
+
+        // Extend the tagged regions to whole blocks of cells.
+        if (d_use_occupancy_tagging) tagOccupiedBlocks(level_number, tag_index, initial_time);
     }
     else if (hierarchy->finerLevelExists(level_number))
     {
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
         Pointer<PatchLevel<NDIM> > finer_level = hierarchy->getPatchLevel(level_number + 1);
 
-        // Zero out the node count data on the current level.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        if (d_use_occupancy_tagging)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            Pointer<CellData<NDIM, double> > node_count_data =
-                patch->getPatchData(d_node_count_idx);
-            node_count_data->fillAll(0.0);
+            // Tag cells for refinement in all blocks of cells that contain
+            // nodes on the next finer level of the Cartesian grid.
+            tagOccupiedBlocks(level_number, tag_index, initial_time);
         }
+        else
+        {
+            // Zero out the node count data on the current level.
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<CellData<NDIM, double> > node_count_data =
+                    patch->getPatchData(d_node_count_idx);
+                node_count_data->fillAll(0.0);
+            }
 
-        // Compute the node count data on the next finer level of the patch
-        // hierarchy.
-        updateNodeCountData(level_number + 1, level_number + 1);
+            // Compute the node count data on the next finer level of the patch
+            // hierarchy.
+            updateNodeCountData(level_number + 1, level_number + 1);
 
-        // Coarsen the node count data from the next finer level of the patch
-        // hierarchy.
-        d_node_count_coarsen_scheds[level_number + 1]->coarsenData();
+            // Coarsen the node count data from the next finer level of the patch
+            // hierarchy.
+            d_node_count_coarsen_scheds[level_number + 1]->coarsenData();
 
-        // Tag cells for refinement wherever there exist nodes on the next finer
-        // level of the Cartesian grid.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            const Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            const Box<NDIM>& patch_box = patch->getBox();
+            // Tag cells for refinement wherever there exist nodes on the next finer
+            // level of the Cartesian grid.
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                const Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
 
-            Pointer<CellData<NDIM, int> > tag_data = patch->getPatchData(tag_index);
-            const Pointer<CellData<NDIM, double> > node_count_data =
-                patch->getPatchData(d_node_count_idx);
+                Pointer<CellData<NDIM, int> > tag_data = patch->getPatchData(tag_index);
+                const Pointer<CellData<NDIM, double> > node_count_data =
+                    patch->getPatchData(d_node_count_idx);
 
-            for (CellIterator<NDIM> ic(patch_box); ic; ic++)
-            {
-                const CellIndex<NDIM>& i = ic();
-                if (!MathUtilities<double>::equalEps((*node_count_data)(i), 0.0))
+                for (CellIterator<NDIM> ic(patch_box); ic; ic++)
                 {
-                    (*tag_data)(i) = 1;
+                    const CellIndex<NDIM>& i = ic();
+                    if (!MathUtilities<double>::equalEps((*node_count_data)(i), 0.0))
+                    {
+                        (*tag_data)(i) = 1;
+                    }
                 }
             }
         }
@@ -2593,7 +2783,7 @@ void LDataManager::applyGradientDetector(const Pointer<BasePatchHierarchy<NDIM>
 
         // Re-compute the node count data on the present level of the patch
         // hierarchy (since it was invalidated above).
-        updateNodeCountData(level_number, level_number);
+        if (!d_use_occupancy_tagging) updateNodeCountData(level_number, level_number);
     }
 
     IBTK_TIMER_STOP(t_apply_gradient_detector);
@@ -2732,14 +2922,15 @@ LDataManager::LDataManager(const std::string& object_name,
       d_lag_node_index_current_idx(-1), d_lag_node_index_scratch_idx(-1), d_beta_work(1.0),
       d_workload_var(NULL), d_workload_idx(-1), d_output_workload(false),
       d_node_count_var(NULL), d_node_count_idx(-1), d_output_node_count(false),
+      d_use_occupancy_tagging(false), d_occupancy_block_size(4),
       d_default_interp_kernel_fcn(default_interp_kernel_fcn),
       d_default_spread_kernel_fcn(default_spread_kernel_fcn), d_ghost_width(ghost_width),
       d_lag_node_index_bdry_fill_alg(NULL), d_lag_node_index_bdry_fill_scheds(),
       d_node_count_coarsen_alg(NULL), d_node_count_coarsen_scheds(), d_current_context(NULL),
       d_scratch_context(NULL), d_current_data(), d_scratch_data(), d_lag_mesh(),
-      d_lag_mesh_data(), d_needs_synch(true), d_ao(), d_num_nodes(), d_node_offset(),
-      d_local_lag_indices(), d_nonlocal_lag_indices(), d_local_petsc_indices(),
-      d_nonlocal_petsc_indices()
+      d_lag_mesh_data(), d_needs_synch(true), d_idx_directory(), d_num_nodes(),
+      d_node_offset(), d_local_lag_indices(), d_nonlocal_lag_indices(),
+      d_local_petsc_indices(), d_nonlocal_petsc_indices(), d_pending_checkpoint_writes()
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(!object_name.empty());
@@ -2838,22 +3029,20 @@ LDataManager::LDataManager(const std::string& object_name,
         t_compute_node_distribution = TimerManager::getManager()->getTimer(
             "IBTK::LDataManager::computeNodeDistribution()");
         t_compute_node_offsets =
-            TimerManager::getManager()->getTimer("IBTK::LDataManager::computeNodeOffsets()"););
+            TimerManager::getManager()->getTimer("IBTK::LDataManager::computeNodeOffsets()");
+        t_begin_lagrangian_checkpoint = TimerManager::getManager()->getTimer(
+            "IBTK::LDataManager::beginLagrangianCheckpoint()");
+        t_end_lagrangian_checkpoint = TimerManager::getManager()->getTimer(
+            "IBTK::LDataManager::endLagrangianCheckpoint()");
+        t_read_lagrangian_checkpoint = TimerManager::getManager()->getTimer(
+            "IBTK::LDataManager::readLagrangianCheckpoint()"););
     return;
 } // LDataManager
 
 LDataManager::~LDataManager()
 {
-    // Destroy any remaining AO objects.
-    int ierr;
-    for (int level_number = d_coarsest_ln; level_number <= d_finest_ln; ++level_number)
-    {
-        if (d_ao[level_number])
-        {
-            ierr = AODestroy(&d_ao[level_number]);
-            IBTK_CHKERRQ(ierr);
-        }
-    }
+    // Complete any outstanding checkpoint writes.
+    if (!d_pending_checkpoint_writes.empty()) endLagrangianCheckpoint();
     return;
 } // ~LDataManager
 
@@ -2987,7 +3176,137 @@ void LDataManager::endNonlocalDataFill(const int coarsest_ln_in, const int fines
     return;
 } // endNonlocalDataFill
 
-void LDataManager::computeNodeDistribution(AO& ao,
+void LDataManager::tagOccupiedBlocks(const int level_number,
+                                     const int tag_index,
+                                     const bool initial_time)
+{
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
+    const IntVector<NDIM>& ratio = level->getRatio();
+    const IntVector<NDIM> block_size(d_occupancy_block_size);
+
+    // Collect the blocks that contain tagged cells (at the initial time) or
+    // nodes on the next finer level (at later times).
+    std::vector<BlockIndex> local_blocks;
+    if (initial_time)
+    {
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            const Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            const Pointer<CellData<NDIM, int> > tag_data = patch->getPatchData(tag_index);
+            for (CellIterator<NDIM> ic(patch_box); ic; ic++)
+            {
+                const CellIndex<NDIM>& i = ic();
+                if ((*tag_data)(i) == 0) continue;
+                add_occupied_block(local_blocks, i, block_size);
+            }
+        }
+    }
+    else if (level_number + 1 <= d_finest_ln && d_level_contains_lag_data[level_number + 1])
+    {
+        // Nodes that have moved through a periodic boundary are mapped back
+        // into the physical domain before their cell indices are computed.
+        const double* const domain_x_lower = d_grid_geom->getXLower();
+        const double* const domain_x_upper = d_grid_geom->getXUpper();
+        const double* const domain_dx = d_grid_geom->getDx();
+        const IntVector<NDIM>& periodic_shift = d_grid_geom->getPeriodicShift();
+        const Box<NDIM>& domain_box = level->getPhysicalDomain()[0];
+        const Index<NDIM>& domain_lower = domain_box.lower();
+        double level_dx[NDIM];
+        for (unsigned int d = 0; d < NDIM; ++d) level_dx[d] = domain_dx[d] / ratio(d);
+        Pointer<LData> X_data = d_lag_mesh_data[level_number + 1][POSN_DATA_NAME];
+        const double* const X = X_data->getLocalFormVecArray()->data();
+        const unsigned int num_local_nodes = X_data->getLocalNodeCount();
+        for (unsigned int k = 0; k < num_local_nodes; ++k)
+        {
+            Index<NDIM> i;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                double x = X[NDIM * k + d];
+                if (periodic_shift(d))
+                {
+                    const double domain_length = domain_x_upper[d] - domain_x_lower[d];
+                    x -= domain_length * floor((x - domain_x_lower[d]) / domain_length);
+                }
+                i(d) = domain_lower(d) +
+                       static_cast<int>(floor((x - domain_x_lower[d]) / level_dx[d]));
+            }
+            add_occupied_block(local_blocks, i, block_size);
+        }
+        X_data->restoreArrays();
+    }
+    std::sort(local_blocks.begin(), local_blocks.end());
+    local_blocks.erase(std::unique(local_blocks.begin(), local_blocks.end()), local_blocks.end());
+
+    // Keep only the blocks that overlap the boxes of the level.
+    Pointer<BoxTree<NDIM> > box_tree = level->getBoxTree();
+    std::vector<int> local_block_data;
+    local_block_data.reserve(NDIM * local_blocks.size());
+    for (std::vector<BlockIndex>::const_iterator it = local_blocks.begin();
+         it != local_blocks.end();
+         ++it)
+    {
+        Index<NDIM> b;
+        for (unsigned int d = 0; d < NDIM; ++d) b(d) = (*it)[d];
+        Box<NDIM> block_box(b, b);
+        block_box.refine(block_size);
+        Array<int> indices;
+        box_tree->findOverlapIndices(indices, block_box);
+        if (indices.getSize() == 0) continue;
+        local_block_data.insert(local_block_data.end(), it->begin(), it->end());
+    }
+
+    // Gather the sorted lists of occupied blocks from all processors.  Only the
+    // occupied blocks are communicated.
+    const int mpi_size = SAMRAI_MPI::getNodes();
+    const int local_block_data_size = static_cast<int>(local_block_data.size());
+    std::vector<int> block_data_size_proc(mpi_size, 0);
+    SAMRAI_MPI::allGather(local_block_data_size, &block_data_size_proc[0]);
+    std::vector<int> block_data_offset_proc(mpi_size + 1, 0);
+    for (int rank = 0; rank < mpi_size; ++rank)
+    {
+        block_data_offset_proc[rank + 1] =
+            block_data_offset_proc[rank] + block_data_size_proc[rank];
+    }
+    std::vector<int> block_data(std::max(block_data_offset_proc[mpi_size], 1));
+    MPI_Allgatherv(local_block_data.empty() ? &block_data[0] : &local_block_data[0],
+                   local_block_data_size,
+                   MPI_INT,
+                   &block_data[0],
+                   &block_data_size_proc[0],
+                   &block_data_offset_proc[0],
+                   MPI_INT,
+                   SAMRAI_MPI::getCommunicator());
+    std::vector<BlockIndex> blocks(block_data_offset_proc[mpi_size] / NDIM);
+    for (unsigned int k = 0; k < blocks.size(); ++k)
+    {
+        for (unsigned int d = 0; d < NDIM; ++d) blocks[k][d] = block_data[NDIM * k + d];
+    }
+    std::sort(blocks.begin(), blocks.end());
+    blocks.erase(std::unique(blocks.begin(), blocks.end()), blocks.end());
+
+    // Tag all cells in the occupied blocks.
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        const Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        Pointer<CellData<NDIM, int> > tag_data = patch->getPatchData(tag_index);
+        const Box<NDIM> patch_blocks = Box<NDIM>::coarsen(patch_box, block_size);
+        for (Box<NDIM>::Iterator b(patch_blocks); b; b++)
+        {
+            BlockIndex block;
+            for (unsigned int d = 0; d < NDIM; ++d) block[d] = b()(d);
+            if (!std::binary_search(blocks.begin(), blocks.end(), block)) continue;
+            Box<NDIM> block_box(b(), b());
+            block_box.refine(block_size);
+            tag_data->fillAll(1, block_box * patch_box);
+        }
+    }
+    return;
+} // tagOccupiedBlocks
+
+void LDataManager::computeNodeDistribution(LIndexDirectory& idx_directory,
+                                           std::vector<int>& prev_local_petsc_indices,
                                            std::vector<int>& local_lag_indices,
                                            std::vector<int>& nonlocal_lag_indices,
                                            std::vector<int>& local_petsc_indices,
@@ -3106,9 +3425,6 @@ void LDataManager::computeNodeDistribution(AO& ao,
         }
     }
 
-    // Compute the new PETSc global ordering and initialize the AO object.
-    int ierr;
-
     // Determine how many nodes are on each processor to calculate the PETSc
     // indexing scheme.
     const unsigned int num_local_nodes = local_lag_indices.size();
@@ -3125,53 +3441,22 @@ void LDataManager::computeNodeDistribution(AO& ao,
 
     computeNodeOffsets(num_nodes, node_offset, num_local_nodes);
 
-    // Determine the PETSc ordering and setup the new AO object.
-    const int num_proc_nodes = num_local_nodes + num_nonlocal_nodes;
-
-    std::vector<int> node_indices;
-    node_indices.reserve(num_proc_nodes);
-    node_indices.insert(
-        node_indices.end(), local_lag_indices.begin(), local_lag_indices.end());
+    // Determine the PETSc indices of the local nodes in the previous ordering
+    // before resetting the index directory.
+    prev_local_petsc_indices = local_lag_indices;
+    idx_directory.mapLagrangianToPETSc(prev_local_petsc_indices);
 
+    // Determine the PETSc ordering and reset the index directory.
     local_petsc_indices.resize(num_local_nodes);
     for (unsigned int k = 0; k < num_local_nodes; ++k)
     {
         local_petsc_indices[k] = node_offset + k;
     }
+    idx_directory.resetIndices(local_lag_indices, num_nodes, node_offset);
 
-    if (ao)
-    {
-        ierr = AODestroy(&ao);
-        IBTK_CHKERRQ(ierr);
-    }
-
-    ierr = AOCreateMapping(PETSC_COMM_WORLD,
-                           num_local_nodes,
-                           num_local_nodes > 0 ? &node_indices[0] : NULL,
-                           num_local_nodes > 0 ? &local_petsc_indices[0] : NULL,
-                           &ao);
-    IBTK_CHKERRQ(ierr);
-
-    // Determine the PETSc local to global mapping (including PETSc Vec ghost
-    // indices).
-    //
-    // NOTE: After this operation, data stored in node_indices are in the global
-    // PETSc ordering.
-    node_indices.reserve(node_indices.size() + nonlocal_lag_indices.size());
-    node_indices.insert(
-        node_indices.end(), nonlocal_lag_indices.begin(), nonlocal_lag_indices.end());
-    ierr = AOApplicationToPetsc(
-        ao,
-        (num_proc_nodes > 0 ? num_proc_nodes : static_cast<int>(s_ao_dummy.size())),
-        (num_proc_nodes > 0 ? &node_indices[0] : &s_ao_dummy[0]));
-    IBTK_CHKERRQ(ierr);
-
-    // Keep track of the global PETSc indices of the ghost nodes.
-    nonlocal_petsc_indices.clear();
-    nonlocal_petsc_indices.reserve(num_nonlocal_nodes);
-    nonlocal_petsc_indices.insert(nonlocal_petsc_indices.end(),
-                                  node_indices.begin() + num_local_nodes,
-                                  node_indices.end());
+    // Determine the global PETSc indices of the ghost nodes.
+    nonlocal_petsc_indices = nonlocal_lag_indices;
+    idx_directory.mapLagrangianToPETSc(nonlocal_petsc_indices);
 
     // Store the global PETSc index in the local LNode objects.
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
@@ -3185,7 +3470,11 @@ void LDataManager::computeNodeDistribution(AO& ao,
              ++it)
         {
             LNode* const node_idx = *it;
-            node_idx->setGlobalPETScIndex(node_indices[node_idx->getLocalPETScIndex()]);
+            const unsigned int local_petsc_idx = node_idx->getLocalPETScIndex();
+            node_idx->setGlobalPETScIndex(
+                local_petsc_idx < num_local_nodes ?
+                    local_petsc_indices[local_petsc_idx] :
+                    nonlocal_petsc_indices[local_petsc_idx - num_local_nodes]);
         }
     }
 
@@ -3256,7 +3545,7 @@ void LDataManager::getFromRestart()
     d_lag_mesh.resize(d_finest_ln + 1);
     d_lag_mesh_data.resize(d_finest_ln + 1);
     d_needs_synch.resize(d_finest_ln + 1, false);
-    d_ao.resize(d_finest_ln + 1);
+    d_idx_directory.resize(d_finest_ln + 1);
     d_num_nodes.resize(d_finest_ln + 1);
     d_node_offset.resize(d_finest_ln + 1);
     d_local_lag_indices.resize(d_finest_ln + 1);
@@ -3376,15 +3665,11 @@ void LDataManager::getFromRestart()
                                       n_nonlocal_petsc_indices);
         }
 
-        // Rebuild the application ordering.
-        int ierr;
-        ierr = AOCreateMapping(
-            PETSC_COMM_WORLD,
-            n_local_lag_indices,
-            n_local_lag_indices > 0 ? &d_local_lag_indices[level_number][0] : NULL,
-            n_local_lag_indices > 0 ? &d_local_petsc_indices[level_number][0] : NULL,
-            &d_ao[level_number]);
-        IBTK_CHKERRQ(ierr);
+        // Rebuild the index directory.
+        d_idx_directory[level_number] = new LIndexDirectory();
+        d_idx_directory[level_number]->resetIndices(d_local_lag_indices[level_number],
+                                                    d_num_nodes[level_number],
+                                                    d_node_offset[level_number]);
     }
     return;
 } // getFromRestart
@@ -56,13 +56,14 @@
 #include "StandardTagAndInitStrategy.h"
 #include "VariableContext.h"
 #include "VisItDataWriter.h"
+#include "ibtk/LIndexDirectory.h"
 #include "ibtk/LInitStrategy.h"
 #include "ibtk/LNodeSet.h"
 #include "ibtk/LNodeSetVariable.h"
 #include "ibtk/LSiloDataWriter.h"
 #include "ibtk/ParallelSet.h"
 #include "ibtk/ibtk_utilities.h"
-#include "petscao.h"
+#include "mpi.h"
 #include "petscvec.h"
 #include "tbox/Pointer.h"
 #include "tbox/Serializable.h"
@@ -534,6 +535,22 @@ public:
         SAMRAI::tbox::Pointer<SAMRAI::mesh::LoadBalancer<NDIM> > load_balancer,
         int workload_data_idx);
 
+    /*!
+     * \brief Enable or disable occupancy-based tagging of cells for refinement.
+     *
+     * When occupancy-based tagging is enabled, cells are tagged for refinement
+     * in blocks of block_size cells in each coordinate direction.  The blocks
+     * that contain Lagrangian nodes are determined by a single pass over the
+     * local node positions, and the sorted lists of occupied blocks that
+     * overlap the level are gathered from all processors.  Only the occupied
+     * blocks are communicated.  Because the tagged regions are unions of whole
+     * blocks, they are clustered into fewer and more compact boxes than
+     * node-by-node tags.
+     *
+     * \note Occupancy-based tagging is disabled by default.
+     */
+    void setUseOccupancyTagging(bool use_occupancy_tagging, int block_size = 4);
+
     /*!
      * \brief Indicates whether there is Lagrangian data on the given patch
      * hierarchy level.
@@ -746,6 +763,8 @@ public:
     /*!
      * \brief Set the components of the supplied LData object to zero
      * for those entries that correspond to inactivated structures.
+     *
+     * \note This method is collective on all MPI processes.
      */
     void zeroInactivatedComponents(SAMRAI::tbox::Pointer<LData> lag_data,
                                    int level_number) const;
@@ -753,12 +772,21 @@ public:
     /*!
      * \brief Map the collection of Lagrangian indices to the corresponding
      * global PETSc indices.
+     *
+     * \note This method is collective on all MPI processes.  It exchanges the
+     * queries with the processors that store the relevant entries of the
+     * distributed index directory via MPI_Alltoall and MPI_Alltoallv.  Every
+     * process must therefore call it for the same level, even when it has no
+     * indices to map.
      */
     void mapLagrangianToPETSc(std::vector<int>& inds, int level_number) const;
 
     /*!
      * \brief Map the collection of global PETSc indices to the corresponding
      * Lagrangian indices.
+     *
+     * \note This method is collective on all MPI processes.  Every process must
+     * call it for the same level, even when it has no indices to map.
      */
     void mapPETScToLagrangian(std::vector<int>& inds, int level_number) const;
 
@@ -792,6 +820,50 @@ public:
      */
     void scatterToZero(Vec& parallel_vec, Vec& sequential_vec) const;
 
+    /*!
+     * \brief Start writing the Lagrangian data on the specified range of levels
+     * to a binary checkpoint stored in the specified directory.
+     *
+     * Each LData object is written to its own file in global Lagrangian index
+     * order using collective MPI-IO, so that the checkpoint does not depend on
+     * the number of processors or on the present data distribution.  The data
+     * are copied into Lagrangian-ordered buffers before this method returns,
+     * so the LData may be modified immediately; the file writes themselves are
+     * posted as split collective operations and are not guaranteed to complete
+     * until endLagrangianCheckpoint() is called.
+     *
+     * \note Files are written in the native byte order of the machine.
+     *
+     * \see endLagrangianCheckpoint
+     * \see readLagrangianCheckpoint
+     */
+    void beginLagrangianCheckpoint(const std::string& dirname,
+                                   int coarsest_ln = -1,
+                                   int finest_ln = -1);
+
+    /*!
+     * \brief Finish writing any Lagrangian checkpoint started by
+     * beginLagrangianCheckpoint().
+     *
+     * \see beginLagrangianCheckpoint
+     */
+    void endLagrangianCheckpoint();
+
+    /*!
+     * \brief Read the Lagrangian data on the specified range of levels from a
+     * binary checkpoint written by beginLagrangianCheckpoint().
+     *
+     * Only LData objects that are already allocated are read, and the number of
+     * processors need not match the number used to write the checkpoint.
+     *
+     * \note Reading the checkpoint may relocate the Lagrangian mesh nodes, so
+     * that the caller should subsequently redistribute the Lagrangian data via
+     * beginDataRedistribution() and endDataRedistribution().
+     */
+    void readLagrangianCheckpoint(const std::string& dirname,
+                                  int coarsest_ln = -1,
+                                  int finest_ln = -1);
+
     /*!
      * \brief Start the process of redistributing the Lagrangian data.
      *
@@ -948,8 +1020,8 @@ protected:
                  bool register_for_restart = true);
 
     /*!
-     * \brief The LDataManager destructor cleans up any remaining PETSc AO
-     * objects.
+     * \brief The LDataManager destructor completes any outstanding Lagrangian
+     * checkpoint writes.
      */
     ~LDataManager();
 
@@ -1006,6 +1078,17 @@ private:
      */
     void endNonlocalDataFill(int coarsest_ln = -1, int finest_ln = -1);
 
+    /*!
+     * \brief Tag cells for refinement on the specified level in each block of
+     * cells that is occupied by Lagrangian nodes.
+     *
+     * At the initial time, the occupied blocks are those that contain cells that
+     * have already been tagged by the Lagrangian initialization strategy.  At
+     * later times, they are those that contain nodes on the next finer level
+     * of the patch hierarchy.
+     */
+    void tagOccupiedBlocks(int level_number, int tag_index, bool initial_time);
+
     /*!
      * Determines the global Lagrangian and PETSc indices of the local and
      * nonlocal nodes associated with the processor as well as the local PETSc
@@ -1027,8 +1110,13 @@ private:
      * Since each processor may own multiple patches in a given level, nodes
      * appearing in the ghost cell region of a patch may or may not be owned by
      * this processor.
+     *
+     * \note The global PETSc indices that the local nodes had before the
+     * distribution was recomputed are returned in prev_local_petsc_indices, and
+     * the index directory is reset to the new distribution.
      */
-    void computeNodeDistribution(AO& ao,
+    void computeNodeDistribution(LIndexDirectory& idx_directory,
+                                 std::vector<int>& prev_local_petsc_indices,
                                  std::vector<int>& local_lag_indices,
                                  std::vector<int>& nonlocal_lag_indices,
                                  std::vector<int>& local_petsc_indices,
@@ -1129,6 +1217,13 @@ private:
     int d_node_count_idx;
     bool d_output_node_count;
 
+    /*
+     * Whether to tag cells for refinement in blocks of cells that are occupied
+     * by Lagrangian nodes, and the size of those blocks.
+     */
+    bool d_use_occupancy_tagging;
+    int d_occupancy_block_size;
+
     /*
      * The kernel functions used to mediate Lagrangian-Eulerian interaction.
      */
@@ -1198,11 +1293,10 @@ private:
     std::vector<bool> d_needs_synch;
 
     /*!
-     * PETSc AO objects provide mappings between the fixed global Lagrangian
-     * node IDs and the ever-changing global PETSc ordering.
+     * Distributed directories provide mappings between the fixed global
+     * Lagrangian node IDs and the ever-changing global PETSc ordering.
      */
-    std::vector<AO> d_ao;
-    static std::vector<int> s_ao_dummy;
+    std::vector<SAMRAI::tbox::Pointer<LIndexDirectory> > d_idx_directory;
 
     /*!
      * The total number of nodes for all processors.
@@ -1253,6 +1347,18 @@ private:
     std::vector<std::vector<int> > d_nonlocal_petsc_indices;
 
     //\}
+
+    /*!
+     * Data associated with the Lagrangian checkpoint writes that have been
+     * posted by beginLagrangianCheckpoint() but that have not yet completed.
+     */
+    struct CheckpointWrite
+    {
+        MPI_File file;
+        Vec lag_vec;
+        double* lag_vec_array;
+    };
+    std::vector<CheckpointWrite> d_pending_checkpoint_writes;
 };
 } // namespace IBTK
 
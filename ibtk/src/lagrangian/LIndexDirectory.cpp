@@ -0,0 +1,280 @@
+// Filename: LIndexDirectory.cpp
+// Created on 19 Oct 2026 by Boyce Griffith
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of New York University nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <algorithm>
+#include <vector>
+
+#include "ibtk/LIndexDirectory.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "mpi.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Send the values in send_data, which are grouped by destination processor
+// according to send_counts, and return the values received from each processor,
+// grouped by source processor, in recv_data and recv_counts.
+void exchange_data(std::vector<int>& send_counts,
+                   std::vector<int>& send_data,
+                   std::vector<int>& recv_counts,
+                   std::vector<int>& recv_data)
+{
+    const int mpi_size = SAMRAI_MPI::getNodes();
+    MPI_Comm communicator = SAMRAI_MPI::getCommunicator();
+    recv_counts.resize(mpi_size);
+    MPI_Alltoall(&send_counts[0], 1, MPI_INT, &recv_counts[0], 1, MPI_INT, communicator);
+    std::vector<int> send_displs(mpi_size, 0), recv_displs(mpi_size, 0);
+    for (int rank = 1; rank < mpi_size; ++rank)
+    {
+        send_displs[rank] = send_displs[rank - 1] + send_counts[rank - 1];
+        recv_displs[rank] = recv_displs[rank - 1] + recv_counts[rank - 1];
+    }
+    recv_data.resize(recv_displs[mpi_size - 1] + recv_counts[mpi_size - 1]);
+
+    // Pad the buffers so that they are never empty.
+    send_data.push_back(0);
+    recv_data.push_back(0);
+    MPI_Alltoallv(&send_data[0],
+                  &send_counts[0],
+                  &send_displs[0],
+                  MPI_INT,
+                  &recv_data[0],
+                  &recv_counts[0],
+                  &recv_displs[0],
+                  MPI_INT,
+                  communicator);
+    send_data.pop_back();
+    recv_data.pop_back();
+    return;
+} // exchange_data
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+LIndexDirectory::LIndexDirectory()
+    : d_num_nodes(0), d_block_size(1), d_node_offsets(), d_local_lag_indices(),
+      d_petsc_indices()
+{
+    // intentionally blank
+    return;
+} // LIndexDirectory
+
+LIndexDirectory::~LIndexDirectory()
+{
+    // intentionally blank
+    return;
+} // ~LIndexDirectory
+
+void LIndexDirectory::resetIndices(const std::vector<int>& local_lag_indices,
+                                   const unsigned int num_nodes,
+                                   const unsigned int node_offset)
+{
+    const int mpi_size = SAMRAI_MPI::getNodes();
+    const int mpi_rank = SAMRAI_MPI::getRank();
+    const int num_local_nodes = static_cast<int>(local_lag_indices.size());
+
+    // Determine which local nodes have different PETSc indices than they had
+    // when the directory was last reset.  If the total number of nodes has
+    // changed, the entire directory is rebuilt.
+    const bool reset_all = d_node_offsets.empty() || num_nodes != d_num_nodes;
+    const bool same_offset =
+        !reset_all && static_cast<int>(node_offset) == d_node_offsets[mpi_rank];
+    const int num_prev_local_nodes = static_cast<int>(d_local_lag_indices.size());
+    std::vector<bool> changed(num_local_nodes, true);
+    if (same_offset)
+    {
+        for (int k = 0; k < std::min(num_local_nodes, num_prev_local_nodes); ++k)
+        {
+            changed[k] = d_local_lag_indices[k] != local_lag_indices[k];
+        }
+    }
+
+    // Reset the locally owned data.
+    d_num_nodes = num_nodes;
+    d_block_size = std::max(1U, (num_nodes + mpi_size - 1) / mpi_size);
+    d_local_lag_indices = local_lag_indices;
+    std::vector<int> num_nodes_proc(mpi_size, 0);
+    SAMRAI_MPI::allGather(num_local_nodes, &num_nodes_proc[0]);
+    d_node_offsets.resize(mpi_size + 1);
+    d_node_offsets[0] = 0;
+    for (int rank = 0; rank < mpi_size; ++rank)
+    {
+        d_node_offsets[rank + 1] = d_node_offsets[rank] + num_nodes_proc[rank];
+    }
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_node_offsets[mpi_rank] == static_cast<int>(node_offset));
+    TBOX_ASSERT(d_node_offsets[mpi_size] == static_cast<int>(num_nodes));
+#endif
+    const int first_lag_idx = std::min(mpi_rank * d_block_size, d_num_nodes);
+    const int last_lag_idx = std::min((mpi_rank + 1) * d_block_size, d_num_nodes);
+    if (reset_all) d_petsc_indices.assign(last_lag_idx - first_lag_idx, -1);
+
+    // Send the (Lagrangian index, PETSc index) pairs of the changed entries to
+    // the processors that store them.
+    std::vector<int> send_counts(mpi_size, 0);
+    for (int k = 0; k < num_local_nodes; ++k)
+    {
+        if (changed[k]) send_counts[getDirectoryRank(local_lag_indices[k])] += 2;
+    }
+    std::vector<int> send_offsets(mpi_size, 0);
+    for (int rank = 1; rank < mpi_size; ++rank)
+    {
+        send_offsets[rank] = send_offsets[rank - 1] + send_counts[rank - 1];
+    }
+    std::vector<int> send_data(send_offsets[mpi_size - 1] + send_counts[mpi_size - 1]);
+    for (int k = 0; k < num_local_nodes; ++k)
+    {
+        if (!changed[k]) continue;
+        const int rank = getDirectoryRank(local_lag_indices[k]);
+        send_data[send_offsets[rank]++] = local_lag_indices[k];
+        send_data[send_offsets[rank]++] = node_offset + k;
+    }
+    std::vector<int> recv_counts, recv_data;
+    exchange_data(send_counts, send_data, recv_counts, recv_data);
+    for (unsigned int k = 0; k < recv_data.size(); k += 2)
+    {
+        const int idx = recv_data[k] - first_lag_idx;
+#if !defined(NDEBUG)
+        TBOX_ASSERT(0 <= idx && idx < static_cast<int>(d_petsc_indices.size()));
+#endif
+        d_petsc_indices[idx] = recv_data[k + 1];
+    }
+#if !defined(NDEBUG)
+    TBOX_ASSERT(std::find(d_petsc_indices.begin(), d_petsc_indices.end(), -1) ==
+                d_petsc_indices.end());
+#endif
+    return;
+} // resetIndices
+
+void LIndexDirectory::mapLagrangianToPETSc(std::vector<int>& inds) const
+{
+    mapIndices(inds, /*lag_to_petsc*/ true);
+    return;
+} // mapLagrangianToPETSc
+
+void LIndexDirectory::mapPETScToLagrangian(std::vector<int>& inds) const
+{
+    mapIndices(inds, /*lag_to_petsc*/ false);
+    return;
+} // mapPETScToLagrangian
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+int LIndexDirectory::getDirectoryRank(const int lag_idx) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(0 <= lag_idx && lag_idx < static_cast<int>(d_num_nodes));
+#endif
+    return lag_idx / d_block_size;
+} // getDirectoryRank
+
+int LIndexDirectory::getOwnerRank(const int petsc_idx) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(0 <= petsc_idx && petsc_idx < static_cast<int>(d_num_nodes));
+#endif
+    return static_cast<int>(
+               std::upper_bound(d_node_offsets.begin(), d_node_offsets.end(), petsc_idx) -
+               d_node_offsets.begin()) -
+           1;
+} // getOwnerRank
+
+void LIndexDirectory::mapIndices(std::vector<int>& inds, const bool lag_to_petsc) const
+{
+    const int mpi_size = SAMRAI_MPI::getNodes();
+    const int mpi_rank = SAMRAI_MPI::getRank();
+    const int num_inds = static_cast<int>(inds.size());
+
+    // Group the queries by the processor that is able to answer them.
+    std::vector<int> dst_ranks(num_inds, -1);
+    std::vector<int> send_counts(mpi_size, 0);
+    for (int k = 0; k < num_inds; ++k)
+    {
+        if (inds[k] < 0) continue;
+        dst_ranks[k] = lag_to_petsc ? getDirectoryRank(inds[k]) : getOwnerRank(inds[k]);
+        ++send_counts[dst_ranks[k]];
+    }
+    std::vector<int> send_offsets(mpi_size, 0);
+    for (int rank = 1; rank < mpi_size; ++rank)
+    {
+        send_offsets[rank] = send_offsets[rank - 1] + send_counts[rank - 1];
+    }
+    std::vector<int> queries(send_offsets[mpi_size - 1] + send_counts[mpi_size - 1]);
+    std::vector<int> query_positions(queries.size());
+    for (int k = 0; k < num_inds; ++k)
+    {
+        if (dst_ranks[k] < 0) continue;
+        const int pos = send_offsets[dst_ranks[k]]++;
+        queries[pos] = inds[k];
+        query_positions[pos] = k;
+    }
+
+    // Answer the queries posed by all processors.
+    std::vector<int> recv_counts, answers;
+    exchange_data(send_counts, queries, recv_counts, answers);
+    const std::vector<int>& table = lag_to_petsc ? d_petsc_indices : d_local_lag_indices;
+    const int first_lag_idx = std::min(mpi_rank * d_block_size, d_num_nodes);
+    const int first_idx = lag_to_petsc ? first_lag_idx : d_node_offsets[mpi_rank];
+    for (std::vector<int>::iterator it = answers.begin(); it != answers.end(); ++it)
+    {
+        const int idx = *it - first_idx;
+#if !defined(NDEBUG)
+        TBOX_ASSERT(0 <= idx && idx < static_cast<int>(table.size()));
+#endif
+        *it = table[idx];
+    }
+
+    // Return the answers to the processors that posed the queries.
+    exchange_data(recv_counts, answers, send_counts, queries);
+    for (unsigned int k = 0; k < queries.size(); ++k)
+    {
+        inds[query_positions[k]] = queries[k];
+    }
+    return;
+} // mapIndices
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,170 @@
+// Filename: LIndexDirectory.h
+// Created on 19 Oct 2026 by Boyce Griffith
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of New York University nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_LIndexDirectory
+#define included_LIndexDirectory
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <vector>
+
+#include "tbox/DescribedClass.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class LIndexDirectory is a distributed directory that maps between the
+ * fixed global Lagrangian indices and the time-dependent global PETSc indices
+ * of the nodes of a Lagrangian mesh.
+ *
+ * The Lagrangian-to-PETSc mapping is stored in blocks of contiguous Lagrangian
+ * indices that are assigned to the processors in rank order, so that the
+ * processor that stores the entry for any Lagrangian index can be determined
+ * without communication.  The PETSc-to-Lagrangian mapping is provided by the
+ * processor that owns the PETSc index.  Each mapping operation therefore
+ * requires only two all-to-all exchanges, and, unlike a PETSc AO, the directory
+ * does not require a global sort when it is reset.
+ *
+ * \note All methods of this class are collective.
+ */
+class LIndexDirectory : public SAMRAI::tbox::DescribedClass
+{
+public:
+    /*!
+     * \brief Default constructor.
+     */
+    LIndexDirectory();
+
+    /*!
+     * \brief Destructor.
+     */
+    ~LIndexDirectory();
+
+    /*!
+     * \brief Reset the directory so that the local node with Lagrangian index
+     * local_lag_indices[k] has global PETSc index node_offset+k.
+     *
+     * Unless the total number of nodes has changed, only those directory
+     * entries that differ from the ones set by the previous call to
+     * resetIndices() are communicated.
+     */
+    void resetIndices(const std::vector<int>& local_lag_indices,
+                      unsigned int num_nodes,
+                      unsigned int node_offset);
+
+    /*!
+     * \brief Map the collection of Lagrangian indices to the corresponding
+     * global PETSc indices.
+     *
+     * \note Negative indices are not modified.
+     */
+    void mapLagrangianToPETSc(std::vector<int>& inds) const;
+
+    /*!
+     * \brief Map the collection of global PETSc indices to the corresponding
+     * Lagrangian indices.
+     *
+     * \note Negative indices are not modified.
+     */
+    void mapPETScToLagrangian(std::vector<int>& inds) const;
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    LIndexDirectory(const LIndexDirectory& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    LIndexDirectory& operator=(const LIndexDirectory& that);
+
+    /*!
+     * \brief Return the rank of the processor that stores the directory entry
+     * for the specified Lagrangian index.
+     */
+    int getDirectoryRank(int lag_idx) const;
+
+    /*!
+     * \brief Return the rank of the processor that owns the specified global
+     * PETSc index.
+     */
+    int getOwnerRank(int petsc_idx) const;
+
+    /*!
+     * \brief Map the collection of indices from the Lagrangian ordering to the
+     * PETSc ordering (if lag_to_petsc is true) or from the PETSc ordering to the
+     * Lagrangian ordering (if lag_to_petsc is false).
+     */
+    void mapIndices(std::vector<int>& inds, bool lag_to_petsc) const;
+
+    /*!
+     * The total number of nodes and the number of Lagrangian indices whose
+     * directory entries are stored on each processor.
+     */
+    unsigned int d_num_nodes, d_block_size;
+
+    /*!
+     * The first global PETSc index owned by each processor, followed by the
+     * total number of nodes.
+     */
+    std::vector<int> d_node_offsets;
+
+    /*!
+     * The Lagrangian indices of the nodes owned by this processor, in the local
+     * PETSc ordering.
+     */
+    std::vector<int> d_local_lag_indices;
+
+    /*!
+     * The global PETSc indices of the block of Lagrangian indices whose
+     * directory entries are stored on this processor.
+     */
+    std::vector<int> d_petsc_indices;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_LIndexDirectory
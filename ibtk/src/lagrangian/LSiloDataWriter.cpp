@@ -44,6 +44,7 @@
 #include "LSiloDataWriter.h"
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/LData.h"
+#include "ibtk/LIndexDirectory.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "mpi.h"
 #include "petscis.h"
@@ -665,7 +666,7 @@ LSiloDataWriter::LSiloDataWriter(const std::string& object_name,
       d_coords_data(d_finest_ln + 1, Pointer<LData>(NULL)), d_nvars(d_finest_ln + 1, 0),
       d_var_names(d_finest_ln + 1), d_var_start_depths(d_finest_ln + 1),
       d_var_plot_depths(d_finest_ln + 1), d_var_depths(d_finest_ln + 1),
-      d_var_data(d_finest_ln + 1), d_ao(d_finest_ln + 1),
+      d_var_data(d_finest_ln + 1), d_idx_directory(d_finest_ln + 1),
       d_build_vec_scatters(d_finest_ln + 1), d_src_vec(d_finest_ln + 1),
       d_dst_vec(d_finest_ln + 1), d_vec_scatter(d_finest_ln + 1)
 {
@@ -837,7 +838,7 @@ void LSiloDataWriter::resetLevels(const int coarsest_ln, const int finest_ln)
     d_var_depths.resize(d_finest_ln + 1);
     d_var_data.resize(d_finest_ln + 1);
 
-    d_ao.resize(d_finest_ln + 1);
+    d_idx_directory.resize(d_finest_ln + 1);
     d_build_vec_scatters.resize(d_finest_ln + 1);
     d_src_vec.resize(d_finest_ln + 1);
     d_dst_vec.resize(d_finest_ln + 1);
@@ -1194,7 +1195,8 @@ void LSiloDataWriter::registerVariableData(const std::string& var_name,
     return;
 } // registerVariableData
 
-void LSiloDataWriter::registerLagrangianAO(AO& ao, const int level_number)
+void LSiloDataWriter::registerLagrangianIndexDirectory(Pointer<LIndexDirectory> idx_directory,
+                                                       const int level_number)
 {
     if (level_number < d_coarsest_ln || level_number > d_finest_ln)
     {
@@ -1205,14 +1207,15 @@ void LSiloDataWriter::registerLagrangianAO(AO& ao, const int level_number)
 #if !defined(NDEBUG)
     TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
 #endif
-    d_ao[level_number] = ao;
+    d_idx_directory[level_number] = idx_directory;
     d_build_vec_scatters[level_number] = true;
     return;
-} // registerLagrangianAO
+} // registerLagrangianIndexDirectory
 
-void LSiloDataWriter::registerLagrangianAO(std::vector<AO>& ao,
-                                           const int coarsest_ln,
-                                           const int finest_ln)
+void LSiloDataWriter::registerLagrangianIndexDirectory(
+    const std::vector<Pointer<LIndexDirectory> >& idx_directory,
+    const int coarsest_ln,
+    const int finest_ln)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(coarsest_ln <= finest_ln);
@@ -1229,10 +1232,10 @@ void LSiloDataWriter::registerLagrangianAO(std::vector<AO>& ao,
 
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
-        registerLagrangianAO(ao[ln], ln);
+        registerLagrangianIndexDirectory(idx_directory[ln], ln);
     }
     return;
-} // registerLagrangianAO
+} // registerLagrangianIndexDirectory
 
 void LSiloDataWriter::writePlotData(const int time_step_number, const double simulation_time)
 {
@@ -1269,9 +1272,9 @@ void LSiloDataWriter::writePlotData(const int time_step_number, const double sim
     // Construct the VecScatter objects required to write the plot data.
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
-        if (d_build_vec_scatters[ln])
+        if (d_build_vec_scatters[ln] && d_idx_directory[ln])
         {
-            buildVecScatters(d_ao[ln], ln);
+            buildVecScatters(*d_idx_directory[ln], ln);
         }
         d_build_vec_scatters[ln] = false;
     }
@@ -2309,7 +2312,8 @@ void LSiloDataWriter::putToDatabase(Pointer<Database> db)
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
-void LSiloDataWriter::buildVecScatters(AO& ao, const int level_number)
+void LSiloDataWriter::buildVecScatters(const LIndexDirectory& idx_directory,
+                                       const int level_number)
 {
     if (!d_coords_data[level_number]) return;
 
@@ -2368,12 +2372,7 @@ void LSiloDataWriter::buildVecScatters(AO& ao, const int level_number)
     }
 
     // Map Lagrangian indices to PETSc indices.
-    std::vector<int> ao_dummy(1, -1);
-    ierr = AOApplicationToPetsc(ao,
-                                (!ref_is_idxs.empty() ? static_cast<int>(ref_is_idxs.size()) :
-                                                        static_cast<int>(ao_dummy.size())),
-                                (!ref_is_idxs.empty() ? &ref_is_idxs[0] : &ao_dummy[0]));
-    IBTK_CHKERRQ(ierr);
+    idx_directory.mapLagrangianToPETSc(ref_is_idxs);
 
     // Setup IS indices for all necessary data depths.
     std::map<int, std::vector<int> > src_is_idxs;
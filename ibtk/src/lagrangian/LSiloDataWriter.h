@@ -43,7 +43,6 @@
 
 #include "IntVector.h"
 #include "PatchHierarchy.h"
-#include "petscao.h"
 #include "petscvec.h"
 #include "tbox/Pointer.h"
 #include "tbox/Serializable.h"
@@ -51,6 +50,7 @@
 namespace IBTK
 {
 class LData;
+class LIndexDirectory;
 } // namespace IBTK
 namespace SAMRAI
 {
@@ -185,26 +185,30 @@ public:
                               int level_number);
 
     /*!
-     * \brief Register or update a single Lagrangian AO (application ordering)
-     * objects with the Silo data writer.
+     * \brief Register or update a single Lagrangian index directory with the
+     * Silo data writer.
      *
-     * These AO objects are used to map between (fixed) Lagrangian indices and
-     * (time-dependent) PETSc indices.  Each time that the AO objects are reset
-     * (e.g., during adaptive regridding), the new AO objects must be supplied
-     * to the Silo data writer.
+     * Index directories are used to map between (fixed) Lagrangian indices and
+     * (time-dependent) PETSc indices.  Each time that the index directories are
+     * reset (e.g., during adaptive regridding), they must be re-registered with
+     * the Silo data writer.
      */
-    void registerLagrangianAO(AO& ao, int level_number);
+    void registerLagrangianIndexDirectory(SAMRAI::tbox::Pointer<LIndexDirectory> idx_directory,
+                                          int level_number);
 
     /*!
-     * \brief Register or update a collection of Lagrangian AO (application
-     * ordering) objects with the Silo data writer.
+     * \brief Register or update a collection of Lagrangian index directories
+     * with the Silo data writer.
      *
-     * These AO objects are used to map between (fixed) Lagrangian indices and
-     * (time-dependent) PETSc indices.  Each time that the AO objects are reset
-     * (e.g., during adaptive regridding), the new AO objects must be supplied
-     * to the Silo data writer.
+     * Index directories are used to map between (fixed) Lagrangian indices and
+     * (time-dependent) PETSc indices.  Each time that the index directories are
+     * reset (e.g., during adaptive regridding), they must be re-registered with
+     * the Silo data writer.
      */
-    void registerLagrangianAO(std::vector<AO>& ao, int coarsest_ln, int finest_ln);
+    void registerLagrangianIndexDirectory(
+        const std::vector<SAMRAI::tbox::Pointer<LIndexDirectory> >& idx_directory,
+        int coarsest_ln,
+        int finest_ln);
 
     /*!
      * \brief Write the plot data to disk.
@@ -251,7 +255,7 @@ private:
      * \brief Build the VecScatter objects required to communicate data for
      * plotting.
      */
-    void buildVecScatters(AO& ao, int level_number);
+    void buildVecScatters(const LIndexDirectory& idx_directory, int level_number);
 
     /*!
      * Read object state from the restart file and initialize class data
@@ -340,7 +344,7 @@ private:
     /*
      * Data for obtaining local data.
      */
-    std::vector<AO> d_ao;
+    std::vector<SAMRAI::tbox::Pointer<LIndexDirectory> > d_idx_directory;
     std::vector<bool> d_build_vec_scatters;
     std::vector<std::map<int, Vec> > d_src_vec, d_dst_vec;
     std::vector<std::map<int, VecScatter> > d_vec_scatter;
@@ -33,6 +33,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <ostream>
+#include <vector>
 
 #include "ArrayDataBasicOps.h"
 #include "BasePatchLevel.h"
@@ -71,6 +72,7 @@
 #include "Variable.h"
 #include "VariableDatabase.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/PatchTaskExecutor.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Array.h"
 #include "tbox/MathUtilities.h"
@@ -118,6 +120,604 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Returns true when the operator described by poisson_spec can be negated
+// without touching any patch data, i.e., when C and D are spatially constant.
+inline bool has_constant_coefficients(const PoissonSpecifications& poisson_spec)
+{
+    return poisson_spec.dIsConstant() &&
+           (poisson_spec.cIsConstant() || poisson_spec.cIsZero());
+} // has_constant_coefficients
+
+// Sets neg_spec to describe the operator -(C + div D grad).
+inline void negate_constant_coefficients(PoissonSpecifications& neg_spec,
+                                         const PoissonSpecifications& poisson_spec)
+{
+    if (poisson_spec.cIsZero())
+    {
+        neg_spec.setCZero();
+    }
+    else
+    {
+        neg_spec.setCConstant(-poisson_spec.getCConstant());
+    }
+    neg_spec.setDConstant(-poisson_spec.getDConstant());
+    return;
+} // negate_constant_coefficients
+
+// Returns the data associated with data_idx on the patch, or a NULL pointer
+// when data_idx is negative.
+template <class DataType>
+inline Pointer<DataType> get_optional_patch_data(const Pointer<Patch<NDIM> >& patch,
+                                                 const int data_idx)
+{
+    if (data_idx < 0) return Pointer<DataType>();
+    return patch->getPatchData(data_idx);
+} // get_optional_patch_data
+
+// The following classes package the patch-based operations provided by
+// PatchMathOps as tasks that are executed on each patch of a level by
+// PatchTaskExecutor::execute().
+
+// Computes dst = op src, in which op is a PatchMathOps member function of the
+// form op(dst, src, patch), e.g., curl, rot, interp, or a pointwise norm.
+template <class DstData, class SrcData>
+class UnaryOpTask
+{
+public:
+    typedef void (PatchMathOps::*Operator)(Pointer<DstData>,
+                                           Pointer<SrcData>,
+                                           Pointer<Patch<NDIM> >) const;
+
+    UnaryOpTask(const PatchMathOps& patch_math_ops,
+                const Operator op,
+                const int dst_idx,
+                const int src_idx)
+        : d_patch_math_ops(patch_math_ops), d_op(op), d_dst_idx(dst_idx), d_src_idx(src_idx)
+    {
+    } // UnaryOpTask
+
+    void operator()(const Pointer<Patch<NDIM> >& patch) const
+    {
+        Pointer<DstData> dst_data = patch->getPatchData(d_dst_idx);
+        Pointer<SrcData> src_data = patch->getPatchData(d_src_idx);
+        (d_patch_math_ops.*d_op)(dst_data, src_data, patch);
+        return;
+    } // operator()
+
+private:
+    const PatchMathOps& d_patch_math_ops;
+    const Operator d_op;
+    const int d_dst_idx, d_src_idx;
+};
+
+// Computes dst_l = alpha div src1 + beta src2_m.
+template <class Src1Data>
+class DivTask
+{
+public:
+    DivTask(const PatchMathOps& patch_math_ops,
+            const int dst_idx,
+            const double alpha,
+            const int src1_idx,
+            const double beta,
+            const int src2_idx,
+            const int dst_depth,
+            const int src2_depth)
+        : d_patch_math_ops(patch_math_ops), d_dst_idx(dst_idx), d_alpha(alpha),
+          d_src1_idx(src1_idx), d_beta(beta), d_src2_idx(src2_idx), d_dst_depth(dst_depth),
+          d_src2_depth(src2_depth)
+    {
+    } // DivTask
+
+    void operator()(const Pointer<Patch<NDIM> >& patch) const
+    {
+        Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(d_dst_idx);
+        Pointer<Src1Data> src1_data = patch->getPatchData(d_src1_idx);
+        Pointer<CellData<NDIM, double> > src2_data =
+            get_optional_patch_data<CellData<NDIM, double> >(patch, d_src2_idx);
+        d_patch_math_ops.div(
+            dst_data, d_alpha, src1_data, d_beta, src2_data, patch, d_dst_depth, d_src2_depth);
+        return;
+    } // operator()
+
+private:
+    const PatchMathOps& d_patch_math_ops;
+    const int d_dst_idx;
+    const double d_alpha;
+    const int d_src1_idx;
+    const double d_beta;
+    const int d_src2_idx;
+    const int d_dst_depth, d_src2_depth;
+};
+
+// Computes dst = alpha grad src1_l + beta src2.
+template <class DstData>
+class GradTask
+{
+public:
+    GradTask(const PatchMathOps& patch_math_ops,
+             const int dst_idx,
+             const double alpha,
+             const int src1_idx,
+             const double beta,
+             const int src2_idx,
+             const int src1_depth)
+        : d_patch_math_ops(patch_math_ops), d_dst_idx(dst_idx), d_alpha(alpha),
+          d_src1_idx(src1_idx), d_beta(beta), d_src2_idx(src2_idx), d_src1_depth(src1_depth)
+    {
+    } // GradTask
+
+    void operator()(const Pointer<Patch<NDIM> >& patch) const
+    {
+        Pointer<DstData> dst_data = patch->getPatchData(d_dst_idx);
+        Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(d_src1_idx);
+        Pointer<DstData> src2_data = get_optional_patch_data<DstData>(patch, d_src2_idx);
+        d_patch_math_ops.grad(
+            dst_data, d_alpha, src1_data, d_beta, src2_data, patch, d_src1_depth);
+        return;
+    } // operator()
+
+private:
+    const PatchMathOps& d_patch_math_ops;
+    const int d_dst_idx;
+    const double d_alpha;
+    const int d_src1_idx;
+    const double d_beta;
+    const int d_src2_idx;
+    const int d_src1_depth;
+};
+
+// Computes dst = alpha grad src1_l + beta src2 with variable alpha.  In the
+// case of non-grid aligned anisotropy (i.e., when alpha has depth greater than
+// one), dst is also set to zero on the physical boundary.
+template <class DstData>
+class VCGradTask
+{
+public:
+    VCGradTask(const PatchMathOps& patch_math_ops,
+               const int dst_idx,
+               const int alpha_idx,
+               const int src1_idx,
+               const double beta,
+               const int src2_idx,
+               const int src1_depth)
+        : d_patch_math_ops(patch_math_ops), d_dst_idx(dst_idx), d_alpha_idx(alpha_idx),
+          d_src1_idx(src1_idx), d_beta(beta), d_src2_idx(src2_idx), d_src1_depth(src1_depth)
+    {
+    } // VCGradTask
+
+    void operator()(const Pointer<Patch<NDIM> >& patch) const
+    {
+        Pointer<DstData> dst_data = patch->getPatchData(d_dst_idx);
+        Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(d_src1_idx);
+        Pointer<DstData> src2_data = get_optional_patch_data<DstData>(patch, d_src2_idx);
+        Pointer<DstData> alpha_data = patch->getPatchData(d_alpha_idx);
+        d_patch_math_ops.grad(
+            dst_data, alpha_data, src1_data, d_beta, src2_data, patch, d_src1_depth);
+
+        // Zero-out data on physical boundaries in the case of non-grid aligned
+        // anisotropy.  (This is equivalent to enforcing no-flux boundary
+        // conditions at the physical boundary.)
+        if (alpha_data->getDepth() > 1)
+        {
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<PatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                static const int gcw = 1;
+                Box<NDIM> boundary_box = Box<NDIM>::grow(patch_box, gcw);
+                const unsigned int axis_lower = patch_box.lower()[axis];
+                const unsigned int axis_upper = patch_box.upper()[axis];
+                for (int upperlower = 0; upperlower <= 1; ++upperlower)
+                {
+                    if (pgeom->getTouchesRegularBoundary(axis, upperlower))
+                    {
+#if !defined(NDEBUG)
+                        TBOX_ASSERT(!pgeom->getTouchesPeriodicBoundary(axis, upperlower));
+#endif
+                        if (upperlower == 0)
+                        {
+                            boundary_box.lower()[axis] = axis_lower - gcw;
+                            boundary_box.upper()[axis] = axis_lower - 1;
+                        }
+                        else
+                        {
+                            boundary_box.lower()[axis] = axis_upper + 1;
+                            boundary_box.upper()[axis] = axis_upper + gcw;
+                        }
+                        dst_data->fill(0.0, boundary_box);
+                    }
+                }
+            }
+        }
+        return;
+    } // operator()
+
+private:
+    const PatchMathOps& d_patch_math_ops;
+    const int d_dst_idx;
+    const int d_alpha_idx;
+    const int d_src1_idx;
+    const double d_beta;
+    const int d_src2_idx;
+    const int d_src1_depth;
+};
+
+// Computes dst_l = alpha L src1_m + beta src1_m + gamma src2_n.
+template <class Data>
+class LaplaceTask
+{
+public:
+    LaplaceTask(const PatchMathOps& patch_math_ops,
+                const int dst_idx,
+                const double alpha,
+                const double beta,
+                const int src1_idx,
+                const double gamma,
+                const int src2_idx,
+                const int dst_depth,
+                const int src1_depth,
+                const int src2_depth)
+        : d_patch_math_ops(patch_math_ops), d_dst_idx(dst_idx), d_alpha(alpha), d_beta(beta),
+          d_src1_idx(src1_idx), d_gamma(gamma), d_src2_idx(src2_idx), d_dst_depth(dst_depth),
+          d_src1_depth(src1_depth), d_src2_depth(src2_depth)
+    {
+    } // LaplaceTask
+
+    void operator()(const Pointer<Patch<NDIM> >& patch) const
+    {
+        Pointer<Data> dst_data = patch->getPatchData(d_dst_idx);
+        Pointer<Data> src1_data = patch->getPatchData(d_src1_idx);
+        Pointer<Data> src2_data = get_optional_patch_data<Data>(patch, d_src2_idx);
+        d_patch_math_ops.laplace(dst_data,
+                                 d_alpha,
+                                 d_beta,
+                                 src1_data,
+                                 d_gamma,
+                                 src2_data,
+                                 patch,
+                                 d_dst_depth,
+                                 d_src1_depth,
+                                 d_src2_depth);
+        return;
+    } // operator()
+
+private:
+    const PatchMathOps& d_patch_math_ops;
+    const int d_dst_idx;
+    const double d_alpha, d_beta;
+    const int d_src1_idx;
+    const double d_gamma;
+    const int d_src2_idx;
+    const int d_dst_depth, d_src1_depth, d_src2_depth;
+};
+
+// Computes dst = alpha div coef ((grad src1) + (grad src1)^T) + beta src1 +
+// gamma src2.
+class VCLaplaceTask
+{
+public:
+    VCLaplaceTask(const PatchMathOps& patch_math_ops,
+                  const int dst_idx,
+                  const double alpha,
+                  const double beta,
+                  const int coef_idx,
+                  const int src1_idx,
+                  const double gamma,
+                  const int src2_idx)
+        : d_patch_math_ops(patch_math_ops), d_dst_idx(dst_idx), d_alpha(alpha), d_beta(beta),
+          d_coef_idx(coef_idx), d_src1_idx(src1_idx), d_gamma(gamma), d_src2_idx(src2_idx)
+    {
+    } // VCLaplaceTask
+
+    void operator()(const Pointer<Patch<NDIM> >& patch) const
+    {
+        Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(d_dst_idx);
+        Pointer<NodeData<NDIM, double> > coef_data = patch->getPatchData(d_coef_idx);
+        Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(d_src1_idx);
+        Pointer<SideData<NDIM, double> > src2_data =
+            get_optional_patch_data<SideData<NDIM, double> >(patch, d_src2_idx);
+        d_patch_math_ops.vc_laplace(
+            dst_data, d_alpha, d_beta, coef_data, src1_data, d_gamma, src2_data, patch);
+        return;
+    } // operator()
+
+private:
+    const PatchMathOps& d_patch_math_ops;
+    const int d_dst_idx;
+    const double d_alpha, d_beta;
+    const int d_coef_idx, d_src1_idx;
+    const double d_gamma;
+    const int d_src2_idx;
+};
+
+// Computes dst_i = alpha_l src1_j + beta_m src2_k, pointwise, in which alpha
+// and beta are either constants or patch data.  The constructors mirror the
+// corresponding PatchMathOps::pointwiseMultiply() overloads.
+template <class Data>
+class PointwiseMultiplyTask
+{
+public:
+    PointwiseMultiplyTask(const PatchMathOps& patch_math_ops,
+                          const int dst_idx,
+                          const double alpha,
+                          const int src1_idx,
+                          const double beta,
+                          const int src2_idx,
+                          const int dst_depth,
+                          const int src1_depth,
+                          const int src2_depth)
+        : d_patch_math_ops(patch_math_ops), d_dst_idx(dst_idx), d_alpha(alpha),
+          d_alpha_idx(-1), d_src1_idx(src1_idx), d_beta(beta), d_beta_idx(-1),
+          d_src2_idx(src2_idx), d_dst_depth(dst_depth), d_src1_depth(src1_depth),
+          d_src2_depth(src2_depth), d_alpha_depth(0), d_beta_depth(0)
+    {
+    } // PointwiseMultiplyTask
+
+    PointwiseMultiplyTask(const PatchMathOps& patch_math_ops,
+                          const int dst_idx,
+                          const int alpha_idx,
+                          const int src1_idx,
+                          const double beta,
+                          const int src2_idx,
+                          const int dst_depth,
+                          const int src1_depth,
+                          const int src2_depth,
+                          const int alpha_depth)
+        : d_patch_math_ops(patch_math_ops), d_dst_idx(dst_idx), d_alpha(0.0),
+          d_alpha_idx(alpha_idx), d_src1_idx(src1_idx), d_beta(beta), d_beta_idx(-1),
+          d_src2_idx(src2_idx), d_dst_depth(dst_depth), d_src1_depth(src1_depth),
+          d_src2_depth(src2_depth), d_alpha_depth(alpha_depth), d_beta_depth(0)
+    {
+#if !defined(NDEBUG)
+        TBOX_ASSERT(d_alpha_idx >= 0);
+#endif
+    } // PointwiseMultiplyTask
+
+    PointwiseMultiplyTask(const PatchMathOps& patch_math_ops,
+                          const int dst_idx,
+                          const int alpha_idx,
+                          const int src1_idx,
+                          const int beta_idx,
+                          const int src2_idx,
+                          const int dst_depth,
+                          const int src1_depth,
+                          const int src2_depth,
+                          const int alpha_depth,
+                          const int beta_depth)
+        : d_patch_math_ops(patch_math_ops), d_dst_idx(dst_idx), d_alpha(0.0),
+          d_alpha_idx(alpha_idx), d_src1_idx(src1_idx), d_beta(0.0), d_beta_idx(beta_idx),
+          d_src2_idx(src2_idx), d_dst_depth(dst_depth), d_src1_depth(src1_depth),
+          d_src2_depth(src2_depth), d_alpha_depth(alpha_depth), d_beta_depth(beta_depth)
+    {
+#if !defined(NDEBUG)
+        TBOX_ASSERT(d_alpha_idx >= 0);
+        TBOX_ASSERT(d_beta_idx >= 0);
+#endif
+    } // PointwiseMultiplyTask
+
+    void operator()(const Pointer<Patch<NDIM> >& patch) const
+    {
+        Pointer<Data> dst_data = patch->getPatchData(d_dst_idx);
+        Pointer<Data> src1_data = patch->getPatchData(d_src1_idx);
+        Pointer<Data> src2_data = get_optional_patch_data<Data>(patch, d_src2_idx);
+        if (d_alpha_idx < 0)
+        {
+            d_patch_math_ops.pointwiseMultiply(dst_data,
+                                               d_alpha,
+                                               src1_data,
+                                               d_beta,
+                                               src2_data,
+                                               patch,
+                                               d_dst_depth,
+                                               d_src1_depth,
+                                               d_src2_depth);
+            return;
+        }
+
+        Pointer<Data> alpha_data = patch->getPatchData(d_alpha_idx);
+        if (d_beta_idx < 0)
+        {
+            d_patch_math_ops.pointwiseMultiply(dst_data,
+                                               alpha_data,
+                                               src1_data,
+                                               d_beta,
+                                               src2_data,
+                                               patch,
+                                               d_dst_depth,
+                                               d_src1_depth,
+                                               d_src2_depth,
+                                               d_alpha_depth);
+            return;
+        }
+
+        Pointer<Data> beta_data = patch->getPatchData(d_beta_idx);
+        d_patch_math_ops.pointwiseMultiply(dst_data,
+                                           alpha_data,
+                                           src1_data,
+                                           beta_data,
+                                           src2_data,
+                                           patch,
+                                           d_dst_depth,
+                                           d_src1_depth,
+                                           d_src2_depth,
+                                           d_alpha_depth,
+                                           d_beta_depth);
+        return;
+    } // operator()
+
+private:
+    const PatchMathOps& d_patch_math_ops;
+    const int d_dst_idx;
+    const double d_alpha;
+    const int d_alpha_idx;
+    const int d_src1_idx;
+    const double d_beta;
+    const int d_beta_idx;
+    const int d_src2_idx;
+    const int d_dst_depth, d_src1_depth, d_src2_depth, d_alpha_depth, d_beta_depth;
+};
+
+// Copies data to the outerface or outerside data used to synchronize the
+// coarse-fine interface.
+template <class OuterData>
+class OuterDataCopyTask
+{
+public:
+    OuterDataCopyTask(const int outer_idx, const int data_idx)
+        : d_outer_idx(outer_idx), d_data_idx(data_idx)
+    {
+    } // OuterDataCopyTask
+
+    void operator()(const Pointer<Patch<NDIM> >& patch) const
+    {
+        Pointer<OuterData> outer_data = patch->getPatchData(d_outer_idx);
+        outer_data->copy(*patch->getPatchData(d_data_idx));
+        return;
+    } // operator()
+
+private:
+    const int d_outer_idx, d_data_idx;
+};
+
+// Accumulates the contribution of the side-centered gradient of component axis of
+// a cell-centered field to the cell-centered curl of that field.
+class SideToCellCurlTask
+{
+public:
+    SideToCellCurlTask(const int dst_idx, const int sc_idx, const unsigned int axis)
+        : d_dst_idx(dst_idx), d_sc_idx(sc_idx), d_axis(axis)
+    {
+    } // SideToCellCurlTask
+
+    void operator()(const Pointer<Patch<NDIM> >& patch) const
+    {
+        Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(d_dst_idx);
+        Pointer<SideData<NDIM, double> > sc_data = patch->getPatchData(d_sc_idx);
+#if (NDIM == 2)
+        double* const W = dst_data->getPointer(0);
+        const int W_ghosts = (dst_data->getGhostCellWidth()).max();
+
+        const double* const g0 = sc_data->getPointer(0);
+        const double* const g1 = sc_data->getPointer(1);
+        const int g_ghosts = (sc_data->getGhostCellWidth()).max();
+
+        const Box<NDIM>& patch_box = patch->getBox();
+
+        const int direction = (d_axis == 0) ? 1 : 0;
+        const double alpha = (d_axis == 0) ? -1.0 : 1.0;
+        const double beta = (d_axis == 0) ? 0.0 : 1.0;
+
+        S_TO_C_INTERP_SPECIAL_FC(direction,
+                                 W,
+                                 W_ghosts,
+                                 alpha,
+                                 g0,
+                                 g1,
+                                 g_ghosts,
+                                 beta,
+                                 W,
+                                 W_ghosts,
+                                 patch_box.lower(0),
+                                 patch_box.upper(0),
+                                 patch_box.lower(1),
+                                 patch_box.upper(1));
+#endif
+#if (NDIM == 3)
+        const int W_ghosts = (dst_data->getGhostCellWidth()).max();
+
+        const double* const g0 = sc_data->getPointer(0);
+        const double* const g1 = sc_data->getPointer(1);
+        const double* const g2 = sc_data->getPointer(2);
+        const int g_ghosts = (sc_data->getGhostCellWidth()).max();
+
+        const Box<NDIM>& patch_box = patch->getBox();
+
+        int dst_depth, direction;
+        static const double alpha0 = 1.0;
+        static const double beta = 1.0;
+
+        if (d_axis == 0)
+        {
+            dst_depth = 1;
+            direction = 2;
+        }
+        else if (d_axis == 1)
+        {
+            dst_depth = 2;
+            direction = 0;
+        }
+        else // (d_axis == 2)
+        {
+            dst_depth = 0;
+            direction = 1;
+        }
+
+        S_TO_C_INTERP_SPECIAL_FC(direction,
+                                 dst_data->getPointer(dst_depth),
+                                 W_ghosts,
+                                 alpha0,
+                                 g0,
+                                 g1,
+                                 g2,
+                                 g_ghosts,
+                                 beta,
+                                 dst_data->getPointer(dst_depth),
+                                 W_ghosts,
+                                 patch_box.lower(0),
+                                 patch_box.upper(0),
+                                 patch_box.lower(1),
+                                 patch_box.upper(1),
+                                 patch_box.lower(2),
+                                 patch_box.upper(2));
+
+        static const double alpha1 = -1.0;
+
+        if (d_axis == 0)
+        {
+            dst_depth = 2;
+            direction = 1;
+        }
+        else if (d_axis == 1)
+        {
+            dst_depth = 0;
+            direction = 2;
+        }
+        else // (d_axis == 2)
+        {
+            dst_depth = 1;
+            direction = 0;
+        }
+
+        S_TO_C_INTERP_SPECIAL_FC(direction,
+                                 dst_data->getPointer(dst_depth),
+                                 W_ghosts,
+                                 alpha1,
+                                 g0,
+                                 g1,
+                                 g2,
+                                 g_ghosts,
+                                 beta,
+                                 dst_data->getPointer(dst_depth),
+                                 W_ghosts,
+                                 patch_box.lower(0),
+                                 patch_box.upper(0),
+                                 patch_box.lower(1),
+                                 patch_box.upper(1),
+                                 patch_box.lower(2),
+                                 patch_box.upper(2));
+#endif
+        return;
+    } // operator()
+
+private:
+    const int d_dst_idx, d_sc_idx;
+    const unsigned int d_axis;
+};
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 HierarchyMathOps::HierarchyMathOps(const std::string& name,
@@ -610,15 +1210,9 @@ void HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
-
-            d_patch_math_ops.curl(dst_data, src_data, patch);
-        }
+        const UnaryOpTask<CellData<NDIM, double>, CellData<NDIM, double> > curl_task(
+            d_patch_math_ops, &PatchMathOps::curl, dst_idx, src_idx);
+        PatchTaskExecutor::execute(curl_task, level);
     }
     else
     {
@@ -648,126 +1242,8 @@ void HierarchyMathOps::curl(const int dst_idx,
             {
                 Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-                for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-                {
-                    Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-                    Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-                    Pointer<SideData<NDIM, double> > sc_data = patch->getPatchData(d_sc_idx);
-#if (NDIM == 2)
-                    double* const W = dst_data->getPointer(0);
-                    const int W_ghosts = (dst_data->getGhostCellWidth()).max();
-
-                    const double* const g0 = sc_data->getPointer(0);
-                    const double* const g1 = sc_data->getPointer(1);
-                    const int g_ghosts = (sc_data->getGhostCellWidth()).max();
-
-                    const Box<NDIM>& patch_box = patch->getBox();
-
-                    const int direction = (d == 0) ? 1 : 0;
-                    const double alpha = (d == 0) ? -1.0 : 1.0;
-                    const double beta = (d == 0) ? 0.0 : 1.0;
-
-                    S_TO_C_INTERP_SPECIAL_FC(direction,
-                                             W,
-                                             W_ghosts,
-                                             alpha,
-                                             g0,
-                                             g1,
-                                             g_ghosts,
-                                             beta,
-                                             W,
-                                             W_ghosts,
-                                             patch_box.lower(0),
-                                             patch_box.upper(0),
-                                             patch_box.lower(1),
-                                             patch_box.upper(1));
-#endif
-#if (NDIM == 3)
-                    const int W_ghosts = (dst_data->getGhostCellWidth()).max();
-
-                    const double* const g0 = sc_data->getPointer(0);
-                    const double* const g1 = sc_data->getPointer(1);
-                    const double* const g2 = sc_data->getPointer(2);
-                    const int g_ghosts = (sc_data->getGhostCellWidth()).max();
-
-                    const Box<NDIM>& patch_box = patch->getBox();
-
-                    int dst_depth, direction;
-                    static const double alpha0 = 1.0;
-                    static const double beta = 1.0;
-
-                    if (d == 0)
-                    {
-                        dst_depth = 1;
-                        direction = 2;
-                    }
-                    else if (d == 1)
-                    {
-                        dst_depth = 2;
-                        direction = 0;
-                    }
-                    else // (d == 2)
-                    {
-                        dst_depth = 0;
-                        direction = 1;
-                    }
-
-                    S_TO_C_INTERP_SPECIAL_FC(direction,
-                                             dst_data->getPointer(dst_depth),
-                                             W_ghosts,
-                                             alpha0,
-                                             g0,
-                                             g1,
-                                             g2,
-                                             g_ghosts,
-                                             beta,
-                                             dst_data->getPointer(dst_depth),
-                                             W_ghosts,
-                                             patch_box.lower(0),
-                                             patch_box.upper(0),
-                                             patch_box.lower(1),
-                                             patch_box.upper(1),
-                                             patch_box.lower(2),
-                                             patch_box.upper(2));
-
-                    static const double alpha1 = -1.0;
-
-                    if (d == 0)
-                    {
-                        dst_depth = 2;
-                        direction = 1;
-                    }
-                    else if (d == 1)
-                    {
-                        dst_depth = 0;
-                        direction = 2;
-                    }
-                    else // (d == 2)
-                    {
-                        dst_depth = 1;
-                        direction = 0;
-                    }
-
-                    S_TO_C_INTERP_SPECIAL_FC(direction,
-                                             dst_data->getPointer(dst_depth),
-                                             W_ghosts,
-                                             alpha1,
-                                             g0,
-                                             g1,
-                                             g2,
-                                             g_ghosts,
-                                             beta,
-                                             dst_data->getPointer(dst_depth),
-                                             W_ghosts,
-                                             patch_box.lower(0),
-                                             patch_box.upper(0),
-                                             patch_box.lower(1),
-                                             patch_box.upper(1),
-                                             patch_box.lower(2),
-                                             patch_box.upper(2));
-#endif
-                }
+                const SideToCellCurlTask curl_task(dst_idx, d_sc_idx, d);
+                PatchTaskExecutor::execute(curl_task, level);
             }
         }
 
@@ -793,15 +1269,9 @@ void HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<FaceData<NDIM, double> > src_data = patch->getPatchData(src_idx);
-
-            d_patch_math_ops.curl(dst_data, src_data, patch);
-        }
+        const UnaryOpTask<CellData<NDIM, double>, FaceData<NDIM, double> > curl_task(
+            d_patch_math_ops, &PatchMathOps::curl, dst_idx, src_idx);
+        PatchTaskExecutor::execute(curl_task, level);
     }
     return;
 } // curl
@@ -820,15 +1290,9 @@ void HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<FaceData<NDIM, double> > src_data = patch->getPatchData(src_idx);
-
-            d_patch_math_ops.curl(dst_data, src_data, patch);
-        }
+        const UnaryOpTask<FaceData<NDIM, double>, FaceData<NDIM, double> > curl_task(
+            d_patch_math_ops, &PatchMathOps::curl, dst_idx, src_idx);
+        PatchTaskExecutor::execute(curl_task, level);
     }
     return;
 } // curl
@@ -847,15 +1311,9 @@ void HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
-
-            d_patch_math_ops.curl(dst_data, src_data, patch);
-        }
+        const UnaryOpTask<CellData<NDIM, double>, SideData<NDIM, double> > curl_task(
+            d_patch_math_ops, &PatchMathOps::curl, dst_idx, src_idx);
+        PatchTaskExecutor::execute(curl_task, level);
     }
     return;
 } // curl
@@ -874,15 +1332,9 @@ void HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
-
-            d_patch_math_ops.curl(dst_data, src_data, patch);
-        }
+        const UnaryOpTask<SideData<NDIM, double>, SideData<NDIM, double> > curl_task(
+            d_patch_math_ops, &PatchMathOps::curl, dst_idx, src_idx);
+        PatchTaskExecutor::execute(curl_task, level);
     }
     return;
 } // curl
@@ -909,15 +1361,9 @@ void HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
-
-            d_patch_math_ops.curl(dst_data, src_data, patch);
-        }
+        const UnaryOpTask<NodeData<NDIM, double>, SideData<NDIM, double> > curl_task(
+            d_patch_math_ops, &PatchMathOps::curl, dst_idx, src_idx);
+        PatchTaskExecutor::execute(curl_task, level);
     }
     return;
 } // curl
@@ -944,15 +1390,9 @@ void HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<EdgeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
-
-            d_patch_math_ops.curl(dst_data, src_data, patch);
-        }
+        const UnaryOpTask<EdgeData<NDIM, double>, SideData<NDIM, double> > curl_task(
+            d_patch_math_ops, &PatchMathOps::curl, dst_idx, src_idx);
+        PatchTaskExecutor::execute(curl_task, level);
     }
     return;
 } // curl
@@ -980,15 +1420,9 @@ void HierarchyMathOps::rot(int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete rot.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<NodeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
-
-            d_patch_math_ops.rot(dst_data, src_data, patch);
-        }
+        const UnaryOpTask<SideData<NDIM, double>, NodeData<NDIM, double> > rot_task(
+            d_patch_math_ops, &PatchMathOps::rot, dst_idx, src_idx);
+        PatchTaskExecutor::execute(rot_task, level);
     }
     return;
 } // rot
@@ -1016,15 +1450,9 @@ void HierarchyMathOps::rot(int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete rot.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
-
-            d_patch_math_ops.rot(dst_data, src_data, patch);
-        }
+        const UnaryOpTask<SideData<NDIM, double>, CellData<NDIM, double> > rot_task(
+            d_patch_math_ops, &PatchMathOps::rot, dst_idx, src_idx);
+        PatchTaskExecutor::execute(rot_task, level);
     }
     return;
 } // rot
@@ -1052,15 +1480,9 @@ void HierarchyMathOps::rot(int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete rot.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<EdgeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
-
-            d_patch_math_ops.rot(dst_data, src_data, patch);
-        }
+        const UnaryOpTask<SideData<NDIM, double>, EdgeData<NDIM, double> > rot_task(
+            d_patch_math_ops, &PatchMathOps::rot, dst_idx, src_idx);
+        PatchTaskExecutor::execute(rot_task, level);
     }
     return;
 } // rot
@@ -1088,15 +1510,9 @@ void HierarchyMathOps::rot(int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete rot.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
-
-            d_patch_math_ops.rot(dst_data, src_data, patch);
-        }
+        const UnaryOpTask<SideData<NDIM, double>, SideData<NDIM, double> > rot_task(
+            d_patch_math_ops, &PatchMathOps::rot, dst_idx, src_idx);
+        PatchTaskExecutor::execute(rot_task, level);
     }
     return;
 } // rot
@@ -1122,18 +1538,9 @@ void HierarchyMathOps::div(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete divergence.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
-            Pointer<CellData<NDIM, double> > src2_data =
-                (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
-
-            d_patch_math_ops.div(
-                dst_data, alpha, src1_data, beta, src2_data, patch, dst_depth, src2_depth);
-        }
+        const DivTask<CellData<NDIM, double> > div_task(
+            d_patch_math_ops, dst_idx, alpha, src1_idx, beta, src2_idx, dst_depth, src2_depth);
+        PatchTaskExecutor::execute(div_task, level);
     }
     else
     {
@@ -1200,31 +1607,18 @@ void HierarchyMathOps::div(const int dst_idx,
             level->allocatePatchData(d_of_idx);
         }
 
-        // Compute the discrete divergence and extract data on the coarse-fine
-        // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<FaceData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
-            Pointer<CellData<NDIM, double> > src2_data =
-                (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
-
-            d_patch_math_ops.div(
-                dst_data, alpha, src1_data, beta, src2_data, patch, dst_depth, src2_depth);
-
-            if ((ln > d_coarsest_ln) && src1_cf_bdry_synch)
-            {
-                Pointer<OuterfaceData<NDIM, double> > of_data = patch->getPatchData(d_of_idx);
-                of_data->copy(*src1_data);
-            }
-        }
+        // Compute the discrete divergence.
+        const DivTask<FaceData<NDIM, double> > div_task(
+            d_patch_math_ops, dst_idx, alpha, src1_idx, beta, src2_idx, dst_depth, src2_depth);
+        PatchTaskExecutor::execute(div_task, level);
 
         // Synchronize the coarse-fine interface of src1 and deallocate
         // temporary data.
         if ((ln > d_coarsest_ln) && src1_cf_bdry_synch)
         {
+            const OuterDataCopyTask<OuterfaceData<NDIM, double> > of_copy_task(
+                d_of_idx, src1_idx);
+            PatchTaskExecutor::execute(of_copy_task, level);
             xeqScheduleOuterfaceRestriction(src1_idx, d_of_idx, ln - 1);
             level->deallocatePatchData(d_of_idx);
         }
@@ -1258,31 +1652,18 @@ void HierarchyMathOps::div(const int dst_idx,
             level->allocatePatchData(d_os_idx);
         }
 
-        // Compute the discrete divergence and extract data on the coarse-fine
-        // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
-            Pointer<CellData<NDIM, double> > src2_data =
-                (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
-
-            d_patch_math_ops.div(
-                dst_data, alpha, src1_data, beta, src2_data, patch, dst_depth, src2_depth);
-
-            if ((ln > d_coarsest_ln) && src1_cf_bdry_synch)
-            {
-                Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
-                os_data->copy(*src1_data);
-            }
-        }
+        // Compute the discrete divergence.
+        const DivTask<SideData<NDIM, double> > div_task(
+            d_patch_math_ops, dst_idx, alpha, src1_idx, beta, src2_idx, dst_depth, src2_depth);
+        PatchTaskExecutor::execute(div_task, level);
 
         // Synchronize the coarse-fine interface of src1 and deallocate
         // temporary data.
         if ((ln > d_coarsest_ln) && src1_cf_bdry_synch)
         {
+            const OuterDataCopyTask<OutersideData<NDIM, double> > os_copy_task(
+                d_os_idx, src1_idx);
+            PatchTaskExecutor::execute(os_copy_task, level);
             xeqScheduleOutersideRestriction(src1_idx, d_os_idx, ln - 1);
             level->deallocatePatchData(d_os_idx);
         }
@@ -1310,18 +1691,9 @@ void HierarchyMathOps::grad(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete gradient.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
-            Pointer<CellData<NDIM, double> > src2_data =
-                (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
-
-            d_patch_math_ops.grad(
-                dst_data, alpha, src1_data, beta, src2_data, patch, src1_depth);
-        }
+        const GradTask<CellData<NDIM, double> > grad_task(
+            d_patch_math_ops, dst_idx, alpha, src1_idx, beta, src2_idx, src1_depth);
+        PatchTaskExecutor::execute(grad_task, level);
     }
     else
     {
@@ -1421,25 +1793,17 @@ void HierarchyMathOps::grad(const int dst_idx,
             level->allocatePatchData(d_of_idx);
         }
 
-        // Compute the discrete gradient and extract data on the coarse-fine
-        // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
-            Pointer<FaceData<NDIM, double> > src2_data =
-                (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
-
-            d_patch_math_ops.grad(
-                dst_data, alpha, src1_data, beta, src2_data, patch, src1_depth);
+        // Compute the discrete gradient.
+        const GradTask<FaceData<NDIM, double> > grad_task(
+            d_patch_math_ops, dst_idx, alpha, src1_idx, beta, src2_idx, src1_depth);
+        PatchTaskExecutor::execute(grad_task, level);
 
-            if ((ln > d_coarsest_ln) && dst_cf_bdry_synch)
-            {
-                Pointer<OuterfaceData<NDIM, double> > of_data = patch->getPatchData(d_of_idx);
-                of_data->copy(*dst_data);
-            }
+        // Extract data on the coarse-fine interface.
+        if ((ln > d_coarsest_ln) && dst_cf_bdry_synch)
+        {
+            const OuterDataCopyTask<OuterfaceData<NDIM, double> > of_copy_task(
+                d_of_idx, dst_idx);
+            PatchTaskExecutor::execute(of_copy_task, level);
         }
     }
 
@@ -1480,25 +1844,17 @@ void HierarchyMathOps::grad(const int dst_idx,
             level->allocatePatchData(d_os_idx);
         }
 
-        // Compute the discrete gradient and extract data on the coarse-fine
-        // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
-            Pointer<SideData<NDIM, double> > src2_data =
-                (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
-
-            d_patch_math_ops.grad(
-                dst_data, alpha, src1_data, beta, src2_data, patch, src1_depth);
+        // Compute the discrete gradient.
+        const GradTask<SideData<NDIM, double> > grad_task(
+            d_patch_math_ops, dst_idx, alpha, src1_idx, beta, src2_idx, src1_depth);
+        PatchTaskExecutor::execute(grad_task, level);
 
-            if ((ln > d_coarsest_ln) && dst_cf_bdry_synch)
-            {
-                Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
-                os_data->copy(*dst_data);
-            }
+        // Extract data on the coarse-fine interface.
+        if ((ln > d_coarsest_ln) && dst_cf_bdry_synch)
+        {
+            const OuterDataCopyTask<OutersideData<NDIM, double> > os_copy_task(
+                d_os_idx, dst_idx);
+            PatchTaskExecutor::execute(os_copy_task, level);
         }
     }
 
@@ -1712,64 +2068,19 @@ void HierarchyMathOps::grad(const int dst_idx,
             level->allocatePatchData(d_of_idx);
         }
 
-        // Compute the discrete gradient and extract data on the coarse-fine
-        // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
-            Pointer<FaceData<NDIM, double> > src2_data =
-                (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
-            Pointer<FaceData<NDIM, double> > alpha_data = patch->getPatchData(alpha_idx);
+        // Compute the discrete gradient.
+        const VCGradTask<FaceData<NDIM, double> > grad_task(
+            d_patch_math_ops, dst_idx, alpha_idx, src1_idx, beta, src2_idx, src1_depth);
+        PatchTaskExecutor::execute(grad_task, level);
 
-            d_patch_math_ops.grad(
-                dst_data, alpha_data, src1_data, beta, src2_data, patch, src1_depth);
-
-            // Zero-out data on physical boundaries in the case of non-grid
-            // aligned anisotropy.  (This is equivalent to enforcing no-flux
-            // boundary conditions at the physical boundary.)
-            if (alpha_data->getDepth() > 1)
-            {
-                const Box<NDIM>& patch_box = patch->getBox();
-                Pointer<PatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-                for (unsigned int axis = 0; axis < NDIM; ++axis)
-                {
-                    static const int gcw = 1;
-                    Box<NDIM> boundary_box = Box<NDIM>::grow(patch_box, gcw);
-                    const unsigned int axis_lower = patch_box.lower()[axis];
-                    const unsigned int axis_upper = patch_box.upper()[axis];
-                    for (int upperlower = 0; upperlower <= 1; ++upperlower)
-                    {
-                        if (pgeom->getTouchesRegularBoundary(axis, upperlower))
-                        {
-#if !defined(NDEBUG)
-                            TBOX_ASSERT(!pgeom->getTouchesPeriodicBoundary(axis, upperlower));
-#endif
-                            if (upperlower == 0)
-                            {
-                                boundary_box.lower()[axis] = axis_lower - gcw;
-                                boundary_box.upper()[axis] = axis_lower - 1;
-                            }
-                            else
-                            {
-                                boundary_box.lower()[axis] = axis_upper + 1;
-                                boundary_box.upper()[axis] = axis_upper + gcw;
-                            }
-                            dst_data->fill(0.0, boundary_box);
-                        }
-                    }
-                }
-            }
-
-            if ((ln > d_coarsest_ln) && dst_cf_bdry_synch)
-            {
-                Pointer<OuterfaceData<NDIM, double> > of_data = patch->getPatchData(d_of_idx);
-                of_data->copy(*dst_data);
-            }
-        }
-    }
+        // Extract data on the coarse-fine interface.
+        if ((ln > d_coarsest_ln) && dst_cf_bdry_synch)
+        {
+            const OuterDataCopyTask<OuterfaceData<NDIM, double> > of_copy_task(
+                d_of_idx, dst_idx);
+            PatchTaskExecutor::execute(of_copy_task, level);
+        }
+    }
 
     // Synchronize the coarse-fine interface and deallocate temporary data.
     if (dst_cf_bdry_synch)
@@ -1809,62 +2120,17 @@ void HierarchyMathOps::grad(const int dst_idx,
             level->allocatePatchData(d_os_idx);
         }
 
-        // Compute the discrete gradient and extract data on the coarse-fine
-        // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
-            Pointer<SideData<NDIM, double> > src2_data =
-                (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
-            Pointer<SideData<NDIM, double> > alpha_data = patch->getPatchData(alpha_idx);
-
-            d_patch_math_ops.grad(
-                dst_data, alpha_data, src1_data, beta, src2_data, patch, src1_depth);
-
-            // Zero-out data on physical boundaries in the case of non-grid
-            // aligned anisotropy.  (This is equivalent to enforcing no-flux
-            // boundary conditions at the physical boundary.)
-            if (alpha_data->getDepth() > 1)
-            {
-                const Box<NDIM>& patch_box = patch->getBox();
-                Pointer<PatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-                for (unsigned int axis = 0; axis < NDIM; ++axis)
-                {
-                    static const int gcw = 1;
-                    Box<NDIM> boundary_box = Box<NDIM>::grow(patch_box, gcw);
-                    const unsigned int axis_lower = patch_box.lower()[axis];
-                    const unsigned int axis_upper = patch_box.upper()[axis];
-                    for (int upperlower = 0; upperlower <= 1; ++upperlower)
-                    {
-                        if (pgeom->getTouchesRegularBoundary(axis, upperlower))
-                        {
-#if !defined(NDEBUG)
-                            TBOX_ASSERT(!pgeom->getTouchesPeriodicBoundary(axis, upperlower));
-#endif
-                            if (upperlower == 0)
-                            {
-                                boundary_box.lower()[axis] = axis_lower - gcw;
-                                boundary_box.upper()[axis] = axis_lower - 1;
-                            }
-                            else
-                            {
-                                boundary_box.lower()[axis] = axis_upper + 1;
-                                boundary_box.upper()[axis] = axis_upper + gcw;
-                            }
-                            dst_data->fill(0.0, boundary_box);
-                        }
-                    }
-                }
-            }
+        // Compute the discrete gradient.
+        const VCGradTask<SideData<NDIM, double> > grad_task(
+            d_patch_math_ops, dst_idx, alpha_idx, src1_idx, beta, src2_idx, src1_depth);
+        PatchTaskExecutor::execute(grad_task, level);
 
-            if ((ln > d_coarsest_ln) && dst_cf_bdry_synch)
-            {
-                Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
-                os_data->copy(*dst_data);
-            }
+        // Extract data on the coarse-fine interface.
+        if ((ln > d_coarsest_ln) && dst_cf_bdry_synch)
+        {
+            const OuterDataCopyTask<OutersideData<NDIM, double> > os_copy_task(
+                d_os_idx, dst_idx);
+            PatchTaskExecutor::execute(os_copy_task, level);
         }
     }
 
@@ -1900,26 +2166,17 @@ void HierarchyMathOps::interp(const int dst_idx,
             level->allocatePatchData(d_of_idx);
         }
 
-        // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<FaceData<NDIM, double> > src_data = patch->getPatchData(src_idx);
-
-            d_patch_math_ops.interp(dst_data, src_data, patch);
-
-            if ((ln > d_coarsest_ln) && src_cf_bdry_synch)
-            {
-                Pointer<OuterfaceData<NDIM, double> > of_data = patch->getPatchData(d_of_idx);
-                of_data->copy(*src_data);
-            }
-        }
+        // Interpolate.
+        const UnaryOpTask<CellData<NDIM, double>, FaceData<NDIM, double> > interp_task(
+            d_patch_math_ops, &PatchMathOps::interp, dst_idx, src_idx);
+        PatchTaskExecutor::execute(interp_task, level);
 
         // Synchronize the coarse-fine interface and deallocate temporary data.
         if ((ln > d_coarsest_ln) && src_cf_bdry_synch)
         {
+            const OuterDataCopyTask<OuterfaceData<NDIM, double> > of_copy_task(
+                d_of_idx, src_idx);
+            PatchTaskExecutor::execute(of_copy_task, level);
             xeqScheduleOuterfaceRestriction(src_idx, d_of_idx, ln - 1);
             level->deallocatePatchData(d_of_idx);
         }
@@ -1947,26 +2204,17 @@ void HierarchyMathOps::interp(const int dst_idx,
             level->allocatePatchData(d_os_idx);
         }
 
-        // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
-
-            d_patch_math_ops.interp(dst_data, src_data, patch);
-
-            if ((ln > d_coarsest_ln) && src_cf_bdry_synch)
-            {
-                Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
-                os_data->copy(*src_data);
-            }
-        }
+        // Interpolate.
+        const UnaryOpTask<CellData<NDIM, double>, SideData<NDIM, double> > interp_task(
+            d_patch_math_ops, &PatchMathOps::interp, dst_idx, src_idx);
+        PatchTaskExecutor::execute(interp_task, level);
 
         // Synchronize the coarse-fine interface and deallocate temporary data.
         if ((ln > d_coarsest_ln) && src_cf_bdry_synch)
         {
+            const OuterDataCopyTask<OutersideData<NDIM, double> > os_copy_task(
+                d_os_idx, src_idx);
+            PatchTaskExecutor::execute(os_copy_task, level);
             xeqScheduleOutersideRestriction(src_idx, d_os_idx, ln - 1);
             level->deallocatePatchData(d_os_idx);
         }
@@ -1994,21 +2242,17 @@ void HierarchyMathOps::interp(const int dst_idx,
             level->allocatePatchData(d_of_idx);
         }
 
-        // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
+        // Interpolate.
+        const UnaryOpTask<FaceData<NDIM, double>, CellData<NDIM, double> > interp_task(
+            d_patch_math_ops, &PatchMathOps::interp, dst_idx, src_idx);
+        PatchTaskExecutor::execute(interp_task, level);
 
-            d_patch_math_ops.interp(dst_data, src_data, patch);
-
-            if ((ln > d_coarsest_ln) && dst_cf_bdry_synch)
-            {
-                Pointer<OuterfaceData<NDIM, double> > of_data = patch->getPatchData(d_of_idx);
-                of_data->copy(*dst_data);
-            }
+        // Extract data on the coarse-fine interface.
+        if ((ln > d_coarsest_ln) && dst_cf_bdry_synch)
+        {
+            const OuterDataCopyTask<OuterfaceData<NDIM, double> > of_copy_task(
+                d_of_idx, dst_idx);
+            PatchTaskExecutor::execute(of_copy_task, level);
         }
     }
 
@@ -2044,21 +2288,17 @@ void HierarchyMathOps::interp(const int dst_idx,
             level->allocatePatchData(d_os_idx);
         }
 
-        // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
-
-            d_patch_math_ops.interp(dst_data, src_data, patch);
+        // Interpolate.
+        const UnaryOpTask<SideData<NDIM, double>, CellData<NDIM, double> > interp_task(
+            d_patch_math_ops, &PatchMathOps::interp, dst_idx, src_idx);
+        PatchTaskExecutor::execute(interp_task, level);
 
-            if ((ln > d_coarsest_ln) && dst_cf_bdry_synch)
-            {
-                Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
-                os_data->copy(*dst_data);
-            }
+        // Extract data on the coarse-fine interface.
+        if ((ln > d_coarsest_ln) && dst_cf_bdry_synch)
+        {
+            const OuterDataCopyTask<OutersideData<NDIM, double> > os_copy_task(
+                d_os_idx, dst_idx);
+            PatchTaskExecutor::execute(os_copy_task, level);
         }
     }
 
@@ -2137,26 +2377,17 @@ void HierarchyMathOps::laplace(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete Laplacian.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
-            Pointer<CellData<NDIM, double> > src2_data =
-                (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
-
-            d_patch_math_ops.laplace(dst_data,
-                                     alpha,
-                                     beta,
-                                     src1_data,
-                                     gamma,
-                                     src2_data,
-                                     patch,
-                                     dst_depth,
-                                     src1_depth,
-                                     src2_depth);
-        }
+        const LaplaceTask<CellData<NDIM, double> > laplace_task(d_patch_math_ops,
+                                                                dst_idx,
+                                                                alpha,
+                                                                beta,
+                                                                src1_idx,
+                                                                gamma,
+                                                                src2_idx,
+                                                                dst_depth,
+                                                                src1_depth,
+                                                                src2_depth);
+        PatchTaskExecutor::execute(laplace_task, level);
     }
     else
     {
@@ -2386,18 +2617,9 @@ void HierarchyMathOps::laplace(const int dst_idx,
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
-            Pointer<SideData<NDIM, double> > src2_data =
-                (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
-
-            d_patch_math_ops.laplace(
-                dst_data, alpha, beta, src1_data, gamma, src2_data, patch);
-        }
+        const LaplaceTask<SideData<NDIM, double> > laplace_task(
+            d_patch_math_ops, dst_idx, alpha, beta, src1_idx, gamma, src2_idx, 0, 0, 0);
+        PatchTaskExecutor::execute(laplace_task, level);
     }
 
     // Allocate temporary data.
@@ -2413,14 +2635,9 @@ void HierarchyMathOps::laplace(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
-            os_data->copy(*dst_data);
-        }
+            const OuterDataCopyTask<OutersideData<NDIM, double> > os_copy_task(
+                d_os_idx, dst_idx);
+            PatchTaskExecutor::execute(os_copy_task, level);
 
         // Synchronize the coarse-fine interface of dst.
         xeqScheduleOutersideRestriction(dst_idx, d_os_idx, ln - 1);
@@ -2435,6 +2652,110 @@ void HierarchyMathOps::laplace(const int dst_idx,
     return;
 } // laplace
 
+void HierarchyMathOps::laplaceResidual(
+    const int dst_idx,
+    const Pointer<CellVariable<NDIM, double> > dst_var,
+    const int rhs_idx,
+    const Pointer<CellVariable<NDIM, double> > rhs_var,
+    const PoissonSpecifications& poisson_spec,
+    const int src_idx,
+    const Pointer<CellVariable<NDIM, double> > src_var,
+    const Pointer<HierarchyGhostCellInterpolation> src_ghost_fill,
+    const double src_ghost_fill_time,
+    const int dst_depth,
+    const int rhs_depth,
+    const int src_depth)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(dst_idx != src_idx);
+#endif
+    if (has_constant_coefficients(poisson_spec))
+    {
+        // Compute dst = -(C src + div D grad src) + rhs in a single sweep.
+        PoissonSpecifications neg_spec(d_object_name + "::laplaceResidual::neg_spec");
+        negate_constant_coefficients(neg_spec, poisson_spec);
+        laplace(dst_idx,
+                dst_var,
+                neg_spec,
+                src_idx,
+                src_var,
+                src_ghost_fill,
+                src_ghost_fill_time,
+                1.0,
+                rhs_idx,
+                rhs_var,
+                dst_depth,
+                src_depth,
+                rhs_depth);
+    }
+    else
+    {
+        // Compute dst = C src + div D grad src and then dst := rhs - dst.
+        laplace(dst_idx,
+                dst_var,
+                poisson_spec,
+                src_idx,
+                src_var,
+                src_ghost_fill,
+                src_ghost_fill_time,
+                0.0,
+                -1,
+                NULL,
+                dst_depth,
+                src_depth,
+                0);
+        pointwiseMultiply(dst_idx,
+                          dst_var,
+                          -1.0,
+                          dst_idx,
+                          dst_var,
+                          1.0,
+                          rhs_idx,
+                          rhs_var,
+                          dst_depth,
+                          dst_depth,
+                          rhs_depth);
+    }
+    return;
+} // laplaceResidual
+
+void HierarchyMathOps::laplaceResidual(
+    const int dst_idx,
+    const Pointer<SideVariable<NDIM, double> > dst_var,
+    const int rhs_idx,
+    const Pointer<SideVariable<NDIM, double> > rhs_var,
+    const PoissonSpecifications& poisson_spec,
+    const int src_idx,
+    const Pointer<SideVariable<NDIM, double> > src_var,
+    const Pointer<HierarchyGhostCellInterpolation> src_ghost_fill,
+    const double src_ghost_fill_time)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(dst_idx != src_idx);
+#endif
+    if (!has_constant_coefficients(poisson_spec))
+    {
+        TBOX_ERROR("HierarchyMathOps::laplaceResidual():\n"
+                   << "  side-centered residual requires spatially constant scalar-valued "
+                      "coefficients" << std::endl);
+    }
+
+    // Compute dst = -(C src + div D grad src) + rhs in a single sweep.
+    PoissonSpecifications neg_spec(d_object_name + "::laplaceResidual::neg_spec");
+    negate_constant_coefficients(neg_spec, poisson_spec);
+    laplace(dst_idx,
+            dst_var,
+            neg_spec,
+            src_idx,
+            src_var,
+            src_ghost_fill,
+            src_ghost_fill_time,
+            1.0,
+            rhs_idx,
+            rhs_var);
+    return;
+} // laplaceResidual
+
 void
 HierarchyMathOps::vc_laplace(const int dst_idx,
                              const Pointer<SideVariable<NDIM, double> > dst_var,
@@ -2478,19 +2799,9 @@ HierarchyMathOps::vc_laplace(const int dst_idx,
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<NodeData<NDIM, double> > coef_data = patch->getPatchData(coef_idx);
-            Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
-            Pointer<SideData<NDIM, double> > src2_data =
-                (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
-
-            d_patch_math_ops.vc_laplace(
-                dst_data, alpha, beta, coef_data, src1_data, gamma, src2_data, patch);
-        }
+        const VCLaplaceTask vc_laplace_task(
+            d_patch_math_ops, dst_idx, alpha, beta, coef_idx, src1_idx, gamma, src2_idx);
+        PatchTaskExecutor::execute(vc_laplace_task, level);
     }
 
     // Allocate temporary data.
@@ -2506,14 +2817,9 @@ HierarchyMathOps::vc_laplace(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
-            os_data->copy(*dst_data);
-        }
+            const OuterDataCopyTask<OutersideData<NDIM, double> > os_copy_task(
+                d_os_idx, dst_idx);
+            PatchTaskExecutor::execute(os_copy_task, level);
 
         // Synchronize the coarse-fine interface of dst.
         xeqScheduleOutersideRestriction(dst_idx, d_os_idx, ln - 1);
@@ -2545,25 +2851,16 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
-            Pointer<CellData<NDIM, double> > src2_data =
-                (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
-
-            d_patch_math_ops.pointwiseMultiply(dst_data,
-                                               alpha,
-                                               src1_data,
-                                               beta,
-                                               src2_data,
-                                               patch,
-                                               dst_depth,
-                                               src1_depth,
-                                               src2_depth);
-        }
+        const PointwiseMultiplyTask<CellData<NDIM, double> > multiply_task(d_patch_math_ops,
+                                                                           dst_idx,
+                                                                           alpha,
+                                                                           src1_idx,
+                                                                           beta,
+                                                                           src2_idx,
+                                                                           dst_depth,
+                                                                           src1_depth,
+                                                                           src2_depth);
+        PatchTaskExecutor::execute(multiply_task, level);
     }
     return;
 } // pointwiseMultiply
@@ -2587,27 +2884,17 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
-            Pointer<CellData<NDIM, double> > src2_data =
-                (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
-            Pointer<CellData<NDIM, double> > alpha_data = patch->getPatchData(alpha_idx);
-
-            d_patch_math_ops.pointwiseMultiply(dst_data,
-                                               alpha_data,
-                                               src1_data,
-                                               beta,
-                                               src2_data,
-                                               patch,
-                                               dst_depth,
-                                               src1_depth,
-                                               src2_depth,
-                                               alpha_depth);
-        }
+        const PointwiseMultiplyTask<CellData<NDIM, double> > multiply_task(d_patch_math_ops,
+                                                                           dst_idx,
+                                                                           alpha_idx,
+                                                                           src1_idx,
+                                                                           beta,
+                                                                           src2_idx,
+                                                                           dst_depth,
+                                                                           src1_depth,
+                                                                           src2_depth,
+                                                                           alpha_depth);
+        PatchTaskExecutor::execute(multiply_task, level);
     }
     return;
 } // pointwiseMultiply
@@ -2633,29 +2920,18 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
-            Pointer<CellData<NDIM, double> > src2_data =
-                (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
-            Pointer<CellData<NDIM, double> > alpha_data = patch->getPatchData(alpha_idx);
-            Pointer<CellData<NDIM, double> > beta_data = patch->getPatchData(beta_idx);
-
-            d_patch_math_ops.pointwiseMultiply(dst_data,
-                                               alpha_data,
-                                               src1_data,
-                                               beta_data,
-                                               src2_data,
-                                               patch,
-                                               dst_depth,
-                                               src1_depth,
-                                               src2_depth,
-                                               alpha_depth,
-                                               beta_depth);
-        }
+        const PointwiseMultiplyTask<CellData<NDIM, double> > multiply_task(d_patch_math_ops,
+                                                                           dst_idx,
+                                                                           alpha_idx,
+                                                                           src1_idx,
+                                                                           beta_idx,
+                                                                           src2_idx,
+                                                                           dst_depth,
+                                                                           src1_depth,
+                                                                           src2_depth,
+                                                                           alpha_depth,
+                                                                           beta_depth);
+        PatchTaskExecutor::execute(multiply_task, level);
     }
     return;
 } // pointwiseMultiply
@@ -2677,25 +2953,16 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<FaceData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
-            Pointer<FaceData<NDIM, double> > src2_data =
-                (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
-
-            d_patch_math_ops.pointwiseMultiply(dst_data,
-                                               alpha,
-                                               src1_data,
-                                               beta,
-                                               src2_data,
-                                               patch,
-                                               dst_depth,
-                                               src1_depth,
-                                               src2_depth);
-        }
+        const PointwiseMultiplyTask<FaceData<NDIM, double> > multiply_task(d_patch_math_ops,
+                                                                           dst_idx,
+                                                                           alpha,
+                                                                           src1_idx,
+                                                                           beta,
+                                                                           src2_idx,
+                                                                           dst_depth,
+                                                                           src1_depth,
+                                                                           src2_depth);
+        PatchTaskExecutor::execute(multiply_task, level);
     }
     return;
 } // pointwiseMultiply
@@ -2719,27 +2986,17 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<FaceData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
-            Pointer<FaceData<NDIM, double> > src2_data =
-                (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
-            Pointer<FaceData<NDIM, double> > alpha_data = patch->getPatchData(alpha_idx);
-
-            d_patch_math_ops.pointwiseMultiply(dst_data,
-                                               alpha_data,
-                                               src1_data,
-                                               beta,
-                                               src2_data,
-                                               patch,
-                                               dst_depth,
-                                               src1_depth,
-                                               src2_depth,
-                                               alpha_depth);
-        }
+        const PointwiseMultiplyTask<FaceData<NDIM, double> > multiply_task(d_patch_math_ops,
+                                                                           dst_idx,
+                                                                           alpha_idx,
+                                                                           src1_idx,
+                                                                           beta,
+                                                                           src2_idx,
+                                                                           dst_depth,
+                                                                           src1_depth,
+                                                                           src2_depth,
+                                                                           alpha_depth);
+        PatchTaskExecutor::execute(multiply_task, level);
     }
     return;
 } // pointwiseMultiply
@@ -2765,29 +3022,18 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<FaceData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
-            Pointer<FaceData<NDIM, double> > src2_data =
-                (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
-            Pointer<FaceData<NDIM, double> > alpha_data = patch->getPatchData(alpha_idx);
-            Pointer<FaceData<NDIM, double> > beta_data = patch->getPatchData(beta_idx);
-
-            d_patch_math_ops.pointwiseMultiply(dst_data,
-                                               alpha_data,
-                                               src1_data,
-                                               beta_data,
-                                               src2_data,
-                                               patch,
-                                               dst_depth,
-                                               src1_depth,
-                                               src2_depth,
-                                               alpha_depth,
-                                               beta_depth);
-        }
+        const PointwiseMultiplyTask<FaceData<NDIM, double> > multiply_task(d_patch_math_ops,
+                                                                           dst_idx,
+                                                                           alpha_idx,
+                                                                           src1_idx,
+                                                                           beta_idx,
+                                                                           src2_idx,
+                                                                           dst_depth,
+                                                                           src1_depth,
+                                                                           src2_depth,
+                                                                           alpha_depth,
+                                                                           beta_depth);
+        PatchTaskExecutor::execute(multiply_task, level);
     }
     return;
 } // pointwiseMultiply
@@ -2809,25 +3055,16 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<NodeData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
-            Pointer<NodeData<NDIM, double> > src2_data =
-                (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
-
-            d_patch_math_ops.pointwiseMultiply(dst_data,
-                                               alpha,
-                                               src1_data,
-                                               beta,
-                                               src2_data,
-                                               patch,
-                                               dst_depth,
-                                               src1_depth,
-                                               src2_depth);
-        }
+        const PointwiseMultiplyTask<NodeData<NDIM, double> > multiply_task(d_patch_math_ops,
+                                                                           dst_idx,
+                                                                           alpha,
+                                                                           src1_idx,
+                                                                           beta,
+                                                                           src2_idx,
+                                                                           dst_depth,
+                                                                           src1_depth,
+                                                                           src2_depth);
+        PatchTaskExecutor::execute(multiply_task, level);
     }
     return;
 } // pointwiseMultiply
@@ -2851,27 +3088,17 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<NodeData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
-            Pointer<NodeData<NDIM, double> > src2_data =
-                (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
-            Pointer<NodeData<NDIM, double> > alpha_data = patch->getPatchData(alpha_idx);
-
-            d_patch_math_ops.pointwiseMultiply(dst_data,
-                                               alpha_data,
-                                               src1_data,
-                                               beta,
-                                               src2_data,
-                                               patch,
-                                               dst_depth,
-                                               src1_depth,
-                                               src2_depth,
-                                               alpha_depth);
-        }
+        const PointwiseMultiplyTask<NodeData<NDIM, double> > multiply_task(d_patch_math_ops,
+                                                                           dst_idx,
+                                                                           alpha_idx,
+                                                                           src1_idx,
+                                                                           beta,
+                                                                           src2_idx,
+                                                                           dst_depth,
+                                                                           src1_depth,
+                                                                           src2_depth,
+                                                                           alpha_depth);
+        PatchTaskExecutor::execute(multiply_task, level);
     }
     return;
 } // pointwiseMultiply
@@ -2897,29 +3124,18 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<NodeData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
-            Pointer<NodeData<NDIM, double> > src2_data =
-                (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
-            Pointer<NodeData<NDIM, double> > alpha_data = patch->getPatchData(alpha_idx);
-            Pointer<NodeData<NDIM, double> > beta_data = patch->getPatchData(beta_idx);
-
-            d_patch_math_ops.pointwiseMultiply(dst_data,
-                                               alpha_data,
-                                               src1_data,
-                                               beta_data,
-                                               src2_data,
-                                               patch,
-                                               dst_depth,
-                                               src1_depth,
-                                               src2_depth,
-                                               alpha_depth,
-                                               beta_depth);
-        }
+        const PointwiseMultiplyTask<NodeData<NDIM, double> > multiply_task(d_patch_math_ops,
+                                                                           dst_idx,
+                                                                           alpha_idx,
+                                                                           src1_idx,
+                                                                           beta_idx,
+                                                                           src2_idx,
+                                                                           dst_depth,
+                                                                           src1_depth,
+                                                                           src2_depth,
+                                                                           alpha_depth,
+                                                                           beta_depth);
+        PatchTaskExecutor::execute(multiply_task, level);
     }
     return;
 } // pointwiseMultiply
@@ -2941,25 +3157,16 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
-            Pointer<SideData<NDIM, double> > src2_data =
-                (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
-
-            d_patch_math_ops.pointwiseMultiply(dst_data,
-                                               alpha,
-                                               src1_data,
-                                               beta,
-                                               src2_data,
-                                               patch,
-                                               dst_depth,
-                                               src1_depth,
-                                               src2_depth);
-        }
+        const PointwiseMultiplyTask<SideData<NDIM, double> > multiply_task(d_patch_math_ops,
+                                                                           dst_idx,
+                                                                           alpha,
+                                                                           src1_idx,
+                                                                           beta,
+                                                                           src2_idx,
+                                                                           dst_depth,
+                                                                           src1_depth,
+                                                                           src2_depth);
+        PatchTaskExecutor::execute(multiply_task, level);
     }
     return;
 } // pointwiseMultiply
@@ -2983,27 +3190,17 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
-            Pointer<SideData<NDIM, double> > src2_data =
-                (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
-            Pointer<SideData<NDIM, double> > alpha_data = patch->getPatchData(alpha_idx);
-
-            d_patch_math_ops.pointwiseMultiply(dst_data,
-                                               alpha_data,
-                                               src1_data,
-                                               beta,
-                                               src2_data,
-                                               patch,
-                                               dst_depth,
-                                               src1_depth,
-                                               src2_depth,
-                                               alpha_depth);
-        }
+        const PointwiseMultiplyTask<SideData<NDIM, double> > multiply_task(d_patch_math_ops,
+                                                                           dst_idx,
+                                                                           alpha_idx,
+                                                                           src1_idx,
+                                                                           beta,
+                                                                           src2_idx,
+                                                                           dst_depth,
+                                                                           src1_depth,
+                                                                           src2_depth,
+                                                                           alpha_depth);
+        PatchTaskExecutor::execute(multiply_task, level);
     }
     return;
 } // pointwiseMultiply
@@ -3029,29 +3226,18 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
-            Pointer<SideData<NDIM, double> > src2_data =
-                (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
-            Pointer<SideData<NDIM, double> > alpha_data = patch->getPatchData(alpha_idx);
-            Pointer<SideData<NDIM, double> > beta_data = patch->getPatchData(beta_idx);
-
-            d_patch_math_ops.pointwiseMultiply(dst_data,
-                                               alpha_data,
-                                               src1_data,
-                                               beta_data,
-                                               src2_data,
-                                               patch,
-                                               dst_depth,
-                                               src1_depth,
-                                               src2_depth,
-                                               alpha_depth,
-                                               beta_depth);
-        }
+        const PointwiseMultiplyTask<SideData<NDIM, double> > multiply_task(d_patch_math_ops,
+                                                                           dst_idx,
+                                                                           alpha_idx,
+                                                                           src1_idx,
+                                                                           beta_idx,
+                                                                           src2_idx,
+                                                                           dst_depth,
+                                                                           src1_depth,
+                                                                           src2_depth,
+                                                                           alpha_depth,
+                                                                           beta_depth);
+        PatchTaskExecutor::execute(multiply_task, level);
     }
     return;
 } // pointwiseMultiply
@@ -3065,15 +3251,9 @@ void HierarchyMathOps::pointwiseL1Norm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
-
-            d_patch_math_ops.pointwiseL1Norm(dst_data, src_data, patch);
-        }
+        const UnaryOpTask<CellData<NDIM, double>, CellData<NDIM, double> > norm_task(
+            d_patch_math_ops, &PatchMathOps::pointwiseL1Norm, dst_idx, src_idx);
+        PatchTaskExecutor::execute(norm_task, level);
     }
     return;
 } // pointwiseL1Norm
@@ -3087,15 +3267,9 @@ void HierarchyMathOps::pointwiseL2Norm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
-
-            d_patch_math_ops.pointwiseL2Norm(dst_data, src_data, patch);
-        }
+        const UnaryOpTask<CellData<NDIM, double>, CellData<NDIM, double> > norm_task(
+            d_patch_math_ops, &PatchMathOps::pointwiseL2Norm, dst_idx, src_idx);
+        PatchTaskExecutor::execute(norm_task, level);
     }
     return;
 } // pointwiseL2Norm
@@ -3109,15 +3283,9 @@ void HierarchyMathOps::pointwiseMaxNorm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
-
-            d_patch_math_ops.pointwiseMaxNorm(dst_data, src_data, patch);
-        }
+        const UnaryOpTask<CellData<NDIM, double>, CellData<NDIM, double> > norm_task(
+            d_patch_math_ops, &PatchMathOps::pointwiseMaxNorm, dst_idx, src_idx);
+        PatchTaskExecutor::execute(norm_task, level);
     }
     return;
 } // pointwiseMaxNorm
@@ -3131,15 +3299,9 @@ void HierarchyMathOps::pointwiseL1Norm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<NodeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
-
-            d_patch_math_ops.pointwiseL1Norm(dst_data, src_data, patch);
-        }
+        const UnaryOpTask<NodeData<NDIM, double>, NodeData<NDIM, double> > norm_task(
+            d_patch_math_ops, &PatchMathOps::pointwiseL1Norm, dst_idx, src_idx);
+        PatchTaskExecutor::execute(norm_task, level);
     }
     return;
 } // pointwiseL1Norm
@@ -3153,15 +3315,9 @@ void HierarchyMathOps::pointwiseL2Norm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<NodeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
-
-            d_patch_math_ops.pointwiseL2Norm(dst_data, src_data, patch);
-        }
+        const UnaryOpTask<NodeData<NDIM, double>, NodeData<NDIM, double> > norm_task(
+            d_patch_math_ops, &PatchMathOps::pointwiseL2Norm, dst_idx, src_idx);
+        PatchTaskExecutor::execute(norm_task, level);
     }
     return;
 } // pointwiseL2Norm
@@ -3175,15 +3331,9 @@ void HierarchyMathOps::pointwiseMaxNorm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<NodeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
-
-            d_patch_math_ops.pointwiseMaxNorm(dst_data, src_data, patch);
-        }
+        const UnaryOpTask<NodeData<NDIM, double>, NodeData<NDIM, double> > norm_task(
+            d_patch_math_ops, &PatchMathOps::pointwiseMaxNorm, dst_idx, src_idx);
+        PatchTaskExecutor::execute(norm_task, level);
     }
     return;
 } // pointwiseMaxNorm
@@ -818,6 +818,63 @@ public:
             int src2_idx = -1,
             SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > src2_var = NULL);
 
+    /*!
+     * \brief Compute the residual of a scalar Poisson-type problem using
+     * centered differences.
+     *
+     * Sets dst = rhs - (C src + div D grad src).
+     *
+     * When C and D are spatially constant, the residual is evaluated by a
+     * single application of the negated operator that accumulates rhs in the
+     * same patch kernel call.  Otherwise, the operator is applied first and the
+     * residual is formed pointwise.  dst may be the same
+     * patch data as rhs, but it must differ from src.
+     *
+     * \note Only the specified data depths are used.  To compute the residual
+     * of vector-valued data, call this method once for each data depth.
+     *
+     * \see laplace
+     */
+    void laplaceResidual(
+        int dst_idx,
+        SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > dst_var,
+        int rhs_idx,
+        SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > rhs_var,
+        const SAMRAI::solv::PoissonSpecifications& poisson_spec,
+        int src_idx,
+        SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > src_var,
+        SAMRAI::tbox::Pointer<HierarchyGhostCellInterpolation> src_ghost_fill,
+        double src_ghost_fill_time,
+        int dst_depth = 0,
+        int rhs_depth = 0,
+        int src_depth = 0);
+
+    /*!
+     * \brief Compute the residual of a side-centered Poisson-type problem
+     * using centered differences.
+     *
+     * Sets dst = rhs - (C src + div D grad src).
+     *
+     * The residual is evaluated in a single sweep over the patch data.  dst may
+     * be the same patch data as rhs, but it must differ from src.
+     *
+     * \note The present implementation of this operator \em requires that
+     * damping factor C and diffusivity D be spatially constant and
+     * scalar-valued.
+     *
+     * \see laplace
+     */
+    void laplaceResidual(
+        int dst_idx,
+        SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > dst_var,
+        int rhs_idx,
+        SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > rhs_var,
+        const SAMRAI::solv::PoissonSpecifications& poisson_spec,
+        int src_idx,
+        SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > src_var,
+        SAMRAI::tbox::Pointer<HierarchyGhostCellInterpolation> src_ghost_fill,
+        double src_ghost_fill_time);
+
     /*!
      * \brief Compute dst = alpha div coef ((grad src1) + (grad src1)^T) + beta
      * src1 + gamma src2, the variable coefficient generalized Laplacian of
@@ -75,6 +75,7 @@ static const bool CONSISTENT_TYPE_2_BDRY = false;
 
 // Timers.
 static Timer* t_apply;
+static Timer* t_apply_add;
 static Timer* t_initialize_operator_state;
 static Timer* t_deallocate_operator_state;
 }
@@ -92,6 +93,8 @@ CCLaplaceOperator::CCLaplaceOperator(const std::string& object_name, const bool
     // Setup Timers.
     IBTK_DO_ONCE(t_apply =
                      TimerManager::getManager()->getTimer("IBTK::CCLaplaceOperator::apply()");
+                 t_apply_add = TimerManager::getManager()->getTimer(
+                     "IBTK::CCLaplaceOperator::applyAdd()");
                  t_initialize_operator_state = TimerManager::getManager()->getTimer(
                      "IBTK::CCLaplaceOperator::initializeOperatorState()");
                  t_deallocate_operator_state = TimerManager::getManager()->getTimer(
@@ -141,25 +144,7 @@ void CCLaplaceOperator::apply(SAMRAIVectorReal<NDIM, double>& x,
 #endif
 
     // Simultaneously fill ghost cell values for all components.
-    typedef HierarchyGhostCellInterpolation::InterpolationTransactionComponent
-    InterpolationTransactionComponent;
-    std::vector<InterpolationTransactionComponent> transaction_comps;
-    for (int comp = 0; comp < d_ncomp; ++comp)
-    {
-        InterpolationTransactionComponent x_component(x.getComponentDescriptorIndex(comp),
-                                                      DATA_REFINE_TYPE,
-                                                      USE_CF_INTERPOLATION,
-                                                      DATA_COARSEN_TYPE,
-                                                      BDRY_EXTRAP_TYPE,
-                                                      CONSISTENT_TYPE_2_BDRY,
-                                                      d_bc_coefs,
-                                                      d_fill_pattern);
-        transaction_comps.push_back(x_component);
-    }
-    d_hier_bdry_fill->resetTransactionComponents(transaction_comps);
-    d_hier_bdry_fill->setHomogeneousBc(d_homogeneous_bc);
-    d_hier_bdry_fill->fillData(d_solution_time);
-    d_hier_bdry_fill->resetTransactionComponents(d_transaction_comps);
+    fillGhostCellValues(x);
 
     // Compute the action of the operator.
     for (int comp = 0; comp < d_ncomp; ++comp)
@@ -189,6 +174,54 @@ void CCLaplaceOperator::apply(SAMRAIVectorReal<NDIM, double>& x,
     return;
 } // apply
 
+void CCLaplaceOperator::applyAdd(SAMRAIVectorReal<NDIM, double>& x,
+                                 SAMRAIVectorReal<NDIM, double>& y,
+                                 SAMRAIVectorReal<NDIM, double>& z)
+{
+    IBTK_TIMER_START(t_apply_add);
+
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_is_initialized);
+    TBOX_ASSERT(x.getNumberOfComponents() == d_ncomp);
+    TBOX_ASSERT(y.getNumberOfComponents() == d_ncomp);
+    TBOX_ASSERT(z.getNumberOfComponents() == d_ncomp);
+#endif
+
+    // Simultaneously fill ghost cell values for all components.
+    fillGhostCellValues(x);
+
+    // Compute z = A*x + y, accumulating y in the same pass over the patch data
+    // used to evaluate the operator.  Note that y and z may be the same vector.
+    for (int comp = 0; comp < d_ncomp; ++comp)
+    {
+        Pointer<CellVariable<NDIM, double> > x_cc_var = x.getComponentVariable(comp);
+        Pointer<CellVariable<NDIM, double> > y_cc_var = y.getComponentVariable(comp);
+        Pointer<CellVariable<NDIM, double> > z_cc_var = z.getComponentVariable(comp);
+        const int x_idx = x.getComponentDescriptorIndex(comp);
+        const int y_idx = y.getComponentDescriptorIndex(comp);
+        const int z_idx = z.getComponentDescriptorIndex(comp);
+        for (unsigned int l = 0; l < d_bc_coefs.size(); ++l)
+        {
+            d_hier_math_ops->laplace(z_idx,
+                                     z_cc_var,
+                                     d_poisson_spec,
+                                     x_idx,
+                                     x_cc_var,
+                                     d_no_fill,
+                                     0.0,
+                                     1.0,
+                                     y_idx,
+                                     y_cc_var,
+                                     l,
+                                     l,
+                                     l);
+        }
+    }
+
+    IBTK_TIMER_STOP(t_apply_add);
+    return;
+} // applyAdd
+
 void CCLaplaceOperator::initializeOperatorState(const SAMRAIVectorReal<NDIM, double>& in,
                                                 const SAMRAIVectorReal<NDIM, double>& out)
 {
@@ -292,6 +325,30 @@ void CCLaplaceOperator::deallocateOperatorState()
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void CCLaplaceOperator::fillGhostCellValues(SAMRAIVectorReal<NDIM, double>& x)
+{
+    typedef HierarchyGhostCellInterpolation::InterpolationTransactionComponent
+    InterpolationTransactionComponent;
+    std::vector<InterpolationTransactionComponent> transaction_comps;
+    for (int comp = 0; comp < d_ncomp; ++comp)
+    {
+        InterpolationTransactionComponent x_component(x.getComponentDescriptorIndex(comp),
+                                                      DATA_REFINE_TYPE,
+                                                      USE_CF_INTERPOLATION,
+                                                      DATA_COARSEN_TYPE,
+                                                      BDRY_EXTRAP_TYPE,
+                                                      CONSISTENT_TYPE_2_BDRY,
+                                                      d_bc_coefs,
+                                                      d_fill_pattern);
+        transaction_comps.push_back(x_component);
+    }
+    d_hier_bdry_fill->resetTransactionComponents(transaction_comps);
+    d_hier_bdry_fill->setHomogeneousBc(d_homogeneous_bc);
+    d_hier_bdry_fill->fillData(d_solution_time);
+    d_hier_bdry_fill->resetTransactionComponents(d_transaction_comps);
+    return;
+} // fillGhostCellValues
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
@@ -104,6 +104,21 @@ public:
     void apply(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
                SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& y);
 
+    /*!
+     * \brief Compute z=Ax+y.
+     *
+     * The operator is evaluated and y is accumulated in a single pass over the
+     * patch data, so that no temporary vector is required.  The vectors y and z
+     * may be the same, but x must differ from both.
+     *
+     * \param x input
+     * \param y input
+     * \param z output: z=Ax+y
+     */
+    void applyAdd(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                  SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& y,
+                  SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& z);
+
     /*!
      * \brief Compute hierarchy-dependent data required for computing y=Ax (and
      * y=A'x).
@@ -159,6 +174,11 @@ private:
      */
     CCLaplaceOperator& operator=(const CCLaplaceOperator& that);
 
+    /*!
+     * \brief Fill ghost cell values for all components of x.
+     */
+    void fillGhostCellValues(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x);
+
     // Operator parameters.
     int d_ncomp;
 
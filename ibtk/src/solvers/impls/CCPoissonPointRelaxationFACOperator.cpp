@@ -34,7 +34,9 @@
 
 #include <stddef.h>
 #include <algorithm>
+#include <cmath>
 #include <functional>
+#include <limits>
 #include <ostream>
 #include <utility>
 
@@ -60,6 +62,7 @@
 #include "ProcessorMapping.h"
 #include "SAMRAIVectorReal.h"
 #include "SideData.h"
+#include "SideDataFactory.h"
 #include "SideIndex.h"
 #include "Variable.h"
 #include "VariableDatabase.h"
@@ -75,6 +78,7 @@
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/LinearSolver.h"
+#include "ibtk/PatchTaskExecutor.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
@@ -223,8 +227,117 @@ inline bool do_local_data_update(SmootherType smoother_type)
         return false;
     }
 } // do_local_data_update
+
+// Number of entries in the aligned finite difference stencil.
+static const int ALIGNED_STENCIL_SZ = 2 * NDIM + 1;
+
+// Perform one symmetric Gauss-Seidel sweep (a forward sweep followed by a
+// backward sweep) using single-precision stencil coefficients.  The cell
+// ordering matches that of the patch matrices used with MatSOR(), so that this
+// routine produces the same iterates as the double-precision smoother up to
+// the rounding of the stencil coefficients.
+inline void sym_gs_sweep(double* const U,
+                         const double* const F,
+                         const std::vector<float>& stencil,
+                         const Box<NDIM>& patch_box,
+                         const Box<NDIM>& ghost_box)
+{
+    boost::array<int, ALIGNED_STENCIL_SZ> offset;
+    boost::array<int, NDIM> num_cells, num_ghost_cells;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        num_cells[d] = patch_box.numberCells(d);
+        num_ghost_cells[d] = ghost_box.numberCells(d);
+    }
+#if (NDIM == 2)
+    offset[0] = -num_ghost_cells[0];
+    offset[1] = -1;
+    offset[2] = 0;
+    offset[3] = +1;
+    offset[4] = +num_ghost_cells[0];
+#endif
+#if (NDIM == 3)
+    offset[0] = -num_ghost_cells[0] * num_ghost_cells[1];
+    offset[1] = -num_ghost_cells[0];
+    offset[2] = -1;
+    offset[3] = 0;
+    offset[4] = +1;
+    offset[5] = +num_ghost_cells[0];
+    offset[6] = +num_ghost_cells[0] * num_ghost_cells[1];
+#endif
+    const int first_idx = ghost_box.offset(patch_box.lower());
+    const int num_lines = patch_box.size() / num_cells[0];
+    for (int sweep = 0; sweep < 2; ++sweep)
+    {
+        const bool forward = (sweep == 0);
+        for (int l = 0; l < num_lines; ++l)
+        {
+            // Determine the offset of the first cell in the current line of
+            // cells along the x-axis.
+            const int line = forward ? l : num_lines - 1 - l;
+            int line_idx = first_idx;
+            for (int d = 1, r = line, stride = num_ghost_cells[0]; d < NDIM;
+                 stride *= num_ghost_cells[d], ++d)
+            {
+                line_idx += (r % num_cells[d]) * stride;
+                r /= num_cells[d];
+            }
+            for (int m = 0; m < num_cells[0]; ++m)
+            {
+                const int i = forward ? m : num_cells[0] - 1 - m;
+                const int idx = line_idx + i;
+                const int k_cell = line * num_cells[0] + i;
+                const float* const a = &stencil[k_cell * ALIGNED_STENCIL_SZ];
+                double res = F[idx];
+                for (int k = 0; k < ALIGNED_STENCIL_SZ; ++k)
+                {
+                    if (k != NDIM) res -= static_cast<double>(a[k]) * U[idx + offset[k]];
+                }
+                U[idx] = res / static_cast<double>(a[NDIM]);
+            }
+        }
+    }
+    return;
+} // sym_gs_sweep
 }
 
+class CCPoissonPointRelaxationFACOperator::SmoothPatchErrorTask
+{
+public:
+    SmoothPatchErrorTask(CCPoissonPointRelaxationFACOperator& fac_op,
+                         SAMRAIVectorReal<NDIM, double>& error,
+                         const SAMRAIVectorReal<NDIM, double>& residual,
+                         const int level_num,
+                         const int isweep,
+                         const bool red_black_ordering,
+                         const bool update_local_data)
+        : d_fac_op(fac_op), d_error(error), d_residual(residual), d_level_num(level_num),
+          d_isweep(isweep), d_red_black_ordering(red_black_ordering),
+          d_update_local_data(update_local_data)
+    {
+    } // SmoothPatchErrorTask
+
+    void operator()(const Pointer<Patch<NDIM> >& patch, const int patch_counter) const
+    {
+        d_fac_op.smoothPatchError(d_error,
+                                  d_residual,
+                                  d_level_num,
+                                  patch,
+                                  patch_counter,
+                                  d_isweep,
+                                  d_red_black_ordering,
+                                  d_update_local_data);
+        return;
+    } // operator()
+
+private:
+    CCPoissonPointRelaxationFACOperator& d_fac_op;
+    SAMRAIVectorReal<NDIM, double>& d_error;
+    const SAMRAIVectorReal<NDIM, double>& d_residual;
+    const int d_level_num, d_isweep;
+    const bool d_red_black_ordering, d_update_local_data;
+};
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 CCPoissonPointRelaxationFACOperator::CCPoissonPointRelaxationFACOperator(
@@ -238,7 +351,8 @@ CCPoissonPointRelaxationFACOperator::CCPoissonPointRelaxationFACOperator(
           input_db,
           default_options_prefix),
       d_coarse_solver(NULL), d_coarse_solver_db(), d_using_petsc_smoothers(true),
-      d_patch_vec_e(), d_patch_vec_f(), d_patch_mat(), d_patch_bc_box_overlap(),
+      d_patch_vec_e(), d_patch_vec_f(), d_patch_mat(), d_smoother_precision("DOUBLE"),
+      d_using_single_precision_smoothers(false), d_patch_stencil(), d_patch_bc_box_overlap(),
       d_patch_neighbor_overlap()
 {
     // Set some default values.
@@ -259,6 +373,8 @@ CCPoissonPointRelaxationFACOperator::CCPoissonPointRelaxationFACOperator(
     {
         if (input_db->keyExists("smoother_type"))
             d_smoother_type = input_db->getString("smoother_type");
+        if (input_db->keyExists("smoother_precision"))
+            d_smoother_precision = input_db->getString("smoother_precision");
         if (input_db->keyExists("prolongation_method"))
             d_prolongation_method = input_db->getString("prolongation_method");
         if (input_db->keyExists("restriction_method"))
@@ -298,7 +414,8 @@ CCPoissonPointRelaxationFACOperator::CCPoissonPointRelaxationFACOperator(
         }
     }
 
-    // Configure the coarse level solver.
+    // Configure the smoothers and the coarse level solver.
+    setSmootherPrecision(d_smoother_precision);
     setCoarseSolverType(d_coarse_solver_type);
 
     // Setup Timers.
@@ -326,6 +443,26 @@ void CCPoissonPointRelaxationFACOperator::setSmootherType(const std::string& smo
     return;
 } // setSmootherType
 
+void CCPoissonPointRelaxationFACOperator::setSmootherPrecision(
+    const std::string& smoother_precision)
+{
+    if (d_is_initialized)
+    {
+        TBOX_ERROR(d_object_name << "::setSmootherPrecision():\n"
+                                 << "  cannot be called while operator state is initialized"
+                                 << std::endl);
+    }
+    if (smoother_precision != "DOUBLE" && smoother_precision != "SINGLE")
+    {
+        TBOX_ERROR(d_object_name << "::setSmootherPrecision():\n"
+                                 << "  unknown smoother precision: " << smoother_precision
+                                 << "\n"
+                                 << "  valid choices are: DOUBLE, SINGLE" << std::endl);
+    }
+    d_smoother_precision = smoother_precision;
+    return;
+} // setSmootherPrecision
+
 void
 CCPoissonPointRelaxationFACOperator::setCoarseSolverType(const std::string& coarse_solver_type)
 {
@@ -450,153 +587,16 @@ void CCPoissonPointRelaxationFACOperator::smoothError(
             xeqScheduleGhostFillNoCoarse(error_idx, level_num);
         }
 
-        // Smooth the error on the patches.
-        int patch_counter = 0;
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            Pointer<CellData<NDIM, double> > error_data =
-                error.getComponentPatchData(0, *patch);
-            Pointer<CellData<NDIM, double> > residual_data =
-                residual.getComponentPatchData(0, *patch);
-#if !defined(NDEBUG)
-            const Box<NDIM>& ghost_box = error_data->getGhostBox();
-            TBOX_ASSERT(ghost_box == residual_data->getGhostBox());
-            TBOX_ASSERT(error_data->getGhostCellWidth() == d_gcw);
-            TBOX_ASSERT(residual_data->getGhostCellWidth() == d_gcw);
-            TBOX_ASSERT(error_data->getDepth() == residual_data->getDepth());
-#endif
-            const Box<NDIM>& patch_box = patch->getBox();
-            const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-            const double* const dx = pgeom->getDx();
-
-            // Copy updated values from neighboring local patches.
-            if (update_local_data)
-            {
-                const std::map<int, Box<NDIM> > neighbor_overlap =
-                    d_patch_neighbor_overlap[level_num][patch_counter];
-                for (std::map<int, Box<NDIM> >::const_iterator cit = neighbor_overlap.begin();
-                     cit != neighbor_overlap.end();
-                     ++cit)
-                {
-                    const int src_patch_num = cit->first;
-                    const Box<NDIM>& overlap = cit->second;
-                    Pointer<Patch<NDIM> > src_patch = level->getPatch(src_patch_num);
-                    Pointer<CellData<NDIM, double> > src_error_data =
-                        error.getComponentPatchData(0, *src_patch);
-                    error_data->getArrayData().copy(
-                        src_error_data->getArrayData(), overlap, IntVector<NDIM>(0));
-                }
-            }
-
-            // Smooth the error for each data depth.
-            //
-            // NOTE: Since the boundary conditions are handled "implicitly" by
-            // setting ghost cell values, we can re-use the same patch operators
-            // for each data depth even if different boundary conditions are
-            // imposed on different components of the vector-valued solution
-            // data.
-            if (d_using_petsc_smoothers)
-            {
-                // Reset ghost cell values in the residual data so that patch
-                // boundary conditions are properly handled.
-                residual_data->getArrayData().copy(
-                    error_data->getArrayData(),
-                    d_patch_bc_box_overlap[level_num][patch_counter],
-                    IntVector<NDIM>(0));
-
-                for (int depth = 0; depth < error_data->getDepth(); ++depth)
-                {
-                    // Setup the PETSc Vec wrappers for the given patch data and
-                    // data depth.
-                    int ierr;
-
-                    Vec& e = d_patch_vec_e[level_num][patch_counter];
-                    Vec& f = d_patch_vec_f[level_num][patch_counter];
-
-                    ierr = VecPlaceArray(e, error_data->getPointer(depth));
-                    IBTK_CHKERRQ(ierr);
-                    ierr = VecPlaceArray(f, residual_data->getPointer(depth));
-                    IBTK_CHKERRQ(ierr);
-
-                    // Smooth the error on the patch using PETSc.  Here, we are
-                    // approximately solving
-                    //
-                    //     Ae = f
-                    //
-                    // using an iteration of the form
-                    //
-                    //     e <- e + PC(f - Ae) = e + PC(r) = e + x.
-                    //
-                    // Presently, we simply employ symmetric Gauss-Seidel as the
-                    // patch smoother.
-                    static const double omega = 1.0;
-                    static const double shift = 0.0;
-                    static const int its = 1;
-                    Mat& A = d_patch_mat[level_num][patch_counter];
-                    ierr = MatSOR(A, f, omega, SOR_SYMMETRIC_SWEEP, shift, its, its, e);
-                    IBTK_CHKERRQ(ierr);
-
-                    // Reset the PETSc Vec wrappers.
-                    ierr = VecResetArray(e);
-                    IBTK_CHKERRQ(ierr);
-                    ierr = VecResetArray(f);
-                    IBTK_CHKERRQ(ierr);
-                }
-            }
-            else
-            {
-                // Smooth the error via Gauss-Seidel.
-                const double& alpha = d_poisson_spec.getDConstant();
-                const double& beta =
-                    d_poisson_spec.cIsZero() ? 0.0 : d_poisson_spec.getCConstant();
-                for (int depth = 0; depth < error_data->getDepth(); ++depth)
-                {
-                    double* const U = error_data->getPointer(depth);
-                    const int U_ghosts = (error_data->getGhostCellWidth()).max();
-                    const double* const F = residual_data->getPointer(depth);
-                    const int F_ghosts = (residual_data->getGhostCellWidth()).max();
-                    if (red_black_ordering)
-                    {
-                        int red_or_black = isweep % 2; // "red" = 0, "black" = 1
-                        RB_GS_SMOOTH_FC(U,
-                                        U_ghosts,
-                                        alpha,
-                                        beta,
-                                        F,
-                                        F_ghosts,
-                                        patch_box.lower(0),
-                                        patch_box.upper(0),
-                                        patch_box.lower(1),
-                                        patch_box.upper(1),
-#if (NDIM == 3)
-                                        patch_box.lower(2),
-                                        patch_box.upper(2),
-#endif
-                                        dx,
-                                        red_or_black);
-                    }
-                    else
-                    {
-                        GS_SMOOTH_FC(U,
-                                     U_ghosts,
-                                     alpha,
-                                     beta,
-                                     F,
-                                     F_ghosts,
-                                     patch_box.lower(0),
-                                     patch_box.upper(0),
-                                     patch_box.lower(1),
-                                     patch_box.upper(1),
-#if (NDIM == 3)
-                                     patch_box.lower(2),
-                                     patch_box.upper(2),
-#endif
-                                     dx);
-                    }
-                }
-            }
-        }
+        // Smooth the error on the patches.  Patches are processed concurrently
+        // only when each patch update reads and writes data on that patch
+        // alone, i.e., when values are not copied from neighboring local
+        // patches, and when PETSc, which is not thread safe, is not used to
+        // perform the patch sweeps.
+        const bool allow_threads =
+            !update_local_data && (!d_using_petsc_smoothers || d_using_single_precision_smoothers);
+        const SmoothPatchErrorTask smooth_task(
+            *this, error, residual, level_num, isweep, red_black_ordering, update_local_data);
+        PatchTaskExecutor::executeIndexed(smooth_task, level, allow_threads);
     }
     IBTK_TIMER_STOP(t_smooth_error);
     return;
@@ -690,7 +690,7 @@ void CCPoissonPointRelaxationFACOperator::computeResidual(
     d_level_bdry_fill_ops[finest_level_num]->resetTransactionComponent(
         default_transaction_comp);
 
-    // Compute the residual, r = f - A*u.
+    // Compute the residual, r = f - A*u, for each data depth.
     if (!d_level_math_ops[finest_level_num])
     {
         std::ostringstream stream;
@@ -698,11 +698,61 @@ void CCPoissonPointRelaxationFACOperator::computeResidual(
         d_level_math_ops[finest_level_num] = new HierarchyMathOps(
             stream.str(), d_hierarchy, coarsest_level_num, finest_level_num);
     }
-    d_level_math_ops[finest_level_num]->laplace(
-        res_idx, res_var, d_poisson_spec, sol_idx, sol_var, NULL, d_solution_time);
-    HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(
-        d_hierarchy, coarsest_level_num, finest_level_num);
-    hier_cc_data_ops.axpy(res_idx, -1.0, res_idx, rhs_idx, false);
+    for (unsigned int d = 0; d < d_bc_coefs.size(); ++d)
+    {
+        d_level_math_ops[finest_level_num]->laplaceResidual(res_idx,
+                                                            res_var,
+                                                            rhs_idx,
+                                                            rhs_var,
+                                                            d_poisson_spec,
+                                                            sol_idx,
+                                                            sol_var,
+                                                            NULL,
+                                                            d_solution_time,
+                                                            d,
+                                                            d,
+                                                            d);
+    }
+
+#if !defined(NDEBUG)
+    // Check the fused residual against the residual obtained by applying the
+    // operator to each data depth and then forming r = f - A*u.
+    if (res_idx != rhs_idx)
+    {
+        Pointer<CellDataFactory<NDIM, double> > res_factory = res_var->getPatchDataFactory();
+        TBOX_ASSERT(res_factory->getDefaultDepth() == static_cast<int>(d_bc_coefs.size()));
+        Pointer<SAMRAIVectorReal<NDIM, double> > check_vec =
+            residual.cloneVector(d_object_name + "::residual_check");
+        check_vec->allocateVectorData(d_solution_time);
+        const int check_idx = check_vec->getComponentDescriptorIndex(0);
+        const Pointer<CellVariable<NDIM, double> > check_var = check_vec->getComponentVariable(0);
+        for (unsigned int d = 0; d < d_bc_coefs.size(); ++d)
+        {
+            d_level_math_ops[finest_level_num]->laplace(check_idx,
+                                                        check_var,
+                                                        d_poisson_spec,
+                                                        sol_idx,
+                                                        sol_var,
+                                                        NULL,
+                                                        d_solution_time,
+                                                        0.0,
+                                                        -1,
+                                                        Pointer<CellVariable<NDIM, double> >(NULL),
+                                                        d,
+                                                        d);
+        }
+        HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(
+            d_hierarchy, coarsest_level_num, finest_level_num);
+        hier_cc_data_ops.axpy(check_idx, -1.0, check_idx, rhs_idx);
+        hier_cc_data_ops.subtract(check_idx, check_idx, res_idx);
+        const double res_diff = hier_cc_data_ops.maxNorm(check_idx);
+        const double res_scale = std::max(
+            1.0, std::max(hier_cc_data_ops.maxNorm(res_idx), hier_cc_data_ops.maxNorm(rhs_idx)));
+        TBOX_ASSERT(res_diff <= std::sqrt(std::numeric_limits<double>::epsilon()) * res_scale);
+        check_vec->deallocateVectorData();
+        check_vec->freeVectorComponents();
+    }
+#endif
 
     IBTK_TIMER_STOP(t_compute_residual);
     return;
@@ -784,7 +834,40 @@ void CCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(
     // Initialize all cached PETSc data.
     d_using_petsc_smoothers = (!d_poisson_spec.cIsZero() && !d_poisson_spec.cIsConstant()) ||
                               !d_poisson_spec.dIsConstant();
-    if (d_using_petsc_smoothers)
+    d_using_single_precision_smoothers =
+        d_using_petsc_smoothers && d_smoother_precision == "SINGLE";
+    if (d_using_single_precision_smoothers && !d_poisson_spec.dIsConstant())
+    {
+        Pointer<SideDataFactory<NDIM, double> > D_pdat_fac =
+            var_db->getPatchDescriptor()->getPatchDataFactory(
+                d_poisson_spec.getDPatchDataId());
+        if (!D_pdat_fac || D_pdat_fac->getDefaultDepth() != 1)
+        {
+            TBOX_ERROR(d_object_name << "::initializeOperatorState()\n"
+                                     << "  single-precision smoothers require D to be "
+                                        "side-centered double precision data with depth 1"
+                                     << std::endl);
+        }
+    }
+    if (d_using_single_precision_smoothers)
+    {
+        d_patch_stencil.resize(d_finest_ln + 1);
+        for (int ln = coarsest_reset_ln; ln <= finest_reset_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            const int num_local_patches =
+                level->getProcessorMapping().getLocalIndices().getSize();
+            d_patch_stencil[ln].resize(num_local_patches);
+            int patch_counter = 0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                buildPatchLaplaceStencil(
+                    d_patch_stencil[ln][patch_counter], d_poisson_spec, patch);
+            }
+        }
+    }
+    else if (d_using_petsc_smoothers)
     {
         int ierr;
         d_patch_vec_e.resize(d_finest_ln + 1);
@@ -875,7 +958,14 @@ void CCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(
     if (!d_is_initialized) return;
 
     int ierr;
-    if (d_using_petsc_smoothers)
+    if (d_using_single_precision_smoothers)
+    {
+        for (int ln = coarsest_reset_ln; ln <= std::min(d_finest_ln, finest_reset_ln); ++ln)
+        {
+            d_patch_stencil[ln].clear();
+        }
+    }
+    else if (d_using_petsc_smoothers)
     {
         for (int ln = coarsest_reset_ln; ln <= std::min(d_finest_ln, finest_reset_ln); ++ln)
         {
@@ -914,6 +1004,7 @@ void CCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(
         d_patch_vec_e.clear();
         d_patch_vec_f.clear();
         d_patch_mat.clear();
+        d_patch_stencil.clear();
         d_patch_bc_box_overlap.clear();
         d_patch_neighbor_overlap.clear();
         if (d_coarse_solver) d_coarse_solver->deallocateSolverState();
@@ -923,31 +1014,188 @@ void CCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
-void CCPoissonPointRelaxationFACOperator::buildPatchLaplaceOperator(
-    Mat& A,
-    const PoissonSpecifications& poisson_spec,
+void CCPoissonPointRelaxationFACOperator::smoothPatchError(
+    SAMRAIVectorReal<NDIM, double>& error,
+    const SAMRAIVectorReal<NDIM, double>& residual,
+    const int level_num,
     const Pointer<Patch<NDIM> > patch,
-    const IntVector<NDIM>& ghost_cell_width)
+    const int patch_counter,
+    const int isweep,
+    const bool red_black_ordering,
+    const bool update_local_data)
 {
+    Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+    Pointer<CellData<NDIM, double> > residual_data = residual.getComponentPatchData(0, *patch);
 #if !defined(NDEBUG)
-    if (ghost_cell_width.min() == 0)
+    const Box<NDIM>& ghost_box = error_data->getGhostBox();
+    TBOX_ASSERT(ghost_box == residual_data->getGhostBox());
+    TBOX_ASSERT(error_data->getGhostCellWidth() == d_gcw);
+    TBOX_ASSERT(residual_data->getGhostCellWidth() == d_gcw);
+    TBOX_ASSERT(error_data->getDepth() == residual_data->getDepth());
+#endif
+    const Box<NDIM>& patch_box = patch->getBox();
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+
+    // Copy updated values from neighboring local patches.
+    if (update_local_data)
     {
-        TBOX_ERROR("CCPoissonPointRelaxationFACOperator::buildPatchLaplaceOperator():\n"
-                   << "  ghost cells are required in all directions" << std::endl);
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
+        const std::map<int, Box<NDIM> > neighbor_overlap =
+            d_patch_neighbor_overlap[level_num][patch_counter];
+        for (std::map<int, Box<NDIM> >::const_iterator cit = neighbor_overlap.begin();
+             cit != neighbor_overlap.end();
+             ++cit)
+        {
+            const int src_patch_num = cit->first;
+            const Box<NDIM>& overlap = cit->second;
+            Pointer<Patch<NDIM> > src_patch = level->getPatch(src_patch_num);
+            Pointer<CellData<NDIM, double> > src_error_data =
+                error.getComponentPatchData(0, *src_patch);
+            error_data->getArrayData().copy(
+                src_error_data->getArrayData(), overlap, IntVector<NDIM>(0));
+        }
+    }
+
+    // Smooth the error for each data depth.
+    //
+    // NOTE: Since the boundary conditions are handled "implicitly" by
+    // setting ghost cell values, we can re-use the same patch operators
+    // for each data depth even if different boundary conditions are
+    // imposed on different components of the vector-valued solution
+    // data.
+    if (d_using_single_precision_smoothers)
+    {
+        // Smooth the error via symmetric Gauss-Seidel using the cached
+        // single-precision patch operators.  Ghost cell values are not
+        // modified by the smoother.
+        const Box<NDIM>& ghost_box = error_data->getGhostBox();
+        const std::vector<float>& stencil = d_patch_stencil[level_num][patch_counter];
+        for (int depth = 0; depth < error_data->getDepth(); ++depth)
+        {
+            sym_gs_sweep(error_data->getPointer(depth),
+                         residual_data->getPointer(depth),
+                         stencil,
+                         patch_box,
+                         ghost_box);
+        }
+    }
+    else if (d_using_petsc_smoothers)
+    {
+        // Reset ghost cell values in the residual data so that patch
+        // boundary conditions are properly handled.
+        residual_data->getArrayData().copy(error_data->getArrayData(),
+                                           d_patch_bc_box_overlap[level_num][patch_counter],
+                                           IntVector<NDIM>(0));
+
+        for (int depth = 0; depth < error_data->getDepth(); ++depth)
+        {
+            // Setup the PETSc Vec wrappers for the given patch data and
+            // data depth.
+            int ierr;
+
+            Vec& e = d_patch_vec_e[level_num][patch_counter];
+            Vec& f = d_patch_vec_f[level_num][patch_counter];
+
+            ierr = VecPlaceArray(e, error_data->getPointer(depth));
+            IBTK_CHKERRQ(ierr);
+            ierr = VecPlaceArray(f, residual_data->getPointer(depth));
+            IBTK_CHKERRQ(ierr);
+
+            // Smooth the error on the patch using PETSc.  Here, we are
+            // approximately solving
+            //
+            //     Ae = f
+            //
+            // using an iteration of the form
+            //
+            //     e <- e + PC(f - Ae) = e + PC(r) = e + x.
+            //
+            // Presently, we simply employ symmetric Gauss-Seidel as the
+            // patch smoother.
+            static const double omega = 1.0;
+            static const double shift = 0.0;
+            static const int its = 1;
+            Mat& A = d_patch_mat[level_num][patch_counter];
+            ierr = MatSOR(A, f, omega, SOR_SYMMETRIC_SWEEP, shift, its, its, e);
+            IBTK_CHKERRQ(ierr);
+
+            // Reset the PETSc Vec wrappers.
+            ierr = VecResetArray(e);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecResetArray(f);
+            IBTK_CHKERRQ(ierr);
+        }
     }
+    else
+    {
+        // Smooth the error via Gauss-Seidel.
+        const double& alpha = d_poisson_spec.getDConstant();
+        const double& beta = d_poisson_spec.cIsZero() ? 0.0 : d_poisson_spec.getCConstant();
+        for (int depth = 0; depth < error_data->getDepth(); ++depth)
+        {
+            double* const U = error_data->getPointer(depth);
+            const int U_ghosts = (error_data->getGhostCellWidth()).max();
+            const double* const F = residual_data->getPointer(depth);
+            const int F_ghosts = (residual_data->getGhostCellWidth()).max();
+            if (red_black_ordering)
+            {
+                int red_or_black = isweep % 2; // "red" = 0, "black" = 1
+                RB_GS_SMOOTH_FC(U,
+                                U_ghosts,
+                                alpha,
+                                beta,
+                                F,
+                                F_ghosts,
+                                patch_box.lower(0),
+                                patch_box.upper(0),
+                                patch_box.lower(1),
+                                patch_box.upper(1),
+#if (NDIM == 3)
+                                patch_box.lower(2),
+                                patch_box.upper(2),
 #endif
+                                dx,
+                                red_or_black);
+            }
+            else
+            {
+                GS_SMOOTH_FC(U,
+                             U_ghosts,
+                             alpha,
+                             beta,
+                             F,
+                             F_ghosts,
+                             patch_box.lower(0),
+                             patch_box.upper(0),
+                             patch_box.lower(1),
+                             patch_box.upper(1),
+#if (NDIM == 3)
+                             patch_box.lower(2),
+                             patch_box.upper(2),
+#endif
+                             dx);
+            }
+        }
+    }
+    return;
+} // smoothPatchError
 
-    // Get the Poisson problem coefficients.
+void CCPoissonPointRelaxationFACOperator::getPatchLaplaceCoefficients(
+    Pointer<CellData<NDIM, double> >& C_data,
+    Pointer<SideData<NDIM, double> >& D_data,
+    const PoissonSpecifications& poisson_spec,
+    const Pointer<Patch<NDIM> > patch)
+{
     const Box<NDIM>& patch_box = patch->getBox();
     static const IntVector<NDIM> no_ghosts = 0;
 
-    Pointer<CellData<NDIM, double> > C_data;
     if (!poisson_spec.cIsZero() && !poisson_spec.cIsConstant())
     {
         C_data = patch->getPatchData(poisson_spec.getCPatchDataId());
         if (!C_data)
         {
-            TBOX_ERROR("CCPoissonPointRelaxationFACOperator::buildPatchLaplaceOperator()\n"
+            TBOX_ERROR("CCPoissonPointRelaxationFACOperator::getPatchLaplaceCoefficients()\n"
                        << "  to solve (C u + div D grad u) = f with non-constant C,\n"
                        << "  C must be cell-centered double precision data" << std::endl);
         }
@@ -961,13 +1209,12 @@ void CCPoissonPointRelaxationFACOperator::buildPatchLaplaceOperator(
             C_data->fill(poisson_spec.getCConstant());
     }
 
-    Pointer<SideData<NDIM, double> > D_data;
     if (!poisson_spec.dIsConstant())
     {
         D_data = patch->getPatchData(poisson_spec.getDPatchDataId());
         if (!D_data)
         {
-            TBOX_ERROR("CCPoissonPointRelaxationFACOperator::buildPatchLaplaceOperator()\n"
+            TBOX_ERROR("CCPoissonPointRelaxationFACOperator::getPatchLaplaceCoefficients()\n"
                        << "  to solve C u + div D grad u = f with non-constant D,\n"
                        << "  D must be side-centered double precision data" << std::endl);
         }
@@ -977,6 +1224,27 @@ void CCPoissonPointRelaxationFACOperator::buildPatchLaplaceOperator(
         D_data = new SideData<NDIM, double>(patch_box, 1, no_ghosts);
         D_data->fill(poisson_spec.getDConstant());
     }
+    return;
+} // getPatchLaplaceCoefficients
+
+void CCPoissonPointRelaxationFACOperator::buildPatchLaplaceOperator(
+    Mat& A,
+    const PoissonSpecifications& poisson_spec,
+    const Pointer<Patch<NDIM> > patch,
+    const IntVector<NDIM>& ghost_cell_width)
+{
+#if !defined(NDEBUG)
+    if (ghost_cell_width.min() == 0)
+    {
+        TBOX_ERROR("CCPoissonPointRelaxationFACOperator::buildPatchLaplaceOperator():\n"
+                   << "  ghost cells are required in all directions" << std::endl);
+    }
+#endif
+
+    // Get the Poisson problem coefficients.
+    Pointer<CellData<NDIM, double> > C_data;
+    Pointer<SideData<NDIM, double> > D_data;
+    getPatchLaplaceCoefficients(C_data, D_data, poisson_spec, patch);
 
     // Build the patch operator.
     if (D_data->getDepth() == 1)
@@ -1129,6 +1397,54 @@ void CCPoissonPointRelaxationFACOperator::buildPatchLaplaceOperator_aligned(
     return;
 } // buildPatchLaplaceOperator_aligned
 
+void CCPoissonPointRelaxationFACOperator::buildPatchLaplaceStencil(
+    std::vector<float>& stencil,
+    const PoissonSpecifications& poisson_spec,
+    const Pointer<Patch<NDIM> > patch)
+{
+    // Get the Poisson problem coefficients.
+    Pointer<CellData<NDIM, double> > C_data;
+    Pointer<SideData<NDIM, double> > D_data;
+    getPatchLaplaceCoefficients(C_data, D_data, poisson_spec, patch);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(D_data->getDepth() == 1);
+#endif
+
+    // Compute the stencil coefficients in double precision and store them in
+    // single precision.  The stencil ordering is the same as that used by
+    // buildPatchLaplaceOperator_aligned().
+    const Box<NDIM>& patch_box = patch->getBox();
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+    stencil.resize(ALIGNED_STENCIL_SZ * patch_box.size());
+    int k = 0;
+    for (Box<NDIM>::Iterator b(patch_box); b; b++, ++k)
+    {
+        const Index<NDIM>& i = b();
+        boost::array<double, ALIGNED_STENCIL_SZ> vals;
+        vals.assign(0.0);
+        vals[NDIM] = (*C_data)(i);
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            const double& h = dx[axis];
+            {
+                const SideIndex<NDIM> ilower(i, axis, SideIndex<NDIM>::Lower);
+                const double& D_lower = (*D_data)(ilower);
+                vals[NDIM - axis - 1] += D_lower / (h * h);
+                vals[NDIM] -= D_lower / (h * h);
+            }
+            {
+                const SideIndex<NDIM> iupper(i, axis, SideIndex<NDIM>::Upper);
+                const double& D_upper = (*D_data)(iupper);
+                vals[NDIM + axis + 1] += D_upper / (h * h);
+                vals[NDIM] -= D_upper / (h * h);
+            }
+        }
+        std::copy(vals.begin(), vals.end(), stencil.begin() + k * ALIGNED_STENCIL_SZ);
+    }
+    return;
+} // buildPatchLaplaceStencil
+
 void CCPoissonPointRelaxationFACOperator::buildPatchLaplaceOperator_nonaligned(
     Mat& A,
     const Pointer<CellData<NDIM, double> > C_data,
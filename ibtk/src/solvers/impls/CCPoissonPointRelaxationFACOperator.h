@@ -105,6 +105,7 @@ namespace IBTK
  * values): \verbatim
 
  smoother_type = "PATCH_GAUSS_SEIDEL"         // see setSmootherType()
+ smoother_precision = "DOUBLE"                // see setSmootherPrecision()
  prolongation_method = "LINEAR_REFINE"        // see setProlongationMethod()
  restriction_method = "CONSERVATIVE_COARSEN"  // see setRestrictionMethod()
  coarse_solver_type = "HYPRE_LEVEL_SOLVER"    // see setCoarseSolverType()
@@ -167,6 +168,33 @@ public:
      */
     void setSmootherType(const std::string& smoother_type);
 
+    /*!
+     * \brief Specify the precision used to store the patch operators employed
+     * by the smoothers.
+     *
+     * Select from:
+     * - \c "DOUBLE"
+     * - \c "SINGLE"
+     *
+     * When single precision is selected, the patch operators used by the
+     * variable-coefficient smoothers are stored as single-precision stencils
+     * (4 bytes per coefficient) instead of double-precision AIJ matrices (about
+     * 12 bytes per nonzero).  This reduces the storage of the patch operators
+     * by roughly a factor of three.  The error and residual vectors are still
+     * stored in double precision, and all accumulation is performed in double
+     * precision, so that the memory traffic of a complete smoother sweep is
+     * reduced by roughly a factor of two.  Because the resulting
+     * preconditioner is only accurate to single precision, it should be used
+     * within a flexible outer Krylov method (e.g., FGMRES), which corrects the
+     * solution in double precision.
+     *
+     * \note This setting currently affects only problems with non-constant
+     * coefficients and isotropic or grid-aligned anisotropic diffusion
+     * coefficients.  In all other cases, the smoothers do not form explicit
+     * patch operators.
+     */
+    void setSmootherPrecision(const std::string& smoother_precision);
+
     /*!
      * \brief Specify the coarse level solver.
      */
@@ -273,6 +301,38 @@ private:
     CCPoissonPointRelaxationFACOperator&
     operator=(const CCPoissonPointRelaxationFACOperator& that);
 
+    /*!
+     * \brief Task used to smooth the error on each patch of a level via
+     * PatchTaskExecutor.
+     */
+    class SmoothPatchErrorTask;
+    friend class SmoothPatchErrorTask;
+
+    /*!
+     * \brief Perform a single smoothing sweep on the specified patch.
+     *
+     * The patch is identified both by the patch object and by its local patch
+     * number, which indexes the cached patch operators and overlap data.
+     */
+    void smoothPatchError(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& error,
+                          const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& residual,
+                          int level_num,
+                          SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                          int patch_counter,
+                          int isweep,
+                          bool red_black_ordering,
+                          bool update_local_data);
+
+    /*!
+     * \brief Get the coefficient data required to construct a Laplace operator
+     * restricted to a single patch.
+     */
+    static void getPatchLaplaceCoefficients(
+        SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> >& C_data,
+        SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> >& D_data,
+        const SAMRAI::solv::PoissonSpecifications& poisson_spec,
+        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch);
+
     /*!
      * \brief Construct a matrix corresponding to a Laplace operator restricted
      * to a single patch.
@@ -305,6 +365,20 @@ private:
         SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
         const SAMRAI::hier::IntVector<NDIM>& ghost_cell_width);
 
+    /*!
+     * \brief Construct the single-precision finite difference stencil
+     * coefficients corresponding to a Laplace operator restricted to a single
+     * patch with grid aligned anisotropy.
+     *
+     * The coefficients are stored cell-by-cell for the cells in the patch
+     * interior, using the same stencil ordering as
+     * buildPatchLaplaceOperator_aligned().
+     */
+    static void
+    buildPatchLaplaceStencil(std::vector<float>& stencil,
+                             const SAMRAI::solv::PoissonSpecifications& poisson_spec,
+                             SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch);
+
     /*
      * Coarse level solvers and solver parameters.
      */
@@ -318,6 +392,13 @@ private:
     std::vector<std::vector<Vec> > d_patch_vec_e, d_patch_vec_f;
     std::vector<std::vector<Mat> > d_patch_mat;
 
+    /*
+     * Single-precision patch operators.
+     */
+    std::string d_smoother_precision;
+    bool d_using_single_precision_smoothers;
+    std::vector<std::vector<std::vector<float> > > d_patch_stencil;
+
     /*
      * Patch overlap data.
      */
@@ -80,7 +80,8 @@ PETScKrylovLinearSolver::PETScKrylovLinearSolver(const std::string& object_name,
       d_petsc_mat(NULL), d_petsc_nullsp(NULL), d_managing_petsc_ksp(true),
       d_user_provided_mat(false), d_user_provided_pc(false), d_nullspace_constant_vec(NULL),
       d_petsc_nullspace_constant_vec(NULL), d_petsc_nullspace_basis_vecs(),
-      d_solver_has_attached_nullspace(false)
+      d_solver_has_attached_nullspace(false), d_recycled_subspace_size(0), d_recycled_x_vecs(),
+      d_recycled_Ax_vecs()
 {
     // Setup default values.
     GeneralSolver::init(object_name, /*homogeneous_bc*/ false);
@@ -108,6 +109,8 @@ PETScKrylovLinearSolver::PETScKrylovLinearSolver(const std::string& object_name,
             d_initial_guess_nonzero = input_db->getBool("initial_guess_nonzero");
         if (input_db->keyExists("enable_logging"))
             d_enable_logging = input_db->getBool("enable_logging");
+        if (input_db->keyExists("recycled_subspace_size"))
+            setRecycledSubspaceSize(input_db->getInteger("recycled_subspace_size"));
     }
 
     // Common constructor functionality.
@@ -122,7 +125,8 @@ PETScKrylovLinearSolver::PETScKrylovLinearSolver(const std::string& object_name,
       d_petsc_mat(NULL), d_petsc_nullsp(NULL), d_managing_petsc_ksp(false),
       d_user_provided_mat(false), d_user_provided_pc(false), d_nullspace_constant_vec(NULL),
       d_petsc_nullspace_constant_vec(NULL), d_petsc_nullspace_basis_vecs(),
-      d_solver_has_attached_nullspace(false)
+      d_solver_has_attached_nullspace(false), d_recycled_subspace_size(0), d_recycled_x_vecs(),
+      d_recycled_Ax_vecs()
 {
     GeneralSolver::init(object_name, /*homogeneous_bc*/ false);
     if (d_petsc_ksp) resetWrappedKSP(d_petsc_ksp);
@@ -133,6 +137,7 @@ PETScKrylovLinearSolver::PETScKrylovLinearSolver(const std::string& object_name,
 PETScKrylovLinearSolver::~PETScKrylovLinearSolver()
 {
     if (d_is_initialized) deallocateSolverState();
+    resetRecycledSubspace();
 
     // Delete allocated PETSc solver components.
     int ierr;
@@ -163,6 +168,43 @@ void PETScKrylovLinearSolver::setOptionsPrefix(const std::string& options_prefix
     return;
 } // setOptionsPrefix
 
+void PETScKrylovLinearSolver::setRecycledSubspaceSize(const int recycled_subspace_size)
+{
+    if (recycled_subspace_size < 0)
+    {
+        TBOX_ERROR(d_object_name << "::setRecycledSubspaceSize()\n"
+                                 << "  recycled subspace size must be nonnegative"
+                                 << std::endl);
+    }
+    d_recycled_subspace_size = recycled_subspace_size;
+    while (static_cast<int>(d_recycled_x_vecs.size()) > d_recycled_subspace_size)
+    {
+        d_recycled_x_vecs.front()->deallocateVectorData();
+        d_recycled_x_vecs.front()->freeVectorComponents();
+        d_recycled_x_vecs.pop_front();
+        d_recycled_Ax_vecs.front()->deallocateVectorData();
+        d_recycled_Ax_vecs.front()->freeVectorComponents();
+        d_recycled_Ax_vecs.pop_front();
+    }
+    if (d_recycled_x_vecs.empty()) d_recycled_subspace_levels.clear();
+    return;
+} // setRecycledSubspaceSize
+
+void PETScKrylovLinearSolver::resetRecycledSubspace()
+{
+    for (unsigned int k = 0; k < d_recycled_x_vecs.size(); ++k)
+    {
+        d_recycled_x_vecs[k]->deallocateVectorData();
+        d_recycled_x_vecs[k]->freeVectorComponents();
+        d_recycled_Ax_vecs[k]->deallocateVectorData();
+        d_recycled_Ax_vecs[k]->freeVectorComponents();
+    }
+    d_recycled_x_vecs.clear();
+    d_recycled_Ax_vecs.clear();
+    d_recycled_subspace_levels.clear();
+    return;
+} // resetRecycledSubspace
+
 const KSP& PETScKrylovLinearSolver::getPETScKSP() const
 {
     return d_petsc_ksp;
@@ -231,6 +273,13 @@ bool PETScKrylovLinearSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x,
         PETScSAMRAIVectorReal::replaceSAMRAIVector(d_petsc_b, d_b);
         d_A->setHomogeneousBc(true);
     }
+    const bool use_recycled_subspace = d_recycled_subspace_size > 0;
+    if (use_recycled_subspace &&
+        applyRecycledSubspace(x, *PETScSAMRAIVectorReal::getSAMRAIVector(d_petsc_b)))
+    {
+        ierr = KSPSetInitialGuessNonzero(d_petsc_ksp, PETSC_TRUE);
+        IBTK_CHKERRQ(ierr);
+    }
     ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(d_petsc_x));
     IBTK_CHKERRQ(ierr);
     ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(d_petsc_b));
@@ -241,6 +290,7 @@ bool PETScKrylovLinearSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x,
     IBTK_CHKERRQ(ierr);
     ierr = KSPGetResidualNorm(d_petsc_ksp, &d_current_residual_norm);
     IBTK_CHKERRQ(ierr);
+    if (use_recycled_subspace) updateRecycledSubspace(x);
     d_A->setHomogeneousBc(d_homogeneous_bc);
 
     // Determine the convergence reason.
@@ -328,6 +378,26 @@ void PETScKrylovLinearSolver::initializeSolverState(const SAMRAIVectorReal<NDIM,
         deallocateSolverState();
     }
 
+    // Discard any recycled vectors if the hierarchy configuration has changed
+    // since they were computed.  The recycled vectors are retained across
+    // calls to deallocateSolverState() so that they may be reused by solvers
+    // that are initialized and deallocated within each call to solveSystem().
+    if (!d_recycled_subspace_levels.empty())
+    {
+        bool same_configuration =
+            static_cast<int>(d_recycled_subspace_levels.size()) ==
+            x.getFinestLevelNumber() - x.getCoarsestLevelNumber() + 1;
+        for (int ln = x.getCoarsestLevelNumber();
+             ln <= x.getFinestLevelNumber() && same_configuration;
+             ++ln)
+        {
+            same_configuration =
+                d_recycled_subspace_levels[ln - x.getCoarsestLevelNumber()] ==
+                x.getPatchHierarchy()->getPatchLevel(ln);
+        }
+        if (!same_configuration) resetRecycledSubspace();
+    }
+
     // Create the KSP solver.
     if (d_managing_petsc_ksp)
     {
@@ -590,8 +660,13 @@ void PETScKrylovLinearSolver::resetKSPOptions()
     ierr = KSPSetType(d_petsc_ksp, ksp_type);
     IBTK_CHKERRQ(ierr);
     std::string ksp_type_name(ksp_type);
-    if (ksp_type_name.find("gmres") != std::string::npos)
+    const bool is_pipelined_ksp_type = ksp_type_name.find("pipe") != std::string::npos ||
+                                       ksp_type_name == "pgmres";
+    if (ksp_type_name.find("gmres") != std::string::npos && !is_pipelined_ksp_type)
     {
+        // NOTE: The pipelined GMRES variants perform their own orthogonalization
+        // with a single non-blocking reduction per iteration, so we do not
+        // request (potentially blocking) iterative refinement for them.
         ierr = KSPGMRESSetCGSRefinementType(d_petsc_ksp, KSP_GMRES_CGS_REFINE_IFNEEDED);
         IBTK_CHKERRQ(ierr);
     }
@@ -792,6 +867,90 @@ void PETScKrylovLinearSolver::deallocateNullspaceData()
     return;
 } // deallocateNullspaceData
 
+bool PETScKrylovLinearSolver::applyRecycledSubspace(SAMRAIVectorReal<NDIM, double>& x,
+                                                    SAMRAIVectorReal<NDIM, double>& b)
+{
+    if (d_recycled_x_vecs.empty()) return false;
+
+    // Compute the initial residual r = b - A*x.
+    Pointer<SAMRAIVectorReal<NDIM, double> > x_vec(&x, false);
+    Pointer<SAMRAIVectorReal<NDIM, double> > b_vec(&b, false);
+    Pointer<SAMRAIVectorReal<NDIM, double> > r_vec = x.cloneVector(x.getName());
+    r_vec->allocateVectorData();
+    if (d_initial_guess_nonzero)
+    {
+        d_A->apply(x, *r_vec);
+        r_vec->subtract(b_vec, r_vec);
+    }
+    else
+    {
+        x.setToScalar(0.0);
+        r_vec->copyVector(b_vec);
+    }
+
+    // Because the images A*v_k of the recycled vectors are orthonormal, the
+    // residual is minimized over span{v_k} by projecting r onto span{A*v_k}.
+    for (unsigned int k = 0; k < d_recycled_x_vecs.size(); ++k)
+    {
+        const double alpha = r_vec->dot(d_recycled_Ax_vecs[k]);
+        x.axpy(alpha, d_recycled_x_vecs[k], x_vec);
+        r_vec->axpy(-alpha, d_recycled_Ax_vecs[k], r_vec);
+    }
+    r_vec->deallocateVectorData();
+    r_vec->freeVectorComponents();
+    return true;
+} // applyRecycledSubspace
+
+void PETScKrylovLinearSolver::updateRecycledSubspace(SAMRAIVectorReal<NDIM, double>& x)
+{
+    Pointer<SAMRAIVectorReal<NDIM, double> > v_vec = x.cloneVector(x.getName());
+    Pointer<SAMRAIVectorReal<NDIM, double> > Av_vec = x.cloneVector(x.getName());
+    v_vec->allocateVectorData();
+    Av_vec->allocateVectorData();
+    v_vec->copyVector(Pointer<SAMRAIVectorReal<NDIM, double> >(&x, false));
+    d_A->apply(*v_vec, *Av_vec);
+
+    // Orthonormalize A*v against the images of the previously retained
+    // vectors (using modified Gram-Schmidt), and apply the same
+    // transformation to v.
+    const double Av_norm = std::sqrt(Av_vec->dot(Av_vec));
+    for (unsigned int k = 0; k < d_recycled_x_vecs.size(); ++k)
+    {
+        const double alpha = Av_vec->dot(d_recycled_Ax_vecs[k]);
+        Av_vec->axpy(-alpha, d_recycled_Ax_vecs[k], Av_vec);
+        v_vec->axpy(-alpha, d_recycled_x_vecs[k], v_vec);
+    }
+    const double Av_orth_norm = std::sqrt(Av_vec->dot(Av_vec));
+    static const double eps = 1.0e-8;
+    if (Av_orth_norm <= eps * Av_norm)
+    {
+        // The new vector is (nearly) contained in the recycled subspace.
+        v_vec->deallocateVectorData();
+        v_vec->freeVectorComponents();
+        Av_vec->deallocateVectorData();
+        Av_vec->freeVectorComponents();
+        return;
+    }
+    v_vec->scale(1.0 / Av_orth_norm, v_vec);
+    Av_vec->scale(1.0 / Av_orth_norm, Av_vec);
+    if (d_recycled_x_vecs.empty())
+    {
+        // Record the patch levels on which the recycled vectors are allocated.
+        d_recycled_subspace_levels.clear();
+        for (int ln = x.getCoarsestLevelNumber(); ln <= x.getFinestLevelNumber(); ++ln)
+        {
+            d_recycled_subspace_levels.push_back(x.getPatchHierarchy()->getPatchLevel(ln));
+        }
+    }
+    d_recycled_x_vecs.push_back(v_vec);
+    d_recycled_Ax_vecs.push_back(Av_vec);
+
+    // Discard the oldest vectors.  Because the retained images remain
+    // orthonormal, no further orthogonalization is required.
+    setRecycledSubspaceSize(d_recycled_subspace_size);
+    return;
+} // updateRecycledSubspace
+
 PetscErrorCode PETScKrylovLinearSolver::MatVecMult_SAMRAI(Mat A, Vec x, Vec y)
 {
     int ierr;
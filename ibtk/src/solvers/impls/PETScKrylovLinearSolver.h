@@ -36,12 +36,14 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <stddef.h>
+#include <deque>
 #include <iosfwd>
 #include <string>
 #include <vector>
 
 #include "IntVector.h"
 #include "MultiblockDataTranslator.h"
+#include "PatchLevel.h"
 #include "SAMRAIVectorReal.h"
 #include "ibtk/KrylovLinearSolver.h"
 #include "ibtk/LinearSolver.h"
@@ -82,6 +84,14 @@ namespace IBTK
  * for a complete list of the Krylov solvers provided by this class.  Note that
  * solver configuration is typically done at runtime via command line options.
  *
+ * Communication-reducing pipelined Krylov methods (e.g., ksp_type = "pgmres",
+ * "pipecg", "pipecr", or "pipefgmres", depending on the version of PETSc) may
+ * also be used.  These methods overlap their global reductions with operator
+ * and preconditioner applications via PETSc's split-phase reduction interface
+ * (VecDotBegin()/VecDotEnd(), VecMDotBegin()/VecMDotEnd(), etc.), which is
+ * supported by the local reduction operations provided by class
+ * PETScSAMRAIVectorReal.
+ *
  * \note
  * - Preconditioners and direct solvers provided by PETSc \em cannot be used
  *   within the present IBTK solver framework.  However, this <em>does not
@@ -111,6 +121,7 @@ namespace IBTK
  abs_residual_tol = 1.0e-50    // see setAbsoluteTolerance()
  max_iterations = 10000        // see setMaxIterations()
  enable_logging = FALSE        // see setLoggingEnabled()
+ recycled_subspace_size = 0    // see setRecycledSubspaceSize()
  \endverbatim
  *
  * PETSc is developed in the Mathematics and Computer Science (MCS) Division at
@@ -170,6 +181,31 @@ public:
      */
     void setOptionsPrefix(const std::string& options_prefix);
 
+    /*!
+     * \brief Set the maximum number of vectors retained between solves and
+     * used to construct improved initial guesses.
+     *
+     * When this value is positive, the solver retains a basis for the span of
+     * the most recently computed solutions, orthonormalized with respect to the
+     * image of the linear operator.  Before each subsequent solve, the initial
+     * guess is corrected to minimize the residual over this subspace.  This can
+     * substantially reduce the number of iterations required to solve
+     * sequences of closely related linear systems, such as those arising at
+     * successive timesteps, at the cost of one or two additional operator
+     * applications per solve and storage for twice as many vectors.
+     *
+     * \note The retained vectors are discarded when the solver state is
+     * initialized on a hierarchy configuration that differs from the one on
+     * which they were computed, e.g., following regridding.
+     */
+    void setRecycledSubspaceSize(int recycled_subspace_size);
+
+    /*!
+     * \brief Discard all vectors retained between solves, e.g., after the linear
+     * operator has changed substantially.
+     */
+    void resetRecycledSubspace();
+
     /*!
      * \name Functions to access the underlying PETSc objects.
      */
@@ -388,6 +424,21 @@ private:
      */
     void deallocateNullspaceData();
 
+    /*!
+     * \brief Correct the initial guess \a x to minimize the residual of the
+     * (homogeneous) system over the recycled subspace.
+     *
+     * \return \p true if the initial guess was modified, \p false otherwise.
+     */
+    bool applyRecycledSubspace(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                               SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
+
+    /*!
+     * \brief Add the solution \a x to the recycled subspace, discarding the
+     * oldest retained vectors as needed.
+     */
+    void updateRecycledSubspace(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x);
+
     /*!
      * \name Static functions for use by PETSc KSP and MatShell objects.
      */
@@ -426,6 +477,12 @@ private:
     Vec d_petsc_nullspace_constant_vec;
     std::vector<Vec> d_petsc_nullspace_basis_vecs;
     bool d_solver_has_attached_nullspace;
+
+    int d_recycled_subspace_size;
+    std::deque<SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > >
+        d_recycled_x_vecs, d_recycled_Ax_vecs;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > >
+        d_recycled_subspace_levels;
 };
 } // namespace IBTK
 
@@ -36,6 +36,7 @@
 #include <stddef.h>
 #include <algorithm>
 #include <ostream>
+#include <vector>
 
 #include "PETScMultiVec.h"
 #include "ibtk/ibtk_utilities.h"
@@ -122,8 +123,13 @@ PetscErrorCode VecDot_MultiVec(Vec x, Vec y, PetscScalar* val)
 } // VecDot_MultiVec
 
 #undef __FUNCT__
-#define __FUNCT__ "VecMDot_MultiVec"
-PetscErrorCode VecMDot_MultiVec(Vec x, PetscInt nv, const Vec* y, PetscScalar* val)
+#define __FUNCT__ "VecMultiDot_MultiVec"
+PetscErrorCode VecMultiDot_MultiVec(Vec x,
+                                    PetscInt nv,
+                                    const Vec* y,
+                                    PetscScalar* val,
+                                    bool transpose,
+                                    bool local_only)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(x);
@@ -132,13 +138,86 @@ PetscErrorCode VecMDot_MultiVec(Vec x, PetscInt nv, const Vec* y, PetscScalar* v
         TBOX_ASSERT(y[i]);
     }
 #endif
+    Vec_MultiVec* mx = static_cast<Vec_MultiVec*>(x->data);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(mx);
+#endif
+    std::fill(val, val + nv, 0.0);
+    if (nv == 0) PetscFunctionReturn(0);
+
+    // Compute the local multi-inner products component-by-component, so that
+    // each component vector can use its own fused kernel, and then combine the
+    // results with a single global reduction.  If any component does not
+    // provide local multi-inner products, we fall back on one (batched) global
+    // reduction per component.  That fallback cannot produce local partial
+    // sums, and so it is an error to request them in that case.
+    bool use_local_ops = true;
+    for (PetscInt k = 0; k < mx->n; ++k)
+    {
+        struct _VecOps* ops = mx->array[k]->ops;
+        use_local_ops = use_local_ops && (transpose ? ops->mtdot_local : ops->mdot_local);
+    }
+    if (local_only && !use_local_ops)
+    {
+        TBOX_ERROR("VecMultiDot_MultiVec():\n"
+                   << "  local multi-inner products requested, but not all component "
+                      "vectors provide local multi-inner products."
+                   << std::endl);
+    }
     PetscErrorCode ierr;
-    for (PetscInt i = 0; i < nv; ++i)
+    std::vector<Vec> y_comps(nv);
+    std::vector<PetscScalar> comp_val(nv);
+    for (PetscInt k = 0; k < mx->n; ++k)
+    {
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            Vec_MultiVec* my = static_cast<Vec_MultiVec*>(y[i]->data);
+#if !defined(NDEBUG)
+            TBOX_ASSERT(my);
+            TBOX_ASSERT(mx->n == my->n);
+#endif
+            y_comps[i] = my->array[k];
+        }
+        if (use_local_ops)
+        {
+            struct _VecOps* ops = mx->array[k]->ops;
+            ierr = (*(transpose ? ops->mtdot_local : ops->mdot_local))(
+                mx->array[k], nv, &y_comps[0], &comp_val[0]);
+        }
+        else if (transpose)
+        {
+            ierr = VecMTDot(mx->array[k], nv, &y_comps[0], &comp_val[0]);
+        }
+        else
+        {
+            ierr = VecMDot(mx->array[k], nv, &y_comps[0], &comp_val[0]);
+        }
+        CHKERRQ(ierr);
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            val[i] += comp_val[i];
+        }
+    }
+    if (use_local_ops && !local_only)
     {
-        ierr = VecDot_MultiVec(x, y[i], &val[i]);
+        MPI_Comm comm;
+        ierr = PetscObjectGetComm(reinterpret_cast<PetscObject>(x), &comm);
+        CHKERRQ(ierr);
+        ierr = MPI_Allreduce(MPI_IN_PLACE, val, nv, MPIU_SCALAR, MPIU_SUM, comm);
         CHKERRQ(ierr);
     }
     PetscFunctionReturn(0);
+} // VecMultiDot_MultiVec
+
+#undef __FUNCT__
+#define __FUNCT__ "VecMDot_MultiVec"
+PetscErrorCode VecMDot_MultiVec(Vec x, PetscInt nv, const Vec* y, PetscScalar* val)
+{
+    static const bool transpose = false;
+    static const bool local_only = false;
+    PetscErrorCode ierr = VecMultiDot_MultiVec(x, nv, y, val, transpose, local_only);
+    CHKERRQ(ierr);
+    PetscFunctionReturn(0);
 } // VecMDot_MultiVec
 
 #undef __FUNCT__
@@ -228,19 +307,10 @@ PetscErrorCode VecTDot_MultiVec(Vec x, Vec y, PetscScalar* val)
 #define __FUNCT__ "VecMTDot_MultiVec"
 PetscErrorCode VecMTDot_MultiVec(Vec x, PetscInt nv, const Vec* y, PetscScalar* val)
 {
-#if !defined(NDEBUG)
-    TBOX_ASSERT(x);
-    for (PetscInt i = 0; i < nv; ++i)
-    {
-        TBOX_ASSERT(y[i]);
-    }
-#endif
-    PetscErrorCode ierr;
-    for (PetscInt i = 0; i < nv; ++i)
-    {
-        ierr = VecTDot_MultiVec(x, y[i], &val[i]);
-        CHKERRQ(ierr);
-    }
+    static const bool transpose = true;
+    static const bool local_only = false;
+    PetscErrorCode ierr = VecMultiDot_MultiVec(x, nv, y, val, transpose, local_only);
+    CHKERRQ(ierr);
     PetscFunctionReturn(0);
 } // VecMTDot_MultiVec
 
@@ -405,10 +475,27 @@ PetscErrorCode VecMAXPY_MultiVec(Vec y, PetscInt nv, const PetscScalar* alpha, V
         TBOX_ASSERT(x[i]);
     }
 #endif
+    Vec_MultiVec* my = static_cast<Vec_MultiVec*>(y->data);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(my);
+#endif
+    if (nv == 0) PetscFunctionReturn(0);
+
+    // Update each component with a single (fused) multi-AXPY operation.
     PetscErrorCode ierr;
-    for (PetscInt i = 0; i < nv; ++i)
+    std::vector<Vec> x_comps(nv);
+    for (PetscInt k = 0; k < my->n; ++k)
     {
-        ierr = VecAXPY_MultiVec(y, alpha[i], x[i]);
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            Vec_MultiVec* mx = static_cast<Vec_MultiVec*>(x[i]->data);
+#if !defined(NDEBUG)
+            TBOX_ASSERT(mx);
+            TBOX_ASSERT(my->n == mx->n);
+#endif
+            x_comps[i] = mx->array[k];
+        }
+        ierr = VecMAXPY(my->array[k], nv, alpha, &x_comps[0]);
         CHKERRQ(ierr);
     }
     ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(y));
@@ -822,19 +909,10 @@ PetscErrorCode VecNorm_local_MultiVec(Vec x, NormType type, PetscScalar* val)
 #define __FUNCT__ "VecMDot_local_MultiVec"
 PetscErrorCode VecMDot_local_MultiVec(Vec x, PetscInt nv, const Vec* y, PetscScalar* val)
 {
-#if !defined(NDEBUG)
-    TBOX_ASSERT(x);
-    for (PetscInt i = 0; i < nv; ++i)
-    {
-        TBOX_ASSERT(y[i]);
-    }
-#endif
-    PetscErrorCode ierr;
-    for (PetscInt i = 0; i < nv; ++i)
-    {
-        ierr = VecDot_local_MultiVec(x, y[i], &val[i]);
-        CHKERRQ(ierr);
-    }
+    static const bool transpose = false;
+    static const bool local_only = true;
+    PetscErrorCode ierr = VecMultiDot_MultiVec(x, nv, y, val, transpose, local_only);
+    CHKERRQ(ierr);
     PetscFunctionReturn(0);
 } // VecMDot_local_MultiVec
 
@@ -842,19 +920,10 @@ PetscErrorCode VecMDot_local_MultiVec(Vec x, PetscInt nv, const Vec* y, PetscSca
 #define __FUNCT__ "VecMTDot_local_MultiVec"
 PetscErrorCode VecMTDot_local_MultiVec(Vec x, PetscInt nv, const Vec* y, PetscScalar* val)
 {
-#if !defined(NDEBUG)
-    TBOX_ASSERT(x);
-    for (PetscInt i = 0; i < nv; ++i)
-    {
-        TBOX_ASSERT(y[i]);
-    }
-#endif
-    PetscErrorCode ierr;
-    for (PetscInt i = 0; i < nv; ++i)
-    {
-        ierr = VecTDot_local_MultiVec(x, y[i], &val[i]);
-        CHKERRQ(ierr);
-    }
+    static const bool transpose = true;
+    static const bool local_only = true;
+    PetscErrorCode ierr = VecMultiDot_MultiVec(x, nv, y, val, transpose, local_only);
+    CHKERRQ(ierr);
     PetscFunctionReturn(0);
 } // VecMTDot_local_MultiVec
 
@@ -43,7 +43,6 @@
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CoarsenOperator.h"
-#include "HierarchySideDataOpsReal.h"
 #include "IBTK_config.h"
 #include "IntVector.h"
 #include "MultiblockDataTranslator.h"
@@ -748,11 +747,15 @@ void SCPoissonPointRelaxationFACOperator::computeResidual(
         d_level_math_ops[finest_level_num] = new HierarchyMathOps(
             stream.str(), d_hierarchy, coarsest_level_num, finest_level_num);
     }
-    d_level_math_ops[finest_level_num]->laplace(
-        res_idx, res_var, d_poisson_spec, sol_idx, sol_var, NULL, d_solution_time);
-    HierarchySideDataOpsReal<NDIM, double> hier_sc_data_ops(
-        d_hierarchy, coarsest_level_num, finest_level_num);
-    hier_sc_data_ops.axpy(res_idx, -1.0, res_idx, rhs_idx, false);
+    d_level_math_ops[finest_level_num]->laplaceResidual(res_idx,
+                                                        res_var,
+                                                        rhs_idx,
+                                                        rhs_var,
+                                                        d_poisson_spec,
+                                                        sol_idx,
+                                                        sol_var,
+                                                        NULL,
+                                                        d_solution_time);
 
     IBTK_TIMER_STOP(t_compute_residual);
     return;
@@ -35,9 +35,24 @@
 #include <math.h>
 #include <algorithm>
 #include <ostream>
+#include <vector>
 
+#include "ArrayData.h"
+#include "Box.h"
+#include "CellData.h"
+#include "CellVariable.h"
+#include "Index.h"
+#include "IntVector.h"
 #include "PETScSAMRAIVectorReal.h"
+#include "Patch.h"
+#include "PatchDescriptor.h"
 #include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "SideData.h"
+#include "SideGeometry.h"
+#include "SideVariable.h"
+#include "Variable.h"
+#include "VariableDatabase.h"
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/NormOps.h"
 #include "ibtk/PETScSAMRAIVectorReal.h"
@@ -102,6 +117,309 @@ static Timer* t_vec_dot_norm2;
 #define PSVR_CAST1(v) (static_cast<PETScSAMRAIVectorReal*>(v->data))
 #define PSVR_CAST2(v) (PETScSAMRAIVectorReal::getSAMRAIVector(v))
 
+// Number of entries processed at a time by the fused multi-vector kernels.
+static const int FUSED_KERNEL_BLOCK_SZ = 256;
+
+inline int array_index_offset(const Box<NDIM>& array_box, const Index<NDIM>& i)
+{
+    int offset = 0;
+    int stride = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        offset += (i(d) - array_box.lower(d)) * stride;
+        stride *= array_box.numberCells(d);
+    }
+    return offset;
+} // array_index_offset
+
+// Determine whether the fused multi-vector kernels can be used with x and
+// y[0],...,y[nv-1].  We require that all vectors share the same structure,
+// that all components are cell- or side-centered, and (when computing inner
+// products) that all components of x have control volume weights.
+bool use_fused_kernels(Pointer<SAMRAIVectorReal<NDIM, PetscScalar> > x,
+                       PetscInt nv,
+                       const Vec* y,
+                       bool require_cvol)
+{
+    if (nv < 2) return false;
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<PatchDescriptor<NDIM> > pdesc = var_db->getPatchDescriptor();
+    const int ncomp = x->getNumberOfComponents();
+    for (PetscInt i = 0; i < nv; ++i)
+    {
+        Pointer<SAMRAIVectorReal<NDIM, PetscScalar> > y_vec = PSVR_CAST2(y[i]);
+        if (y_vec->getPatchHierarchy().getPointer() != x->getPatchHierarchy().getPointer() ||
+            y_vec->getCoarsestLevelNumber() != x->getCoarsestLevelNumber() ||
+            y_vec->getFinestLevelNumber() != x->getFinestLevelNumber() ||
+            y_vec->getNumberOfComponents() != ncomp)
+        {
+            return false;
+        }
+    }
+    for (int comp = 0; comp < ncomp; ++comp)
+    {
+        Pointer<Variable<NDIM> > var = x->getComponentVariable(comp);
+        Pointer<CellVariable<NDIM, PetscScalar> > cc_var = var;
+        Pointer<SideVariable<NDIM, PetscScalar> > sc_var = var;
+        if (!cc_var && !sc_var) return false;
+        if (require_cvol && x->getControlVolumeIndex(comp) < 0) return false;
+        const int x_idx = x->getComponentDescriptorIndex(comp);
+        const IntVector<NDIM>& gcw = pdesc->getPatchDataFactory(x_idx)->getGhostCellWidth();
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            Pointer<SAMRAIVectorReal<NDIM, PetscScalar> > y_vec = PSVR_CAST2(y[i]);
+            const int y_idx = y_vec->getComponentDescriptorIndex(comp);
+            if (y_vec->getComponentVariable(comp).getPointer() != var.getPointer() ||
+                pdesc->getPatchDataFactory(y_idx)->getGhostCellWidth() != gcw)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+} // use_fused_kernels
+
+// Accumulate the control-volume weighted inner products of x with each of the
+// y arrays over the specified box.  Each cell value of x and cvol is loaded
+// only once and multiplied against the corresponding value of every y array.
+void accumulate_mdot(const ArrayData<NDIM, PetscScalar>& x_array,
+                     const std::vector<const ArrayData<NDIM, PetscScalar>*>& y_arrays,
+                     const ArrayData<NDIM, PetscScalar>& cvol_array,
+                     const Box<NDIM>& box,
+                     PetscScalar* val)
+{
+    if (box.empty()) return;
+    const int nv = static_cast<int>(y_arrays.size());
+    const Box<NDIM>& data_box = x_array.getBox();
+    const Box<NDIM>& cvol_box = cvol_array.getBox();
+    const int line_len = box.numberCells(0);
+    const int num_lines = box.size() / line_len;
+    const PetscScalar* const cvol = cvol_array.getPointer();
+#if !defined(NDEBUG)
+    for (int k = 0; k < nv; ++k)
+    {
+        TBOX_ASSERT(y_arrays[k]->getBox() == data_box);
+    }
+#endif
+    std::vector<const PetscScalar*> y_lines(nv);
+    std::vector<PetscScalar> sums(nv);
+    for (int depth = 0; depth < x_array.getDepth(); ++depth)
+    {
+        const PetscScalar* const x = x_array.getPointer(depth);
+        for (int line = 0; line < num_lines; ++line)
+        {
+            Index<NDIM> i = box.lower();
+            int r = line;
+            for (unsigned int d = 1; d < NDIM; ++d)
+            {
+                i(d) += r % box.numberCells(d);
+                r /= box.numberCells(d);
+            }
+            const int data_offset = array_index_offset(data_box, i);
+            const PetscScalar* const x_line = x + data_offset;
+            const PetscScalar* const cvol_line = cvol + array_index_offset(cvol_box, i);
+            for (int k = 0; k < nv; ++k)
+            {
+                y_lines[k] = y_arrays[k]->getPointer(depth) + data_offset;
+                sums[k] = 0.0;
+            }
+            for (int j = 0; j < line_len; ++j)
+            {
+                const PetscScalar w = cvol_line[j] * x_line[j];
+                for (int k = 0; k < nv; ++k)
+                {
+                    sums[k] += w * y_lines[k][j];
+                }
+            }
+            for (int k = 0; k < nv; ++k)
+            {
+                val[k] += sums[k];
+            }
+        }
+    }
+    return;
+} // accumulate_mdot
+
+// Compute the local parts of the inner products of x with y[0],...,y[nv-1] in a
+// single pass over the patch data of x.
+void fused_mdot_local(Pointer<SAMRAIVectorReal<NDIM, PetscScalar> > x,
+                      PetscInt nv,
+                      const Vec* y,
+                      PetscScalar* val)
+{
+    std::fill(val, val + nv, 0.0);
+    std::vector<Pointer<SAMRAIVectorReal<NDIM, PetscScalar> > > y_vecs(nv);
+    for (PetscInt i = 0; i < nv; ++i)
+    {
+        y_vecs[i] = PSVR_CAST2(y[i]);
+    }
+    std::vector<const ArrayData<NDIM, PetscScalar>*> y_arrays(nv);
+    Pointer<PatchHierarchy<NDIM> > hierarchy = x->getPatchHierarchy();
+    const int ncomp = x->getNumberOfComponents();
+    for (int ln = x->getCoarsestLevelNumber(); ln <= x->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            for (int comp = 0; comp < ncomp; ++comp)
+            {
+                const int x_idx = x->getComponentDescriptorIndex(comp);
+                const int cvol_idx = x->getControlVolumeIndex(comp);
+                Pointer<CellData<NDIM, PetscScalar> > x_cc_data = patch->getPatchData(x_idx);
+                Pointer<SideData<NDIM, PetscScalar> > x_sc_data = patch->getPatchData(x_idx);
+                if (x_cc_data)
+                {
+                    Pointer<CellData<NDIM, PetscScalar> > cvol_data =
+                        patch->getPatchData(cvol_idx);
+                    for (PetscInt i = 0; i < nv; ++i)
+                    {
+                        Pointer<CellData<NDIM, PetscScalar> > y_data =
+                            patch->getPatchData(y_vecs[i]->getComponentDescriptorIndex(comp));
+                        y_arrays[i] = &y_data->getArrayData();
+                    }
+                    accumulate_mdot(x_cc_data->getArrayData(),
+                                    y_arrays,
+                                    cvol_data->getArrayData(),
+                                    patch_box,
+                                    val);
+                }
+                else if (x_sc_data)
+                {
+                    Pointer<SideData<NDIM, PetscScalar> > cvol_data =
+                        patch->getPatchData(cvol_idx);
+                    for (unsigned int axis = 0; axis < NDIM; ++axis)
+                    {
+                        for (PetscInt i = 0; i < nv; ++i)
+                        {
+                            const int y_idx = y_vecs[i]->getComponentDescriptorIndex(comp);
+                            Pointer<SideData<NDIM, PetscScalar> > y_data =
+                                patch->getPatchData(y_idx);
+                            y_arrays[i] = &y_data->getArrayData(axis);
+                        }
+                        accumulate_mdot(x_sc_data->getArrayData(axis),
+                                        y_arrays,
+                                        cvol_data->getArrayData(axis),
+                                        SideGeometry<NDIM>::toSideBox(patch_box, axis),
+                                        val);
+                    }
+                }
+                else
+                {
+                    TBOX_ERROR("PETScSAMRAIVectorReal::fused_mdot_local()\n"
+                               << "  unsupported patch data type" << std::endl);
+                }
+            }
+        }
+    }
+    return;
+} // fused_mdot_local
+
+// Compute y := y + sum_k alpha_k x_k over the ghost boxes of each patch data
+// array, blocking the update so that each block of y is loaded only once.
+void accumulate_maxpy(ArrayData<NDIM, PetscScalar>& y_array,
+                      const std::vector<const ArrayData<NDIM, PetscScalar>*>& x_arrays,
+                      const PetscScalar* alpha)
+{
+    const int nv = static_cast<int>(x_arrays.size());
+    const int n = y_array.getDepth() * y_array.getOffset();
+    PetscScalar* const y = y_array.getPointer();
+    for (int j0 = 0; j0 < n; j0 += FUSED_KERNEL_BLOCK_SZ)
+    {
+        const int j1 = std::min(j0 + FUSED_KERNEL_BLOCK_SZ, n);
+        for (int k = 0; k < nv; ++k)
+        {
+#if !defined(NDEBUG)
+            TBOX_ASSERT(x_arrays[k]->getBox() == y_array.getBox());
+#endif
+            const PetscScalar a = alpha[k];
+            const PetscScalar* const x = x_arrays[k]->getPointer();
+            for (int j = j0; j < j1; ++j)
+            {
+                y[j] += a * x[j];
+            }
+        }
+    }
+    return;
+} // accumulate_maxpy
+
+void fused_maxpy(Pointer<SAMRAIVectorReal<NDIM, PetscScalar> > y,
+                 PetscInt nv,
+                 const PetscScalar* alpha,
+                 const Vec* x)
+{
+    std::vector<Pointer<SAMRAIVectorReal<NDIM, PetscScalar> > > x_vecs(nv);
+    for (PetscInt i = 0; i < nv; ++i)
+    {
+        x_vecs[i] = PSVR_CAST2(x[i]);
+    }
+    std::vector<const ArrayData<NDIM, PetscScalar>*> x_arrays(nv);
+    Pointer<PatchHierarchy<NDIM> > hierarchy = y->getPatchHierarchy();
+    const int ncomp = y->getNumberOfComponents();
+    for (int ln = y->getCoarsestLevelNumber(); ln <= y->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            for (int comp = 0; comp < ncomp; ++comp)
+            {
+                const int y_idx = y->getComponentDescriptorIndex(comp);
+                Pointer<CellData<NDIM, PetscScalar> > y_cc_data = patch->getPatchData(y_idx);
+                Pointer<SideData<NDIM, PetscScalar> > y_sc_data = patch->getPatchData(y_idx);
+                if (y_cc_data)
+                {
+                    for (PetscInt i = 0; i < nv; ++i)
+                    {
+                        Pointer<CellData<NDIM, PetscScalar> > x_data =
+                            patch->getPatchData(x_vecs[i]->getComponentDescriptorIndex(comp));
+                        x_arrays[i] = &x_data->getArrayData();
+                    }
+                    accumulate_maxpy(y_cc_data->getArrayData(), x_arrays, alpha);
+                }
+                else if (y_sc_data)
+                {
+                    for (unsigned int axis = 0; axis < NDIM; ++axis)
+                    {
+                        for (PetscInt i = 0; i < nv; ++i)
+                        {
+                            const int x_idx = x_vecs[i]->getComponentDescriptorIndex(comp);
+                            Pointer<SideData<NDIM, PetscScalar> > x_data =
+                                patch->getPatchData(x_idx);
+                            x_arrays[i] = &x_data->getArrayData(axis);
+                        }
+                        accumulate_maxpy(y_sc_data->getArrayData(axis), x_arrays, alpha);
+                    }
+                }
+                else
+                {
+                    TBOX_ERROR("PETScSAMRAIVectorReal::fused_maxpy()\n"
+                               << "  unsupported patch data type" << std::endl);
+                }
+            }
+        }
+    }
+    return;
+} // fused_maxpy
+
+// Compute the local parts of the inner products of x with y[0],...,y[nv-1].
+void mdot_local(Vec x, PetscInt nv, const Vec* y, PetscScalar* val)
+{
+    static const bool require_cvol = true;
+    if (use_fused_kernels(PSVR_CAST2(x), nv, y, require_cvol))
+    {
+        fused_mdot_local(PSVR_CAST2(x), nv, y, val);
+        return;
+    }
+    static const bool local_only = true;
+    for (PetscInt i = 0; i < nv; ++i)
+    {
+        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+    }
+    return;
+} // mdot_local
+
 PetscErrorCode VecDot_SAMRAI(Vec x, Vec y, PetscScalar* val)
 {
     IBTK_TIMER_START(t_vec_dot);
@@ -124,11 +442,7 @@ PetscErrorCode VecMDot_SAMRAI(Vec x, PetscInt nv, const Vec* y, PetscScalar* val
         TBOX_ASSERT(y[i]);
     }
 #endif
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
-    {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
-    }
+    mdot_local(x, nv, y, val);
     SAMRAI_MPI::sumReduction(val, nv);
     IBTK_TIMER_STOP(t_vec_m_dot);
     PetscFunctionReturn(0);
@@ -193,11 +507,7 @@ PetscErrorCode VecMTDot_SAMRAI(Vec x, PetscInt nv, const Vec* y, PetscScalar* va
         TBOX_ASSERT(y[i]);
     }
 #endif
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
-    {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
-    }
+    mdot_local(x, nv, y, val);
     SAMRAI_MPI::sumReduction(val, nv);
     IBTK_TIMER_STOP(t_vec_m_t_dot);
     PetscFunctionReturn(0);
@@ -330,6 +640,15 @@ PetscErrorCode VecMAXPY_SAMRAI(Vec y, PetscInt nv, const PetscScalar* alpha, Vec
         TBOX_ASSERT(x[i]);
     }
 #endif
+    static const bool require_cvol = false;
+    if (use_fused_kernels(PSVR_CAST2(y), nv, x, require_cvol))
+    {
+        fused_maxpy(PSVR_CAST2(y), nv, alpha, x);
+        int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(y));
+        IBTK_CHKERRQ(ierr);
+        IBTK_TIMER_STOP(t_vec_maxpy);
+        PetscFunctionReturn(0);
+    }
     static const bool interior_only = false;
     for (PetscInt i = 0; i < nv; ++i)
     {
@@ -588,11 +907,7 @@ PetscErrorCode VecMDot_local_SAMRAI(Vec x, PetscInt nv, const Vec* y, PetscScala
         TBOX_ASSERT(y[i]);
     }
 #endif
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
-    {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
-    }
+    mdot_local(x, nv, y, val);
     IBTK_TIMER_STOP(t_vec_m_dot_local);
     PetscFunctionReturn(0);
 } // VecMDot_local
@@ -607,11 +922,7 @@ PetscErrorCode VecMTDot_local_SAMRAI(Vec x, PetscInt nv, const Vec* y, PetscScal
         TBOX_ASSERT(y[i]);
     }
 #endif
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
-    {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
-    }
+    mdot_local(x, nv, y, val);
     IBTK_TIMER_STOP(t_vec_m_t_dot_local);
     PetscFunctionReturn(0);
 } // VecMTDot_local
@@ -635,8 +946,13 @@ PetscErrorCode VecDotNorm2_SAMRAI(Vec s, Vec t, PetscScalar* dp, PetscScalar* nm
     TBOX_ASSERT(s);
     TBOX_ASSERT(t);
 #endif
-    *dp = PSVR_CAST2(s)->dot(PSVR_CAST2(t));
-    *nm = PSVR_CAST2(t)->dot(PSVR_CAST2(t));
+    static const bool local_only = true;
+    PetscScalar val[2];
+    val[0] = PSVR_CAST2(s)->dot(PSVR_CAST2(t), local_only);
+    val[1] = PSVR_CAST2(t)->dot(PSVR_CAST2(t), local_only);
+    SAMRAI_MPI::sumReduction(val, 2);
+    *dp = val[0];
+    *nm = val[1];
     IBTK_TIMER_STOP(t_vec_dot_norm2);
     PetscFunctionReturn(0);
 } // VecDotNorm2_SAMRAI
@@ -33,6 +33,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <ostream>
 #include <utility>
@@ -41,18 +42,24 @@
 #include "Box.h"
 #include "CartesianGridGeometry.h"
 #include "CellData.h"
+#include "CellVariable.h"
 #include "CoarsenOperator.h"
 #include "CoarsenPatchStrategy.h"
 #include "EdgeData.h"
 #include "FaceData.h"
+#include "FaceVariable.h"
+#include "HierarchyDataOpsManager.h"
+#include "HierarchyDataOpsReal.h"
 #include "HierarchyIntegrator.h"
 #include "NodeData.h"
+#include "NodeVariable.h"
 #include "Patch.h"
 #include "PatchData.h"
 #include "PatchLevel.h"
 #include "RefineOperator.h"
 #include "RefinePatchStrategy.h"
 #include "SideData.h"
+#include "SideVariable.h"
 #include "TagAndInitializeStrategy.h"
 #include "Variable.h"
 #include "VariableDatabase.h"
@@ -75,6 +82,16 @@ namespace
 {
 // Version of HierarchyIntegrator restart file data.
 static const int HIERARCHY_INTEGRATOR_VERSION = 1;
+
+// Returns true if standard double-valued hierarchy data operations are
+// available for the specified variable.
+inline bool has_double_hier_data_ops(const Pointer<Variable<NDIM> >& var)
+{
+    return (Pointer<CellVariable<NDIM, double> >(var) ||
+            Pointer<FaceVariable<NDIM, double> >(var) ||
+            Pointer<NodeVariable<NDIM, double> >(var) ||
+            Pointer<SideVariable<NDIM, double> >(var));
+} // has_double_hier_data_ops
 }
 
 const std::string HierarchyIntegrator::SYNCH_CURRENT_DATA_ALG = "SYNCH_CURRENT_DATA";
@@ -115,6 +132,14 @@ HierarchyIntegrator::HierarchyIntegrator(const std::string& object_name,
     d_end_time = std::numeric_limits<double>::max();
     d_dt_max = std::numeric_limits<double>::max();
     d_dt_growth_factor = 2.0;
+    d_enable_adaptive_dt = false;
+    d_adaptive_dt_abs_tol = 1.0e-6;
+    d_adaptive_dt_rel_tol = 1.0e-3;
+    d_adaptive_dt_safety_factor = 0.9;
+    d_adaptive_dt_min_factor = 0.2;
+    d_adaptive_dt_max_factor = 2.0;
+    d_adaptive_dt_max_rejections = 4;
+    d_adaptive_dt_next = std::numeric_limits<double>::max();
     d_integrator_step = 0;
     d_num_cycles = 1;
     d_max_integrator_steps = std::numeric_limits<int>::max();
@@ -144,6 +169,7 @@ HierarchyIntegrator::HierarchyIntegrator(const std::string& object_name,
     d_current_context = var_db->getContext(d_object_name + "::CURRENT");
     d_new_context = var_db->getContext(d_object_name + "::NEW");
     d_scratch_context = var_db->getContext(d_object_name + "::SCRATCH");
+    d_error_estimate_context = var_db->getContext(d_object_name + "::ERROR_ESTIMATE");
 
     // Create default communications algorithms.
     d_coarsen_algs[SYNCH_CURRENT_DATA_ALG] = new CoarsenAlgorithm<NDIM>();
@@ -273,7 +299,7 @@ void HierarchyIntegrator::advanceHierarchy(double dt)
         dt = d_end_time - d_integrator_time;
     }
     const double current_time = d_integrator_time;
-    const double new_time = d_integrator_time + dt;
+    double new_time = d_integrator_time + dt;
     if (dt < 0.0)
     {
         TBOX_ERROR(d_object_name << "::advanceHierarchy():\n"
@@ -314,25 +340,91 @@ void HierarchyIntegrator::advanceHierarchy(double dt)
     d_current_num_cycles = getNumberOfCycles();
     d_current_dt = new_time - current_time;
 
-    // Execute the preprocessing method of the parent integrator, and
-    // recursively execute all preprocessing callbacks registered with the
-    // parent and child integrators.
-    preprocessIntegrateHierarchy(current_time, new_time, d_current_num_cycles);
+    // When adaptive time stepping is enabled, the final two cycles provide an
+    // embedded estimate of the local error.  Steps with excessive error are
+    // rejected and retried with a reduced time step size.
+    const bool use_error_estimate = d_enable_adaptive_dt && d_current_num_cycles > 1;
+    const bool can_reject_step = use_error_estimate && canResetIntegratorToPreadvanceState();
+    double error_estimate = 0.0;
+    int num_rejections = 0;
+    while (true)
+    {
+        // Execute the preprocessing method of the parent integrator, and
+        // recursively execute all preprocessing callbacks registered with the
+        // parent and child integrators.
+        preprocessIntegrateHierarchy(current_time, new_time, d_current_num_cycles);
+
+        // Perform one or more cycles.  In each cycle, execute the integration
+        // method of the parent integrator, and recursively execute all
+        // integration callbacks registered with the parent and child
+        // integrators.
+        if (d_enable_logging)
+            plog << d_object_name << "::advanceHierarchy(): integrating hierarchy\n";
+        for (int cycle_num = 0; cycle_num < d_current_num_cycles; ++cycle_num)
+        {
+            if (d_enable_logging && d_current_num_cycles != 1)
+            {
+                if (d_enable_logging)
+                    plog << d_object_name << "::advanceHierarchy(): executing cycle "
+                         << cycle_num + 1 << " of " << d_current_num_cycles << "\n";
+            }
+            integrateHierarchy(current_time, new_time, cycle_num);
+            if (use_error_estimate && cycle_num == d_current_num_cycles - 2)
+            {
+                storeEmbeddedErrorEstimateData();
+            }
+        }
+        if (!use_error_estimate) break;
 
-    // Perform one or more cycles.  In each cycle, execute the integration
-    // method of the parent integrator, and recursively execute all integration
-    // callbacks registered with the parent and child integrators.
-    if (d_enable_logging)
-        plog << d_object_name << "::advanceHierarchy(): integrating hierarchy\n";
-    for (int cycle_num = 0; cycle_num < d_current_num_cycles; ++cycle_num)
-    {
-        if (d_enable_logging && d_current_num_cycles != 1)
+        // Accept or reject the step.
+        error_estimate =
+            computeEmbeddedErrorEstimate(d_adaptive_dt_abs_tol, d_adaptive_dt_rel_tol);
+        if (d_enable_logging)
+            plog << d_object_name << "::advanceHierarchy(): scaled error estimate = "
+                 << error_estimate << "\n";
+        if (error_estimate <= 1.0) break;
+        if (!can_reject_step)
         {
             if (d_enable_logging)
-                plog << d_object_name << "::advanceHierarchy(): executing cycle "
-                     << cycle_num + 1 << " of " << d_current_num_cycles << "\n";
+                plog << d_object_name << "::advanceHierarchy(): accepting time step size dt = "
+                     << new_time - current_time
+                     << " because the integrator cannot be reset to its preadvance state\n";
+            break;
         }
-        integrateHierarchy(current_time, new_time, cycle_num);
+        if (num_rejections >= d_adaptive_dt_max_rejections)
+        {
+            pout << "WARNING: at time = " << d_integrator_time
+                 << ": accepting time step size dt = " << new_time - current_time
+                 << " with scaled error estimate = " << error_estimate << " after "
+                 << num_rejections << " rejected steps.\n";
+            break;
+        }
+        const double dt_factor =
+            std::max(d_adaptive_dt_min_factor,
+                     d_adaptive_dt_safety_factor * std::sqrt(1.0 / error_estimate));
+        if (d_enable_logging)
+            plog << d_object_name << "::advanceHierarchy(): rejecting time step size dt = "
+                 << new_time - current_time << "; retrying with dt = "
+                 << dt_factor * (new_time - current_time) << "\n";
+        resetIntegratorToPreadvanceState();
+        new_time = current_time + dt_factor * (new_time - current_time);
+        d_current_dt = new_time - current_time;
+        ++num_rejections;
+    }
+
+    // Determine the time step size suggested for the next step.  The factor
+    // assumes that the error estimate scales like dt^2, which is the case for
+    // the predictor-corrector and midpoint rule cycles used by the standard
+    // integrators.
+    if (use_error_estimate)
+    {
+        const double dt_factor =
+            error_estimate > 0.0 ?
+                d_adaptive_dt_safety_factor * std::sqrt(1.0 / error_estimate) :
+                d_adaptive_dt_max_factor;
+        d_adaptive_dt_next =
+            std::max(d_adaptive_dt_min_factor, std::min(d_adaptive_dt_max_factor, dt_factor)) *
+            (new_time - current_time);
     }
 
     // Execute the postprocessing method of the parent integrator, and
@@ -381,6 +473,7 @@ double HierarchyIntegrator::getMaximumTimeStepSize()
     {
         dt = std::min(dt, (*it)->getMaximumTimeStepSize());
     }
+    if (d_enable_adaptive_dt) dt = std::min(dt, d_adaptive_dt_next);
     return std::min(dt, d_end_time - d_integrator_time);
 } // getMaximumTimeStepSize
 
@@ -420,6 +513,18 @@ void HierarchyIntegrator::resetIntegratorToPreadvanceState()
     return;
 } // resetIntegratorToPreadvanceState
 
+bool HierarchyIntegrator::canResetIntegratorToPreadvanceState() const
+{
+    bool can_reset = canResetIntegratorToPreadvanceStateSpecialized();
+    for (std::set<HierarchyIntegrator*>::iterator it = d_child_integrators.begin();
+         it != d_child_integrators.end() && can_reset;
+         ++it)
+    {
+        can_reset = can_reset && (*it)->canResetIntegratorToPreadvanceState();
+    }
+    return can_reset;
+} // canResetIntegratorToPreadvanceState
+
 void HierarchyIntegrator::regridHierarchy()
 {
     const int coarsest_ln = 0;
@@ -1140,6 +1245,84 @@ void HierarchyIntegrator::resetIntegratorToPreadvanceStateSpecialized()
     return;
 } // resetIntegratorToPreadvanceStateSpecialized
 
+bool HierarchyIntegrator::canResetIntegratorToPreadvanceStateSpecialized() const
+{
+    return false;
+} // canResetIntegratorToPreadvanceStateSpecialized
+
+void HierarchyIntegrator::storeEmbeddedErrorEstimateDataSpecialized()
+{
+    const int coarsest_ln = 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+
+    // Allocate storage for the new values of the error estimate variables.
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        level->allocatePatchData(d_error_estimate_data, d_integrator_time);
+    }
+
+    // Copy the new values of the error estimate variables.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    for (std::list<Pointer<Variable<NDIM> > >::const_iterator ev =
+             d_error_estimate_variables.begin();
+         ev != d_error_estimate_variables.end();
+         ++ev)
+    {
+        const Pointer<Variable<NDIM> >& v = *ev;
+        const int new_idx = var_db->mapVariableAndContextToIndex(v, getNewContext());
+        const int est_idx = var_db->mapVariableAndContextToIndex(v, d_error_estimate_context);
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                patch->getPatchData(est_idx)->copy(*patch->getPatchData(new_idx));
+            }
+        }
+    }
+    return;
+} // storeEmbeddedErrorEstimateDataSpecialized
+
+double HierarchyIntegrator::computeEmbeddedErrorEstimateSpecialized(const double abs_tol,
+                                                                    const double rel_tol)
+{
+    const int coarsest_ln = 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+
+    // Compare the stored values of the error estimate variables to their final
+    // values.
+    double error_estimate = 0.0;
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    HierarchyDataOpsManager<NDIM>* hier_ops_manager =
+        HierarchyDataOpsManager<NDIM>::getManager();
+    for (std::list<Pointer<Variable<NDIM> > >::const_iterator ev =
+             d_error_estimate_variables.begin();
+         ev != d_error_estimate_variables.end();
+         ++ev)
+    {
+        const Pointer<Variable<NDIM> >& v = *ev;
+        const int new_idx = var_db->mapVariableAndContextToIndex(v, getNewContext());
+        const int est_idx = var_db->mapVariableAndContextToIndex(v, d_error_estimate_context);
+        Pointer<HierarchyDataOpsReal<NDIM, double> > hier_data_ops =
+            hier_ops_manager->getOperationsDouble(v, d_hierarchy, true);
+        hier_data_ops->resetLevels(coarsest_ln, finest_ln);
+        hier_data_ops->subtract(est_idx, new_idx, est_idx);
+        const double diff_norm = hier_data_ops->maxNorm(est_idx);
+        const double new_norm = hier_data_ops->maxNorm(new_idx);
+        error_estimate = std::max(error_estimate, diff_norm / (abs_tol + rel_tol * new_norm));
+    }
+
+    // Deallocate the stored data.
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        level->deallocatePatchData(d_error_estimate_data);
+    }
+    return error_estimate;
+} // computeEmbeddedErrorEstimateSpecialized
+
 bool HierarchyIntegrator::atRegridPointSpecialized() const
 {
     if (d_parent_integrator)
@@ -1308,6 +1491,9 @@ void HierarchyIntegrator::registerVariable(int& current_idx,
         var_db->registerVariableAndContext(variable, getScratchContext(), scratch_ghosts);
     d_scratch_data.setFlag(scratch_idx);
 
+    // Setup the error estimate context.
+    registerEmbeddedErrorEstimateVariable(variable);
+
     // Get the data transfer operators.
     Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
     Pointer<RefineOperator<NDIM> > refine_operator =
@@ -1379,6 +1565,23 @@ void HierarchyIntegrator::registerVariable(int& idx,
     return;
 } // registerVariable
 
+void HierarchyIntegrator::registerEmbeddedErrorEstimateVariable(
+    const Pointer<Variable<NDIM> > variable)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(variable);
+#endif
+    if (!has_double_hier_data_ops(variable)) return;
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    const IntVector<NDIM> no_ghosts = 0;
+    const int est_idx =
+        var_db->registerVariableAndContext(variable, d_error_estimate_context, no_ghosts);
+    if (d_error_estimate_data.isSet(est_idx)) return;
+    d_error_estimate_variables.push_back(variable);
+    d_error_estimate_data.setFlag(est_idx);
+    return;
+} // registerEmbeddedErrorEstimateVariable
+
 void HierarchyIntegrator::registerGhostfillRefineAlgorithm(
     const std::string& name,
     Pointer<RefineAlgorithm<NDIM> > ghostfill_alg,
@@ -1553,6 +1756,25 @@ void HierarchyIntegrator::getFromInput(Pointer<Database> db, bool is_from_restar
     if (db->keyExists("max_integrator_steps"))
         d_max_integrator_steps = db->getInteger("max_integrator_steps");
     if (db->keyExists("num_cycles")) d_num_cycles = db->getInteger("num_cycles");
+    if (db->keyExists("enable_adaptive_dt"))
+        d_enable_adaptive_dt = db->getBool("enable_adaptive_dt");
+    if (db->keyExists("adaptive_dt_abs_tolerance"))
+        d_adaptive_dt_abs_tol = db->getDouble("adaptive_dt_abs_tolerance");
+    if (db->keyExists("adaptive_dt_rel_tolerance"))
+        d_adaptive_dt_rel_tol = db->getDouble("adaptive_dt_rel_tolerance");
+    if (db->keyExists("adaptive_dt_safety_factor"))
+        d_adaptive_dt_safety_factor = db->getDouble("adaptive_dt_safety_factor");
+    if (db->keyExists("adaptive_dt_min_factor"))
+        d_adaptive_dt_min_factor = db->getDouble("adaptive_dt_min_factor");
+    if (db->keyExists("adaptive_dt_max_factor"))
+        d_adaptive_dt_max_factor = db->getDouble("adaptive_dt_max_factor");
+    if (db->keyExists("adaptive_dt_max_rejections"))
+        d_adaptive_dt_max_rejections = db->getInteger("adaptive_dt_max_rejections");
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_adaptive_dt_abs_tol > 0.0 || d_adaptive_dt_rel_tol > 0.0);
+    TBOX_ASSERT(d_adaptive_dt_min_factor > 0.0 && d_adaptive_dt_min_factor < 1.0);
+    TBOX_ASSERT(d_adaptive_dt_max_factor >= 1.0);
+#endif
     if (db->keyExists("regrid_interval"))
         d_regrid_interval = db->getInteger("regrid_interval");
     if (db->keyExists("regrid_mode"))
@@ -1610,6 +1832,32 @@ void HierarchyIntegrator::getFromRestart()
     return;
 } // getFromRestart
 
+void HierarchyIntegrator::storeEmbeddedErrorEstimateData()
+{
+    storeEmbeddedErrorEstimateDataSpecialized();
+    for (std::set<HierarchyIntegrator*>::iterator it = d_child_integrators.begin();
+         it != d_child_integrators.end();
+         ++it)
+    {
+        (*it)->storeEmbeddedErrorEstimateData();
+    }
+    return;
+} // storeEmbeddedErrorEstimateData
+
+double HierarchyIntegrator::computeEmbeddedErrorEstimate(const double abs_tol,
+                                                         const double rel_tol)
+{
+    double error_estimate = computeEmbeddedErrorEstimateSpecialized(abs_tol, rel_tol);
+    for (std::set<HierarchyIntegrator*>::iterator it = d_child_integrators.begin();
+         it != d_child_integrators.end();
+         ++it)
+    {
+        error_estimate =
+            std::max(error_estimate, (*it)->computeEmbeddedErrorEstimate(abs_tol, rel_tol));
+    }
+    return error_estimate;
+} // computeEmbeddedErrorEstimate
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
@@ -92,6 +92,32 @@ namespace IBTK
  * \brief Class HierarchyIntegrator provides an abstract interface for a time
  * integrator for a system of equations defined on an AMR grid hierarchy, along
  * with basic data management for variables defined on that hierarchy.
+ *
+ * When the input key <code>enable_adaptive_dt</code> is set to \p TRUE and the
+ * integrator performs two or more cycles per time step, advanceHierarchy() uses
+ * the difference between the state data produced by the final two cycles as an
+ * embedded estimate of the local truncation error.  Steps whose scaled error
+ * estimate exceeds one are rejected, the integrator is reset via
+ * resetIntegratorToPreadvanceState(), and the step is retried with a reduced
+ * time step size.  Steps are rejected only if canResetIntegratorToPreadvanceState()
+ * returns true; otherwise, the error estimate is used only to determine the size
+ * of the next step.  Accepted steps determine a suggested size for the next step,
+ * which further limits the value returned by getMaximumTimeStepSize().  The
+ * controller is configured by the input keys:
+ *
+ * - <code>adaptive_dt_abs_tolerance</code> (default 1.0e-6)
+ * - <code>adaptive_dt_rel_tolerance</code> (default 1.0e-3)
+ * - <code>adaptive_dt_safety_factor</code> (default 0.9)
+ * - <code>adaptive_dt_min_factor</code> (default 0.2)
+ * - <code>adaptive_dt_max_factor</code> (default 2.0)
+ * - <code>adaptive_dt_max_rejections</code> (default 4)
+ *
+ * \note Step rejection requires that each integrator in the hierarchy leaves
+ * its current state data unmodified until postprocessIntegrateHierarchy() is
+ * called, and that resetIntegratorToPreadvanceStateSpecialized() releases all
+ * data allocated by preprocessIntegrateHierarchy().  Integrators declare this
+ * by overriding canResetIntegratorToPreadvanceStateSpecialized().  Registered
+ * preprocess callbacks are executed again for each retried step.
  */
 class HierarchyIntegrator : public SAMRAI::mesh::StandardTagAndInitStrategy<NDIM>,
                             public SAMRAI::tbox::Serializable
@@ -171,6 +197,10 @@ public:
      * Subclasses can control the method used to determined the time step size
      * by overriding the protected virtual member function
      * getMaximumTimeStepSizeSpecialized().
+     *
+     * When adaptive time stepping is enabled, the returned value is also
+     * limited by the time step size suggested by the embedded error estimate
+     * computed during the previous call to advanceHierarchy().
      */
     double getMaximumTimeStepSize();
 
@@ -203,6 +233,16 @@ public:
      */
     void resetIntegratorToPreadvanceState();
 
+    /*!
+     * Return a boolean value that indicates whether this integrator and all of
+     * its child integrators can be reset to the state at the beginning of the
+     * current time step via resetIntegratorToPreadvanceState().
+     *
+     * Subclasses declare that they can be reset by overriding the protected
+     * virtual member function canResetIntegratorToPreadvanceStateSpecialized().
+     */
+    bool canResetIntegratorToPreadvanceState() const;
+
     /*!
      * Virtual method to regrid the patch hierarchy.
      *
@@ -592,6 +632,39 @@ protected:
      */
     virtual void resetIntegratorToPreadvanceStateSpecialized();
 
+    /*!
+     * Virtual method to indicate whether resetIntegratorToPreadvanceStateSpecialized()
+     * undoes all of the work done by preprocessIntegrateHierarchy(), so that a
+     * time step can be rejected and retried.
+     *
+     * A default implementation is provided that returns false.
+     */
+    virtual bool canResetIntegratorToPreadvanceStateSpecialized() const;
+
+    /*!
+     * Virtual method to store the implementation-specific data used to form an
+     * embedded error estimate.  This method is called by advanceHierarchy()
+     * after the second-to-last cycle of a time step when adaptive time stepping
+     * is enabled.
+     *
+     * A default implementation is provided that copies the new values of all
+     * variables registered via registerEmbeddedErrorEstimateVariable().
+     */
+    virtual void storeEmbeddedErrorEstimateDataSpecialized();
+
+    /*!
+     * Virtual method to compute an implementation-specific embedded error
+     * estimate after the final cycle of a time step.  The returned value is
+     * scaled so that values greater than one indicate that the step should be
+     * rejected.
+     *
+     * A default implementation is provided that returns the maximum over all
+     * variables registered via registerEmbeddedErrorEstimateVariable() of
+     * |Q_final - Q_stored|_max / (abs_tol + rel_tol*|Q_final|_max), and that
+     * deallocates the stored data.
+     */
+    virtual double computeEmbeddedErrorEstimateSpecialized(double abs_tol, double rel_tol);
+
     /*!
      * Virtual method to provide implementation-specific function to determine
      * whether regridding should occur at the current time step.
@@ -729,6 +802,21 @@ protected:
         SAMRAI::tbox::Pointer<SAMRAI::hier::VariableContext> ctx =
             SAMRAI::tbox::Pointer<SAMRAI::hier::VariableContext>(NULL));
 
+    /*!
+     * Register a variable whose new values are used to form the embedded error
+     * estimate employed by the adaptive time step controller.  The new values
+     * of the variable must be stored in the new context returned by
+     * getNewContext().
+     *
+     * Double-valued state variables registered via registerVariable() are
+     * registered automatically.  Subclasses that maintain additional state data
+     * outside of the integrator, e.g., through a HyperbolicLevelIntegrator,
+     * should register those variables in initializeHierarchyIntegrator().
+     * Variables without double-valued hierarchy data operations are ignored.
+     */
+    void registerEmbeddedErrorEstimateVariable(
+        SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> > variable);
+
     /*!
      * Register a ghost cell-filling refine algorithm.
      */
@@ -882,6 +970,16 @@ protected:
     int d_integrator_step, d_max_integrator_steps;
     std::deque<double> d_dt_previous;
 
+    /*
+     * Parameters for the error-based time step size controller, and the time
+     * step size suggested by the most recent accepted step.
+     */
+    bool d_enable_adaptive_dt;
+    double d_adaptive_dt_abs_tol, d_adaptive_dt_rel_tol;
+    double d_adaptive_dt_safety_factor, d_adaptive_dt_min_factor, d_adaptive_dt_max_factor;
+    int d_adaptive_dt_max_rejections;
+    double d_adaptive_dt_next;
+
     /*
      * The number of cycles of fixed-point iteration to use per timestep.
      */
@@ -1024,6 +1122,25 @@ private:
      */
     void getFromRestart();
 
+    /*!
+     * Recursively store the data used to form the embedded error estimate for
+     * this integrator and all child integrators.
+     */
+    void storeEmbeddedErrorEstimateData();
+
+    /*!
+     * Recursively compute the embedded error estimate for this integrator and
+     * all child integrators.
+     */
+    double computeEmbeddedErrorEstimate(double abs_tol, double rel_tol);
+
+    /*
+     * Storage used to form embedded error estimates.
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::hier::VariableContext> d_error_estimate_context;
+    std::list<SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> > > d_error_estimate_variables;
+    SAMRAI::hier::ComponentSelector d_error_estimate_data;
+
     /*
      * Indicates whether we are currently regridding the hierarchy, or whether
      * the time step began by regridding the hierarchy.
@@ -0,0 +1,133 @@
+// Filename: PatchScratchPool.cpp
+// Created on 19 Oct 2026 by Boyce Griffith
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of New York University nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <stddef.h>
+#include <algorithm>
+#include <vector>
+
+#include "Box.h"
+#include "IntVector.h"
+#include "Patch.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "PatchScratchPool.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Pointer.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+PatchScratchPool::PatchScratchPool() : d_buffers()
+{
+    // intentionally blank
+    return;
+} // PatchScratchPool
+
+PatchScratchPool::~PatchScratchPool()
+{
+    // intentionally blank
+    return;
+} // ~PatchScratchPool
+
+void PatchScratchPool::reserve(const unsigned int num_buffers, const size_t buffer_size)
+{
+    if (d_buffers.size() < num_buffers) resizeBufferList(num_buffers);
+    for (unsigned int k = 0; k < num_buffers; ++k)
+    {
+        getBuffer(k, buffer_size);
+    }
+    return;
+} // reserve
+
+void PatchScratchPool::reserve(const unsigned int num_buffers,
+                               Pointer<PatchHierarchy<NDIM> > hierarchy,
+                               const int coarsest_ln,
+                               const int finest_ln,
+                               const IntVector<NDIM>& ghosts)
+{
+    // Determine the size of the largest patch box, extended by one index in
+    // each direction so that the size accommodates side-, face-, and
+    // node-centered data as well as cell-centered data.
+    size_t buffer_size = 0;
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Box<NDIM> data_box = patch->getBox();
+            data_box.upper() += IntVector<NDIM>(1);
+            data_box.grow(ghosts);
+            buffer_size = std::max(buffer_size, static_cast<size_t>(data_box.size()));
+        }
+    }
+    reserve(num_buffers, buffer_size);
+    return;
+} // reserve
+
+void PatchScratchPool::clear()
+{
+    d_buffers.clear();
+    return;
+} // clear
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void PatchScratchPool::resizeBufferList(const unsigned int num_buffers)
+{
+    // Swap the existing buffers into the new list so that pointers previously
+    // returned by getBuffer() remain valid.
+    std::vector<std::vector<double> > buffers(num_buffers);
+    const unsigned int num_existing_buffers =
+        std::min(num_buffers, static_cast<unsigned int>(d_buffers.size()));
+    for (unsigned int k = 0; k < num_existing_buffers; ++k)
+    {
+        buffers[k].swap(d_buffers[k]);
+    }
+    d_buffers.swap(buffers);
+    return;
+} // resizeBufferList
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,152 @@
+// Filename: PatchScratchPool.h
+// Created on 19 Oct 2026 by Boyce Griffith
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of New York University nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_PatchScratchPool
+#define included_PatchScratchPool
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <stddef.h>
+#include <vector>
+
+#include "IntVector.h"
+#include "PatchHierarchy.h"
+#include "tbox/Pointer.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class PatchScratchPool manages a collection of reusable scratch
+ * buffers for per-patch temporary data.
+ *
+ * Patch-based numerical kernels frequently require several temporary arrays
+ * that are the same size as the patch data on which they operate (e.g., slopes
+ * and left/right extrapolated states in Godunov-type methods).  Rather than
+ * allocating new SAMRAI::hier::PatchData objects for each patch on each call,
+ * such storage can be obtained from a PatchScratchPool.  Each buffer is sized
+ * to accommodate the largest request made of it and is subsequently reused for
+ * all patches and all calls, so that the cost of heap allocation and of
+ * touching newly allocated memory is incurred only once.
+ *
+ * \note Buffer contents are uninitialized and are not preserved between
+ * patches.  A pool is not thread safe; each object (or thread of execution)
+ * that requires scratch storage should maintain its own pool.
+ */
+class PatchScratchPool
+{
+public:
+    /*!
+     * \brief Default constructor.
+     */
+    PatchScratchPool();
+
+    /*!
+     * \brief Destructor.
+     */
+    ~PatchScratchPool();
+
+    /*!
+     * \brief Ensure that at least \a num_buffers buffers, each of which can
+     * hold at least \a buffer_size values, are allocated.
+     */
+    void reserve(unsigned int num_buffers, size_t buffer_size);
+
+    /*!
+     * \brief Ensure that at least \a num_buffers buffers are allocated, each of
+     * which can hold a single data depth of any standard data centering on the
+     * largest patch in the specified range of levels, including ghost cells of
+     * width \a ghosts.
+     */
+    void reserve(unsigned int num_buffers,
+                 SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                 int coarsest_ln,
+                 int finest_ln,
+                 const SAMRAI::hier::IntVector<NDIM>& ghosts);
+
+    /*!
+     * \brief Return a pointer to scratch buffer number \a buffer_num, which
+     * is guaranteed to hold at least \a buffer_size values.
+     *
+     * Buffers with distinct buffer numbers do not overlap.  The returned
+     * pointer remains valid until the next call to reserve(), getBuffer(), or
+     * clear().
+     */
+    inline double* getBuffer(const unsigned int buffer_num, const size_t buffer_size)
+    {
+        if (buffer_num >= d_buffers.size()) resizeBufferList(buffer_num + 1);
+        std::vector<double>& buffer = d_buffers[buffer_num];
+        if (buffer.size() < buffer_size) std::vector<double>(buffer_size).swap(buffer);
+        return &buffer[0];
+    } // getBuffer
+
+    /*!
+     * \brief Release all storage held by the pool.
+     */
+    void clear();
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    PatchScratchPool(const PatchScratchPool& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    PatchScratchPool& operator=(const PatchScratchPool& that);
+
+    /*!
+     * \brief Increase the number of buffers without reallocating the storage
+     * of the existing buffers.
+     */
+    void resizeBufferList(unsigned int num_buffers);
+
+    // The scratch buffers.
+    std::vector<std::vector<double> > d_buffers;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_PatchScratchPool
@@ -0,0 +1,107 @@
+// Filename: PatchTaskExecutor.cpp
+// Created on 19 Oct 2026 by Boyce Griffith
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of New York University nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <vector>
+
+#include "Patch.h"
+#include "PatchLevel.h"
+#include "PatchTaskExecutor.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Pointer.h"
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+bool PatchTaskExecutor::s_threading_enabled = true;
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+void PatchTaskExecutor::getLocalPatches(std::vector<Pointer<Patch<NDIM> > >& patches,
+                                        Pointer<PatchLevel<NDIM> > level)
+{
+    patches.clear();
+    patches.reserve(level->getNumberOfPatches());
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        patches.push_back(level->getPatch(p()));
+    }
+    return;
+} // getLocalPatches
+
+void PatchTaskExecutor::setThreadingEnabled(const bool enabled)
+{
+    s_threading_enabled = enabled;
+    return;
+} // setThreadingEnabled
+
+bool PatchTaskExecutor::getThreadingEnabled()
+{
+    return s_threading_enabled;
+} // getThreadingEnabled
+
+int PatchTaskExecutor::getMaxNumThreads()
+{
+#if defined(_OPENMP)
+    return s_threading_enabled ? omp_get_max_threads() : 1;
+#else
+    return 1;
+#endif
+} // getMaxNumThreads
+
+bool PatchTaskExecutor::useThreads()
+{
+#if defined(_OPENMP)
+    return s_threading_enabled && !omp_in_parallel() && omp_get_max_threads() > 1;
+#else
+    return false;
+#endif
+} // useThreads
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,232 @@
+// Filename: PatchTaskExecutor.h
+// Created on 19 Oct 2026 by Boyce Griffith
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of New York University nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef included_PatchTaskExecutor
+#define included_PatchTaskExecutor
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <vector>
+
+#include "Patch.h"
+#include "PatchLevel.h"
+#include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class PatchTaskExecutor provides support for executing independent
+ * per-patch tasks concurrently on a team of threads.
+ *
+ * Patch-based operations such as those provided by class PatchMathOps read and
+ * write only data associated with a single patch, so that the patches of a
+ * patch level may be processed in any order.  When IBTK is configured with
+ * --enable-openmp (so that the C++ compiler is invoked with the appropriate
+ * OpenMP flag and _OPENMP is defined), PatchTaskExecutor distributes the local
+ * patches of a level dynamically among the threads of an OpenMP thread team.
+ * Otherwise, patches are processed serially in the order in which they are
+ * visited by SAMRAI::hier::PatchLevel::Iterator.
+ *
+ * executeIndexed() contains the only OpenMP directive.  Patch loops are
+ * expressed as task objects and passed to execute() or executeIndexed() rather
+ * than annotated individually.
+ *
+ * Each patch is processed by exactly one thread, and no reductions are
+ * performed across patches, so that the results are independent of the number
+ * of threads and of the assignment of patches to threads.
+ *
+ * \note Tasks executed concurrently must not allocate or release
+ * reference-counted SAMRAI objects that are shared among patches (e.g.,
+ * variables, grid geometries, or communication schedules), because the
+ * reference counts maintained by SAMRAI::tbox::Pointer are not thread safe.
+ * Tasks also must not use scratch storage that is shared among threads, such as
+ * a single PatchScratchPool, or set physical boundary conditions via
+ * SAMRAI::solv::RobinBcCoefStrategy objects, which are generally not thread
+ * safe (e.g., muParserRobinBcCoefs shares its parsers among all patches).
+ */
+class PatchTaskExecutor
+{
+public:
+    /*!
+     * \brief Collect the local patches of the specified patch level in the
+     * order in which they are visited by SAMRAI::hier::PatchLevel::Iterator.
+     */
+    static void
+    getLocalPatches(std::vector<SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > >& patches,
+                    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level);
+
+    /*!
+     * \brief Apply a task to each local patch of the specified patch level.
+     *
+     * The task object must provide a const member function
+     *
+     * \code
+     * void operator()(const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> >& patch) const;
+     * \endcode
+     *
+     * that may be safely called concurrently for distinct patches.
+     */
+    template <class PatchTask>
+    static void execute(const PatchTask& task,
+                        SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level)
+    {
+        executeIndexed(IndexedPatchTask<PatchTask>(task), level);
+        return;
+    } // execute
+
+    /*!
+     * rief Apply a task to each local patch of the specified patch level,
+     * providing the local patch number, i.e., the position of the patch in the
+     * sequence returned by getLocalPatches().
+     *
+     * The task object must provide a const member function
+     *
+     * \code
+     * void operator()(const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> >& patch,
+     *                 int local_patch_num) const;
+     * \endcode
+     *
+     * that may be safely called concurrently for distinct patches whenever
+     * allow_threads is true.  When allow_threads is false, the patches are
+     * processed serially in order of increasing local patch number.
+     */
+    template <class PatchTask>
+    static void executeIndexed(const PatchTask& task,
+                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level,
+                               bool allow_threads = true)
+    {
+        std::vector<SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > > patches;
+        getLocalPatches(patches, level);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic, 1) if (allow_threads && useThreads())
+#else
+        NULL_USE(allow_threads);
+#endif
+        for (int k = 0; k < num_patches; ++k)
+        {
+            task(patches[k], k);
+        }
+        return;
+    } // executeIndexed
+
+    /*!
+     * \brief Enable or disable the concurrent execution of patch tasks.
+     *
+     * Threading is enabled by default when IBTK is compiled with OpenMP
+     * support.
+     */
+    static void setThreadingEnabled(bool enabled);
+
+    /*!
+     * \brief Return whether the concurrent execution of patch tasks is enabled.
+     */
+    static bool getThreadingEnabled();
+
+    /*!
+     * \brief Return the maximum number of threads that will be used to execute
+     * patch tasks.
+     */
+    static int getMaxNumThreads();
+
+    /*!
+     * \brief Return whether patch tasks should be executed concurrently, i.e.,
+     * whether threading is enabled, more than one thread is available, and the
+     * caller is not already executing within a parallel region.
+     */
+    static bool useThreads();
+
+private:
+    /*!
+     * \brief Adapts a task that does not use the local patch number for use with
+     * executeIndexed().
+     */
+    template <class PatchTask>
+    class IndexedPatchTask
+    {
+    public:
+        explicit IndexedPatchTask(const PatchTask& task) : d_task(task)
+        {
+        } // IndexedPatchTask
+
+        void operator()(const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> >& patch,
+                        int /*local_patch_num*/) const
+        {
+            d_task(patch);
+            return;
+        } // operator()
+
+    private:
+        const PatchTask& d_task;
+    };
+
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    PatchTaskExecutor();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    PatchTaskExecutor(const PatchTaskExecutor& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    PatchTaskExecutor& operator=(const PatchTaskExecutor& that);
+
+    /*!
+     * Indicates whether patch tasks may be executed concurrently.
+     */
+    static bool s_threading_enabled;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_PatchTaskExecutor
@@ -0,0 +1 @@
+../../src/advect/AdvectorExplicitPredictorKernels.h
\ No newline at end of file
@@ -64,6 +64,8 @@
 #include "tbox/PIO.h"
 #include "tbox/RestartManager.h"
 #include "tbox/SAMRAI_MPI.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
 namespace SAMRAI
@@ -85,6 +87,11 @@ namespace
 {
 // Version of IBExplicitHierarchyIntegrator restart file data.
 static const int IB_EXPLICIT_HIERARCHY_INTEGRATOR_VERSION = 2;
+
+// Timers used to measure the costs of the fluid solver and of the Lagrangian
+// operations for the workload estimates.  These timers are always active.
+static Timer* t_integrate_hierarchy_workload;
+static Timer* t_solve_fluid_equations_workload;
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -104,6 +111,12 @@ IBExplicitHierarchyIntegrator::IBExplicitHierarchyIntegrator(
     // Initialize object with data read from the input and restart databases.
     bool from_restart = RestartManager::getManager()->isFromRestart();
     if (from_restart) getFromRestart();
+
+    // Setup Timers.
+    IBAMR_DO_ONCE(t_integrate_hierarchy_workload = TimerManager::getManager()->getTimer(
+                      "IBAMR::IBExplicitHierarchyIntegrator::integrateHierarchy()::workload", true);
+                  t_solve_fluid_equations_workload = TimerManager::getManager()->getTimer(
+                      "IBAMR::IBExplicitHierarchyIntegrator::solveFluidEquations()::workload", true););
     return;
 } // IBExplicitHierarchyIntegrator
 
@@ -257,6 +270,8 @@ void IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time
                                                        const int cycle_num)
 {
     IBHierarchyIntegrator::integrateHierarchy(current_time, new_time, cycle_num);
+    const double step_wtime_start = t_integrate_hierarchy_workload->getTotalWallclockTime();
+    t_integrate_hierarchy_workload->start();
     const double half_time = current_time + 0.5 * (new_time - current_time);
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
     const int u_current_idx =
@@ -351,6 +366,8 @@ void IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time
     if (d_enable_logging)
         plog << d_object_name
              << "::integrateHierarchy(): solving the incompressible Navier-Stokes equations\n";
+    const double fluid_wtime_start = t_solve_fluid_equations_workload->getTotalWallclockTime();
+    t_solve_fluid_equations_workload->start();
     if (d_current_num_cycles > 1)
     {
         d_ins_hier_integrator->integrateHierarchy(current_time, new_time, cycle_num);
@@ -366,6 +383,9 @@ void IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time
             d_ins_hier_integrator->integrateHierarchy(current_time, new_time, ins_cycle_num);
         }
     }
+    t_solve_fluid_equations_workload->stop();
+    const double fluid_wtime =
+        t_solve_fluid_equations_workload->getTotalWallclockTime() - fluid_wtime_start;
     d_ib_method_ops->postprocessSolveFluidEquations(current_time, new_time, cycle_num);
 
     // Interpolate the Eulerian velocity to the curvilinear mesh.
@@ -464,6 +484,13 @@ void IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time
             half_time);
     }
 
+    // Record the time spent in the fluid solver and in the Lagrangian
+    // operations for use in computing workload estimates.
+    t_integrate_hierarchy_workload->stop();
+    const double step_wtime =
+        t_integrate_hierarchy_workload->getTotalWallclockTime() - step_wtime_start;
+    recordWorkloadTimings(fluid_wtime, step_wtime - fluid_wtime);
+
     // Execute any registered callbacks.
     executeIntegrateHierarchyCallbackFcns(current_time, new_time, cycle_num);
     return;
@@ -530,6 +557,7 @@ void IBExplicitHierarchyIntegrator::postprocessIntegrateHierarchy(
     }
     cfl_max = SAMRAI_MPI::maxReduction(cfl_max);
     d_regrid_cfl_estimate += cfl_max;
+    d_point_cfl_previous = cfl_max;
     if (d_enable_logging)
         plog << d_object_name << "::postprocessIntegrateHierarchy(): CFL number = " << cfl_max
              << "\n";
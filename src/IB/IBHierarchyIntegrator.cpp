@@ -46,6 +46,7 @@
 #include "HierarchyDataOpsManager.h"
 #include "IBHierarchyIntegrator.h"
 #include "IntVector.h"
+#include "Patch.h"
 #include "PatchHierarchy.h"
 #include "RefineAlgorithm.h"
 #include "RefineOperator.h"
@@ -63,6 +64,7 @@
 #include "tbox/MathUtilities.h"
 #include "tbox/PIO.h"
 #include "tbox/RestartManager.h"
+#include "tbox/SAMRAI_MPI.h"
 #include "tbox/Utilities.h"
 
 namespace SAMRAI
@@ -409,6 +411,11 @@ void IBHierarchyIntegrator::regridHierarchy()
             plog << d_object_name << "::regridHierarchy(): updating workload estimates\n";
         d_hier_cc_data_ops->setToScalar(d_workload_idx, 1.0);
         d_ib_method_ops->updateWorkloadEstimates(d_hierarchy, d_workload_idx);
+        if (d_adaptive_workload)
+        {
+            updateWorkloadModel();
+            applyWorkloadWeight(0, d_hierarchy->getFinestLevelNumber());
+        }
     }
 
     // Collect the marker particles to level 0 of the patch hierarchy.
@@ -482,12 +489,19 @@ IBHierarchyIntegrator::IBHierarchyIntegrator(
     d_time_stepping_type = MIDPOINT_RULE;
     d_regrid_cfl_interval = 0.0;
     d_regrid_cfl_estimate = 0.0;
+    d_point_cfl_max = 0.0;
+    d_point_cfl_previous = 0.0;
     d_error_on_dt_change = true;
     d_warn_on_dt_change = false;
 
     // Do not allocate a workload variable by default.
     d_workload_var.setNull();
     d_workload_idx = -1;
+    d_adaptive_workload = false;
+    d_workload_relaxation_factor = 0.5;
+    d_workload_lag_weight = 1.0;
+    d_workload_fluid_time = 0.0;
+    d_workload_lag_time = 0.0;
 
     // Initialize object with data read from the input and restart databases.
     bool from_restart = RestartManager::getManager()->isFromRestart();
@@ -496,6 +510,17 @@ IBHierarchyIntegrator::IBHierarchyIntegrator(
     return;
 } // IBHierarchyIntegrator
 
+double IBHierarchyIntegrator::getMaximumTimeStepSizeSpecialized()
+{
+    double dt = HierarchyIntegrator::getMaximumTimeStepSizeSpecialized();
+    const bool initial_time = MathUtilities<double>::equalEps(d_integrator_time, d_start_time);
+    if (!initial_time && d_point_cfl_max > 0.0 && d_point_cfl_previous > 0.0)
+    {
+        dt = std::min(dt, d_point_cfl_max * d_dt_previous[0] / d_point_cfl_previous);
+    }
+    return dt;
+} // getMaximumTimeStepSizeSpecialized
+
 bool IBHierarchyIntegrator::atRegridPointSpecialized() const
 {
     const bool initial_time = MathUtilities<double>::equalEps(d_integrator_time, d_start_time);
@@ -618,15 +643,26 @@ void IBHierarchyIntegrator::putToDatabaseSpecialized(Pointer<Database> db)
                   enum_to_string<TimeSteppingType>(d_time_stepping_type));
     db->putDouble("d_regrid_cfl_interval", d_regrid_cfl_interval);
     db->putDouble("d_regrid_cfl_estimate", d_regrid_cfl_estimate);
+    db->putDouble("d_workload_lag_weight", d_workload_lag_weight);
     return;
 } // putToDatabaseSpecialized
 
+void IBHierarchyIntegrator::recordWorkloadTimings(const double fluid_time,
+                                                  const double lag_time)
+{
+    if (!d_adaptive_workload) return;
+    d_workload_fluid_time += fluid_time;
+    d_workload_lag_time += lag_time;
+    return;
+} // recordWorkloadTimings
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 void IBHierarchyIntegrator::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
 {
     if (db->keyExists("regrid_cfl_interval"))
         d_regrid_cfl_interval = db->getDouble("regrid_cfl_interval");
+    if (db->keyExists("point_cfl_max")) d_point_cfl_max = db->getDouble("point_cfl_max");
     if (db->keyExists("error_on_dt_change"))
         d_error_on_dt_change = db->getBool("error_on_dt_change");
     else if (db->keyExists("error_on_timestep_change"))
@@ -647,6 +683,16 @@ void IBHierarchyIntegrator::getFromInput(Pointer<Database> db, bool /*is_from_re
             string_to_enum<TimeSteppingType>(db->getString("timestepping_type"));
     if (db->keyExists("marker_file_name"))
         d_mark_file_name = db->getString("marker_file_name");
+    if (db->keyExists("adaptive_workload_estimates"))
+        d_adaptive_workload = db->getBool("adaptive_workload_estimates");
+    if (db->keyExists("workload_relaxation_factor"))
+        d_workload_relaxation_factor = db->getDouble("workload_relaxation_factor");
+    if (d_workload_relaxation_factor <= 0.0 || d_workload_relaxation_factor > 1.0)
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                 << "  workload_relaxation_factor must be in (0,1]"
+                                 << std::endl);
+    }
     return;
 } // getFromInput
 
@@ -673,9 +719,59 @@ void IBHierarchyIntegrator::getFromRestart()
         string_to_enum<TimeSteppingType>(db->getString("d_time_stepping_type"));
     d_regrid_cfl_interval = db->getDouble("d_regrid_cfl_interval");
     d_regrid_cfl_estimate = db->getDouble("d_regrid_cfl_estimate");
+    if (db->keyExists("d_workload_lag_weight"))
+        d_workload_lag_weight = db->getDouble("d_workload_lag_weight");
     return;
 } // getFromRestart
 
+void IBHierarchyIntegrator::updateWorkloadModel()
+{
+    // Determine the total number of cells and the total unweighted Lagrangian
+    // workload.  The workload data are currently set to 1 + lag_workload.
+    double n_cells = 0.0;
+    for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            n_cells += static_cast<double>(level->getPatch(p())->getBox().size());
+        }
+    }
+    n_cells = SAMRAI_MPI::sumReduction(n_cells);
+    const double lag_workload = d_hier_cc_data_ops->L1Norm(d_workload_idx) - n_cells;
+
+    // Fit the per-cell and per-unit-Lagrangian-workload costs to the measured
+    // timings, and relax the Lagrangian weight toward their ratio.
+    const double fluid_time = SAMRAI_MPI::sumReduction(d_workload_fluid_time);
+    const double lag_time = SAMRAI_MPI::sumReduction(d_workload_lag_time);
+    d_workload_fluid_time = 0.0;
+    d_workload_lag_time = 0.0;
+    if (fluid_time <= 0.0 || lag_time <= 0.0 || lag_workload <= 0.0) return;
+    const double cell_cost = fluid_time / n_cells;
+    const double lag_cost = lag_time / lag_workload;
+    d_workload_lag_weight = (1.0 - d_workload_relaxation_factor) * d_workload_lag_weight +
+                            d_workload_relaxation_factor * lag_cost / cell_cost;
+    if (d_enable_logging)
+    {
+        plog << d_object_name << "::updateWorkloadModel(): measured cost per cell = "
+             << cell_cost << ", per unit Lagrangian workload = " << lag_cost << "\n";
+        plog << d_object_name << "::updateWorkloadModel(): Lagrangian workload weight = "
+             << d_workload_lag_weight << "\n";
+    }
+    return;
+} // updateWorkloadModel
+
+void IBHierarchyIntegrator::applyWorkloadWeight(const int coarsest_ln, const int finest_ln)
+{
+    // workload := 1 + lag_weight*(workload - 1)
+    HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(
+        d_hierarchy, coarsest_ln, finest_ln);
+    hier_cc_data_ops.addScalar(d_workload_idx, d_workload_idx, -1.0);
+    hier_cc_data_ops.scale(d_workload_idx, d_workload_lag_weight, d_workload_idx);
+    hier_cc_data_ops.addScalar(d_workload_idx, d_workload_idx, 1.0);
+    return;
+} // applyWorkloadWeight
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
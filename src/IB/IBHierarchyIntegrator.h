@@ -124,6 +124,14 @@ public:
 
     /*!
      * Register a load balancer for non-uniform load balancing.
+     *
+     * By default, the workload in each cell is one plus the Lagrangian
+     * workload estimate provided by the IBStrategy object.  If the input key
+     * \p adaptive_workload_estimates is \p TRUE, the Lagrangian workload is
+     * instead weighted by the measured cost of the Lagrangian operations
+     * relative to the measured cost of the fluid solver per grid cell.  The
+     * weight is updated at each regridding operation and is relaxed by the
+     * factor \p workload_relaxation_factor (default 0.5).
      */
     void registerLoadBalancer(
         SAMRAI::tbox::Pointer<SAMRAI::mesh::LoadBalancer<NDIM> > load_balancer);
@@ -195,6 +203,26 @@ protected:
                           SAMRAI::tbox::Pointer<INSHierarchyIntegrator> ins_hier_integrator,
                           bool register_for_restart = true);
 
+    /*!
+     * Return the maximum stable time step size.
+     *
+     * In addition to the default limits, the time step size is restricted so
+     * that the estimated displacement of the IB points over a single time step
+     * does not exceed \p point_cfl_max meshwidths when that input key is
+     * provided.  The estimate is based on the displacement computed during the
+     * preceding time step.
+     *
+     * \note Variable time step sizes also require setting \p error_on_dt_change
+     * to \p FALSE.
+     *
+     * \note The IB integrators cannot be reset to the state at the beginning of
+     * a time step, because the IBStrategy objects do not provide a way to undo
+     * IBStrategy::preprocessIntegrateData().  Consequently, when adaptive time
+     * stepping is enabled, the embedded error estimate only limits the size of
+     * the next time step, and time steps are never rejected.
+     */
+    double getMaximumTimeStepSizeSpecialized();
+
     /*!
      * Function to determine whether regridding should occur at the current time
      * step.
@@ -239,6 +267,17 @@ protected:
      */
     void putToDatabaseSpecialized(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
 
+    /*!
+     * Record the wall-clock time spent by this process in the fluid solver and
+     * in the Lagrangian operations (force evaluation, spreading, and
+     * interpolation) during a single cycle of the time integration scheme.
+     *
+     * When adaptive workload estimates are enabled, these measurements are
+     * used to calibrate the relative cost of the Lagrangian workload reported
+     * by the IBStrategy object at the next regridding operation.
+     */
+    void recordWorkloadTimings(double fluid_time, double lag_time);
+
     /*
      * Boolean value that indicates whether the integrator has been initialized.
      */
@@ -271,6 +310,13 @@ protected:
      */
     double d_regrid_cfl_interval, d_regrid_cfl_estimate;
 
+    /*
+     * The maximum number of meshwidths a particle may move over a single time
+     * step (ignored when non-positive), along with the displacement estimate
+     * from the most recent time step.
+     */
+    double d_point_cfl_max, d_point_cfl_previous;
+
     /*
      * IB method implementation object.
      */
@@ -318,6 +364,19 @@ protected:
     SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > d_workload_var;
     int d_workload_idx;
 
+    /*
+     * Measured-cost workload model.  The workload in each cell is
+     *
+     *    workload(i) = 1 + lag_weight*lag_workload(i)
+     *
+     * in which lag_workload is the estimate provided by the IBStrategy object
+     * and lag_weight is the ratio of the measured cost per unit of Lagrangian
+     * workload to the measured cost per Cartesian grid cell.
+     */
+    bool d_adaptive_workload;
+    double d_workload_relaxation_factor, d_workload_lag_weight;
+    double d_workload_fluid_time, d_workload_lag_time;
+
     /*
      * Lagrangian marker data structures.
      */
@@ -522,6 +581,19 @@ private:
      * members.
      */
     void getFromRestart();
+
+    /*!
+     * Update the Lagrangian workload weight using the timings accumulated
+     * since the last regridding operation.  This routine must be called after
+     * the workload data has been set to the unweighted workload estimate.
+     */
+    void updateWorkloadModel();
+
+    /*!
+     * Apply the Lagrangian workload weight to the unweighted workload estimate
+     * on the specified range of levels.
+     */
+    void applyWorkloadWeight(int coarsest_ln, int finest_ln);
 };
 } // namespace IBAMR
 
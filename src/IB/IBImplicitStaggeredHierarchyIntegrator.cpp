@@ -33,8 +33,10 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <algorithm>
+#include <limits>
 #include <ostream>
 
+#include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
 #include "GriddingAlgorithm.h"
@@ -69,6 +71,7 @@
 #include "petscsnes.h"
 #include "petscsys.h"
 #include "tbox/Database.h"
+#include "tbox/MathUtilities.h"
 #include "tbox/PIO.h"
 #include "tbox/RestartManager.h"
 #include "tbox/SAMRAI_MPI.h"
@@ -114,7 +117,19 @@ IBImplicitStaggeredHierarchyIntegrator::IBImplicitStaggeredHierarchyIntegrator(
                             ib_implicit_ops,
                             ins_hier_integrator,
                             register_for_restart),
-      d_ib_implicit_ops(ib_implicit_ops)
+      d_ib_implicit_ops(ib_implicit_ops),
+      d_schur_solver(NULL),
+      d_use_schur_pc(false),
+      d_schur_pc_reassembly_tol(0.5),
+      d_schur_pc_mat(NULL),
+      d_schur_pc_X(NULL),
+      d_schur_pc_alpha(0.0),
+      d_jacobian_lag(1),
+      d_jacobian_lag_time_steps(1),
+      d_num_steps_since_jacobian_update(0),
+      d_first_jacobian_setup(true),
+      d_X_jac_lagged(NULL),
+      d_quasi_newton_type("NONE")
 {
     // Setup IB ops object to use "fixed" Lagrangian-Eulerian coupling
     // operators.
@@ -123,12 +138,28 @@ IBImplicitStaggeredHierarchyIntegrator::IBImplicitStaggeredHierarchyIntegrator(
     // Initialize object with data read from the input and restart databases.
     bool from_restart = RestartManager::getManager()->isFromRestart();
     if (from_restart) getFromRestart();
+    if (input_db) getFromInput(input_db);
     return;
 } // IBImplicitStaggeredHierarchyIntegrator
 
 IBImplicitStaggeredHierarchyIntegrator::~IBImplicitStaggeredHierarchyIntegrator()
 {
-    // intentionally blank
+    PetscErrorCode ierr;
+    if (d_schur_pc_mat)
+    {
+        ierr = MatDestroy(&d_schur_pc_mat);
+        IBTK_CHKERRQ(ierr);
+    }
+    if (d_schur_pc_X)
+    {
+        ierr = VecDestroy(&d_schur_pc_X);
+        IBTK_CHKERRQ(ierr);
+    }
+    if (d_X_jac_lagged)
+    {
+        ierr = VecDestroy(&d_X_jac_lagged);
+        IBTK_CHKERRQ(ierr);
+    }
     return;
 } // ~IBImplicitStaggeredHierarchyIntegrator
 
@@ -287,6 +318,23 @@ void IBImplicitStaggeredHierarchyIntegrator::integrateHierarchy(const double cur
     IBTK_CHKERRQ(ierr);
     ierr = SNESSetOptionsPrefix(snes, "ib_");
     IBTK_CHKERRQ(ierr);
+    if (d_quasi_newton_type != "NONE")
+    {
+        ierr = SNESSetType(snes, SNESQN);
+        IBTK_CHKERRQ(ierr);
+        ierr = SNESQNSetType(
+            snes, d_quasi_newton_type == "LBFGS" ? SNES_QN_LBFGS : SNES_QN_BROYDEN);
+        IBTK_CHKERRQ(ierr);
+
+        // Use the Jacobian solver configured below (FGMRES preconditioned by
+        // the composite IB preconditioner) as the initial approximation to the
+        // inverse Jacobian, rather than a scalar multiple of the identity.
+        ierr = SNESQNSetScaleType(snes, SNES_QN_SCALE_JACOBIAN);
+        IBTK_CHKERRQ(ierr);
+    }
+    ierr = SNESSetLagJacobian(snes, d_jacobian_lag);
+    IBTK_CHKERRQ(ierr);
+    d_first_jacobian_setup = true;
 
     Mat jac;
     ierr = VecGetLocalSize(composite_sol_petsc_vec, &n_local);
@@ -320,6 +368,7 @@ void IBImplicitStaggeredHierarchyIntegrator::integrateHierarchy(const double cur
     IBTK_CHKERRQ(ierr);
     ierr = PCSetType(schur_pc, PCNONE);
     IBTK_CHKERRQ(ierr);
+    if (d_use_schur_pc) setupSchurComplementPreconditioner(schur, lag_sol_petsc_vec);
     ierr = KSPSetFromOptions(d_schur_solver);
     IBTK_CHKERRQ(ierr);
 
@@ -451,6 +500,7 @@ void IBImplicitStaggeredHierarchyIntegrator::postprocessIntegrateHierarchy(
     }
     cfl_max = SAMRAI_MPI::maxReduction(cfl_max);
     d_regrid_cfl_estimate += cfl_max;
+    d_point_cfl_previous = cfl_max;
     if (d_enable_logging)
         plog << d_object_name << "::postprocessIntegrateHierarchy(): CFL number = " << cfl_max
              << "\n";
@@ -467,6 +517,9 @@ void IBImplicitStaggeredHierarchyIntegrator::postprocessIntegrateHierarchy(
     // Deallocate IB data.
     d_ib_implicit_ops->postprocessIntegrateData(current_time, new_time, num_cycles);
 
+    // Age the lagged linearization position by one time step.
+    if (d_X_jac_lagged) ++d_num_steps_since_jacobian_update;
+
     // Deallocate Eulerian scratch data.
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
@@ -493,6 +546,32 @@ void IBImplicitStaggeredHierarchyIntegrator::initializeHierarchyIntegrator(
     IBHierarchyIntegrator::initializeHierarchyIntegrator(hierarchy, gridding_alg);
 } // initializeHierarchyIntegrator
 
+void IBImplicitStaggeredHierarchyIntegrator::regridHierarchy()
+{
+    IBHierarchyIntegrator::regridHierarchy();
+
+    // The Lagrangian data may have been redistributed, so any assembled
+    // approximation to the Schur complement and any lagged linearization
+    // position are no longer valid.
+    PetscErrorCode ierr;
+    if (d_schur_pc_mat)
+    {
+        ierr = MatDestroy(&d_schur_pc_mat);
+        IBTK_CHKERRQ(ierr);
+    }
+    if (d_schur_pc_X)
+    {
+        ierr = VecDestroy(&d_schur_pc_X);
+        IBTK_CHKERRQ(ierr);
+    }
+    if (d_X_jac_lagged)
+    {
+        ierr = VecDestroy(&d_X_jac_lagged);
+        IBTK_CHKERRQ(ierr);
+    }
+    return;
+} // regridHierarchy
+
 int IBImplicitStaggeredHierarchyIntegrator::getNumberOfCycles() const
 {
     return d_ins_hier_integrator->getNumberOfCycles();
@@ -510,6 +589,42 @@ void IBImplicitStaggeredHierarchyIntegrator::putToDatabaseSpecialized(Pointer<Da
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void IBImplicitStaggeredHierarchyIntegrator::getFromInput(Pointer<Database> db)
+{
+    if (db->keyExists("use_approximate_schur_complement_pc"))
+        d_use_schur_pc = db->getBool("use_approximate_schur_complement_pc");
+    if (db->keyExists("schur_complement_pc_reassembly_tol"))
+        d_schur_pc_reassembly_tol = db->getDouble("schur_complement_pc_reassembly_tol");
+    if (db->keyExists("jacobian_lag")) d_jacobian_lag = db->getInteger("jacobian_lag");
+    if (db->keyExists("jacobian_lag_time_steps"))
+        d_jacobian_lag_time_steps = db->getInteger("jacobian_lag_time_steps");
+    if (db->keyExists("quasi_newton_type"))
+        d_quasi_newton_type = db->getString("quasi_newton_type");
+    if (d_jacobian_lag == 0 || d_jacobian_lag < -2)
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                 << "  invalid jacobian_lag: " << d_jacobian_lag << "\n"
+                                 << "  valid values are -2, -1, or a positive integer."
+                                 << std::endl);
+    }
+    if (d_jacobian_lag_time_steps < 1)
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                 << "  jacobian_lag_time_steps must be positive."
+                                 << std::endl);
+    }
+    if (d_quasi_newton_type != "NONE" && d_quasi_newton_type != "BROYDEN" &&
+        d_quasi_newton_type != "LBFGS")
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                 << "  unsupported quasi_newton_type: " << d_quasi_newton_type
+                                 << "\n"
+                                 << "  valid types are NONE, BROYDEN, and LBFGS."
+                                 << std::endl);
+    }
+    return;
+} // getFromInput
+
 void IBImplicitStaggeredHierarchyIntegrator::getFromRestart()
 {
     Pointer<Database> restart_db = RestartManager::getManager()->getRootDatabase();
@@ -638,7 +753,35 @@ PetscErrorCode IBImplicitStaggeredHierarchyIntegrator::compositeIBJacobianSetup(
     ierr = VecMultiVecGetSubVecs(x, &component_sol_vecs);
     IBTK_CHKERRQ(ierr);
     Vec X = component_sol_vecs[1];
+    if (!d_first_jacobian_setup)
+    {
+        d_ib_implicit_ops->setLinearizedPosition(X);
+        return 0;
+    }
+
+    // At the first Newton iteration of each cycle, reuse the lagged
+    // linearization position if it was recorded fewer than
+    // d_jacobian_lag_time_steps time steps ago.  Its age is advanced once per
+    // time step in postprocessIntegrateHierarchy(), independently of the number
+    // of cycles.
+    d_first_jacobian_setup = false;
+    if (d_X_jac_lagged && d_num_steps_since_jacobian_update < d_jacobian_lag_time_steps)
+    {
+        d_ib_implicit_ops->setLinearizedPosition(d_X_jac_lagged);
+        return 0;
+    }
     d_ib_implicit_ops->setLinearizedPosition(X);
+    if (d_jacobian_lag_time_steps > 1)
+    {
+        if (!d_X_jac_lagged)
+        {
+            ierr = VecDuplicate(X, &d_X_jac_lagged);
+            IBTK_CHKERRQ(ierr);
+        }
+        ierr = VecCopy(X, d_X_jac_lagged);
+        IBTK_CHKERRQ(ierr);
+        d_num_steps_since_jacobian_update = 0;
+    }
     return 0;
 } // compositeIBJacobianSetup
 
@@ -886,6 +1029,80 @@ PetscErrorCode IBImplicitStaggeredHierarchyIntegrator::lagrangianSchurApply(Vec
     return 0;
 } // lagrangianSchurApply
 
+void IBImplicitStaggeredHierarchyIntegrator::setupSchurComplementPreconditioner(Mat schur,
+                                                                                Vec X)
+{
+    PetscErrorCode ierr;
+
+    // The matrix-free Schur complement is Sc = I-alpha*J*S*A with
+    // alpha = dt/(4*C); see lagrangianSchurApply().
+    const double alpha =
+        0.25 * d_current_dt / d_stokes_op->getVelocityPoissonSpecifications().getCConstant();
+
+    // Determine whether the structure has moved appreciably since the
+    // approximate Schur complement was last assembled.
+    bool reassemble = !d_schur_pc_mat || !d_schur_pc_X ||
+                      !MathUtilities<double>::equalEps(alpha, d_schur_pc_alpha);
+    if (!reassemble)
+    {
+        Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+        const double* const dx_coarsest = grid_geom->getDx();
+        const IntVector<NDIM>& ratio =
+            d_hierarchy->getPatchLevel(d_hierarchy->getFinestLevelNumber())->getRatio();
+        double dx_min = std::numeric_limits<double>::max();
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            dx_min = std::min(dx_min, dx_coarsest[d] / static_cast<double>(ratio(d)));
+        }
+        Vec dX;
+        ierr = VecDuplicate(X, &dX);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecWAXPY(dX, -1.0, d_schur_pc_X, X);
+        IBTK_CHKERRQ(ierr);
+        double max_displacement;
+        ierr = VecNorm(dX, NORM_INFINITY, &max_displacement);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecDestroy(&dX);
+        IBTK_CHKERRQ(ierr);
+        reassemble = max_displacement > d_schur_pc_reassembly_tol * dx_min;
+    }
+
+    if (reassemble)
+    {
+        if (d_enable_logging)
+            plog << d_object_name << "::integrateHierarchy(): assembling approximate "
+                                     "Lagrangian Schur complement\n";
+        if (!d_ib_implicit_ops->constructApproximateSchurComplement(d_schur_pc_mat, X, alpha))
+        {
+            TBOX_WARNING(d_object_name << "::integrateHierarchy():\n"
+                                       << "  IB strategy does not provide an approximate "
+                                          "Lagrangian Schur complement.\n"
+                                       << "  Schur complement solver will be "
+                                          "unpreconditioned."
+                                       << std::endl);
+            d_use_schur_pc = false;
+            return;
+        }
+        if (!d_schur_pc_X)
+        {
+            ierr = VecDuplicate(X, &d_schur_pc_X);
+            IBTK_CHKERRQ(ierr);
+        }
+        ierr = VecCopy(X, d_schur_pc_X);
+        IBTK_CHKERRQ(ierr);
+        d_schur_pc_alpha = alpha;
+    }
+
+    ierr = KSPSetOperators(d_schur_solver, schur, d_schur_pc_mat, SAME_PRECONDITIONER);
+    IBTK_CHKERRQ(ierr);
+    PC schur_pc;
+    ierr = KSPGetPC(d_schur_solver, &schur_pc);
+    IBTK_CHKERRQ(ierr);
+    ierr = PCSetType(schur_pc, PCBJACOBI);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // setupSchurComplementPreconditioner
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
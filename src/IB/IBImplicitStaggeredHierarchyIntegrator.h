@@ -138,6 +138,12 @@ public:
         SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
         SAMRAI::tbox::Pointer<SAMRAI::mesh::GriddingAlgorithm<NDIM> > gridding_alg);
 
+    /*!
+     * Regrid the hierarchy and invalidate any assembled approximation to the
+     * Lagrangian Schur complement and any lagged Jacobian linearization.
+     */
+    void regridHierarchy();
+
     /*!
      * Returns the number of cycles to perform for the present time step.
      */
@@ -180,12 +186,25 @@ private:
     IBImplicitStaggeredHierarchyIntegrator&
     operator=(const IBImplicitStaggeredHierarchyIntegrator& that);
 
+    /*!
+     * Read input values from a given database.
+     */
+    void getFromInput(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
+
     /*!
      * Read object state from the restart file and initialize class data
      * members.
      */
     void getFromRestart();
 
+    /*!
+     * Reassemble the approximate Lagrangian Schur complement used to
+     * precondition the Schur complement solver if the structure has moved
+     * appreciably or the time step size has changed since it was last
+     * assembled, and set up the Schur complement solver to use it.
+     */
+    void setupSchurComplementPreconditioner(Mat schur, Vec X);
+
     /*!
      * Static function for implicit formulation.
      */
@@ -245,6 +264,39 @@ private:
     SAMRAI::tbox::Pointer<StaggeredStokesSolver> d_stokes_solver;
     SAMRAI::tbox::Pointer<StaggeredStokesOperator> d_stokes_op;
     KSP d_schur_solver;
+
+    /*
+     * Explicitly assembled approximation to the Lagrangian Schur complement,
+     * along with the Lagrangian configuration and the scaling at which it was
+     * assembled.  The approximation is reassembled once the structure has
+     * moved by more than d_schur_pc_reassembly_tol meshwidths.
+     */
+    bool d_use_schur_pc;
+    double d_schur_pc_reassembly_tol;
+    Mat d_schur_pc_mat;
+    Vec d_schur_pc_X;
+    double d_schur_pc_alpha;
+
+    /*
+     * Jacobian lagging and nonlinear solver options.
+     *
+     * The linearization of the Lagrangian force is updated every
+     * d_jacobian_lag Newton iterations.  At the first Newton iteration of a
+     * time step, the linearization position from a previous time step is
+     * reused until it is d_jacobian_lag_time_steps time steps old.  The age
+     * d_num_steps_since_jacobian_update counts completed time steps, not
+     * cycles.
+     *
+     * If d_quasi_newton_type is not "NONE", the nonlinear system is solved by
+     * SNESQN with the requested update, and the initial approximation to the
+     * inverse Jacobian is applied by the SNES Jacobian solver (FGMRES with the
+     * composite IB preconditioner) via SNES_QN_SCALE_JACOBIAN.
+     */
+    int d_jacobian_lag, d_jacobian_lag_time_steps;
+    int d_num_steps_since_jacobian_update;
+    bool d_first_jacobian_setup;
+    Vec d_X_jac_lagged;
+    std::string d_quasi_newton_type;
     SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_u_scratch_vec,
         d_f_scratch_vec;
 };
@@ -54,6 +54,13 @@ IBImplicitStrategy::~IBImplicitStrategy()
     return;
 } // ~IBImplicitStrategy
 
+bool IBImplicitStrategy::constructApproximateSchurComplement(Mat& /*Sc_mat*/,
+                                                             Vec& /*X_vec*/,
+                                                             double /*alpha*/)
+{
+    return false;
+} // constructApproximateSchurComplement
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
@@ -38,6 +38,7 @@
 #include <vector>
 
 #include "ibamr/IBStrategy.h"
+#include "petscmat.h"
 #include "petscvec.h"
 
 namespace IBTK
@@ -143,6 +144,26 @@ public:
             f_prolongation_scheds,
         double data_time) = 0;
 
+    /*!
+     * Construct an explicitly assembled approximation to the Lagrangian Schur
+     * complement
+     *
+     *    Sc = I - alpha*J*S*A
+     *
+     * in which S and J are the spreading and interpolation operators and A is
+     * the Jacobian of the Lagrangian force, all evaluated for the specified
+     * position vector.  The matrix is intended to be used only to precondition
+     * the matrix-free Schur complement, and so implementations may employ any
+     * convenient local approximation of J*S.
+     *
+     * \return true if the matrix was constructed, false if the implementation
+     * does not provide such an approximation.
+     *
+     * \note A default implementation is provided that does not construct a
+     * matrix and returns false.
+     */
+    virtual bool constructApproximateSchurComplement(Mat& Sc_mat, Vec& X_vec, double alpha);
+
 protected:
 private:
     /*!
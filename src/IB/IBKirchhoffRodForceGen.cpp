@@ -37,8 +37,10 @@
 #include <ostream>
 #include <vector>
 
+#include "Box.h"
 #include "Eigen/Geometry"
 #include "IntVector.h"
+#include "Patch.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
 #include "boost/array.hpp"
@@ -57,6 +59,10 @@
 #include "ibtk/LNode.h"
 #include "ibtk/LNodeIndex-inl.h"
 #include "ibtk/LNode-inl.h"
+#include "ibtk/LNodeSetData.h"
+#include "ibtk/LSetData.h"
+#include "ibtk/LSetDataIterator.h"
+#include "ibtk/PatchTaskExecutor.h"
 #include "ibtk/ibtk_utilities.h"
 #include "petscmat.h"
 #include "petscsys.h"
@@ -66,7 +72,6 @@
 #include "tbox/Timer.h"
 #include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
-#include "unsupported/Eigen/MatrixFunctions"
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -79,13 +84,211 @@ namespace
 // Timers.
 static Timer* t_compute_lagrangian_force_and_torque;
 static Timer* t_initialize_level_data;
+
+// Compute the principal square root of the rotation that maps the directors at
+// the "current" node to those at the "next" node, i.e., of A = sum_i D_next_i
+// D_i^T, using the unit quaternion of A.  When the directors are orthonormal,
+// this agrees with the principal matrix square root of A but avoids a Schur
+// decomposition.
+//
+// NOTE: The result is always a proper rotation.  If the directors have drifted
+// from orthonormality, A is not a rotation, and the quaternion extracted from A
+// is only an approximation of its rotational part.  The half-step directors
+// then differ from the matrix square root of A used previously by an amount
+// proportional to the drift.
+inline Matrix3d compute_half_rotation(const Matrix3d& A)
+{
+    Eigen::Quaterniond q(A);
+    q.normalize();
+    if (q.w() < 0.0) q.coeffs() = -q.coeffs();
+    q.w() += 1.0;
+    q.normalize();
+    return q.toRotationMatrix();
+} // compute_half_rotation
+
+// Compute the force F_half and the torque N_half transmitted by each rod whose
+// "current" node lies in the interior of a patch, along with the moment
+// M_half = 0.5*(X_next - X) x F_half.  Every rod has exactly one "current" node,
+// which is local, so that each rod is processed by exactly one patch task.
+class RodForceTask
+{
+public:
+    RodForceTask(
+        const int lag_node_index_idx,
+        const std::vector<int>& local_node_rod_offsets,
+        const std::vector<int>& local_node_rod_idxs,
+        const boost::array<std::vector<double>, IBRodForceSpec::NUM_MATERIAL_PARAMS>&
+            material_params,
+        const double* const D_vals,
+        const double* const D_next_vals,
+        const double* const X_vals,
+        const double* const X_next_vals,
+        double* const F_half_vals,
+        double* const N_half_vals,
+        double* const M_half_vals)
+        : d_lag_node_index_idx(lag_node_index_idx),
+          d_local_node_rod_offsets(local_node_rod_offsets),
+          d_local_node_rod_idxs(local_node_rod_idxs), d_material_params(material_params),
+          d_D_vals(D_vals), d_D_next_vals(D_next_vals), d_X_vals(X_vals),
+          d_X_next_vals(X_next_vals), d_F_half_vals(F_half_vals), d_N_half_vals(N_half_vals),
+          d_M_half_vals(M_half_vals)
+    {
+        // intentionally blank
+    }
+
+    void operator()(const Pointer<Patch<NDIM> >& patch) const
+    {
+        const Box<NDIM>& patch_box = patch->getBox();
+        const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_idx);
+        for (LNodeSetData::DataIterator it = idx_data->data_begin(patch_box);
+             it != idx_data->data_end();
+             ++it)
+        {
+            const int n = (*it)->getLocalPETScIndex();
+            for (int e = d_local_node_rod_offsets[n]; e < d_local_node_rod_offsets[n + 1]; ++e)
+            {
+                if (d_local_node_rod_idxs[e] % 2 == 0)
+                {
+                    computeRodForce(d_local_node_rod_idxs[e] / 2, n);
+                }
+            }
+        }
+        return;
+    } // operator()
+
+private:
+    void computeRodForce(const int k, const int curr_idx) const
+    {
+        Eigen::Map<const Matrix3d> D_mat(&d_D_vals[curr_idx * 3 * 3]);
+        Eigen::Map<const Matrix3d> D_next_mat(&d_D_next_vals[k * 3 * 3]);
+        Eigen::Map<const Vector3d> X(&d_X_vals[curr_idx * NDIM]);
+        Eigen::Map<const Vector3d> X_next(&d_X_next_vals[k * NDIM]);
+
+        // The columns of D_mat and D_next_mat are the directors D1, D2, D3, so
+        // that A = sum_i D_next_i D_i^T = D_next_mat * D_mat^T.
+        const Matrix3d D_half_mat =
+            compute_half_rotation(D_next_mat * D_mat.transpose()) * D_mat;
+        const Vector3d D1_half = D_half_mat.col(0);
+        const Vector3d D2_half = D_half_mat.col(1);
+        const Vector3d D3_half = D_half_mat.col(2);
+
+        // Compute the strains and the resulting force.
+        const double ds_inv = 1.0 / d_material_params[0][k];
+        const Vector3d dX_ds((X_next - X) * ds_inv);
+        const double F1 = d_material_params[4][k] * D1_half.dot(dX_ds);
+        const double F2 = d_material_params[5][k] * D2_half.dot(dX_ds);
+        const double F3 = d_material_params[6][k] * (D3_half.dot(dX_ds) - 1.0);
+        Eigen::Map<Vector3d> F_half(&d_F_half_vals[k * NDIM]);
+        F_half = F1 * D1_half + F2 * D2_half + F3 * D3_half;
+
+        // Compute the curvatures and twist and the resulting torque.
+        const Matrix3d dD_ds((D_next_mat - D_mat) * ds_inv);
+        const double N1 =
+            d_material_params[1][k] * (dD_ds.col(1).dot(D3_half) - d_material_params[7][k]);
+        const double N2 =
+            d_material_params[2][k] * (dD_ds.col(2).dot(D1_half) - d_material_params[8][k]);
+        const double N3 =
+            d_material_params[3][k] * (dD_ds.col(0).dot(D2_half) - d_material_params[9][k]);
+        Eigen::Map<Vector3d> N_half(&d_N_half_vals[k * NDIM]);
+        N_half = N1 * D1_half + N2 * D2_half + N3 * D3_half;
+
+        Eigen::Map<Vector3d> M_half(&d_M_half_vals[k * NDIM]);
+        M_half = 0.5 * (X_next - X).cross(F_half);
+        return;
+    } // computeRodForce
+
+    const int d_lag_node_index_idx;
+    const std::vector<int>& d_local_node_rod_offsets;
+    const std::vector<int>& d_local_node_rod_idxs;
+    const boost::array<std::vector<double>, IBRodForceSpec::NUM_MATERIAL_PARAMS>&
+        d_material_params;
+    const double* const d_D_vals;
+    const double* const d_D_next_vals;
+    const double* const d_X_vals;
+    const double* const d_X_next_vals;
+    double* const d_F_half_vals;
+    double* const d_N_half_vals;
+    double* const d_M_half_vals;
+}; // RodForceTask
+
+// Accumulate the rod forces and torques at the local nodes in the interior of a
+// patch.  Each node gathers the contributions of its incident rods, so that
+// every entry of the force and torque vectors is written by exactly one patch
+// task.  The "current" node of rod k receives (F_half, N_half + M_half) and the
+// "next" node receives (-F_half, -N_half + M_half).
+class RodForceGatherTask
+{
+public:
+    RodForceGatherTask(const int lag_node_index_idx,
+                       const std::vector<int>& local_node_rod_offsets,
+                       const std::vector<int>& local_node_rod_idxs,
+                       const double* const F_half_vals,
+                       const double* const N_half_vals,
+                       const double* const M_half_vals,
+                       double* const F_vals,
+                       double* const N_vals)
+        : d_lag_node_index_idx(lag_node_index_idx),
+          d_local_node_rod_offsets(local_node_rod_offsets),
+          d_local_node_rod_idxs(local_node_rod_idxs), d_F_half_vals(F_half_vals),
+          d_N_half_vals(N_half_vals), d_M_half_vals(M_half_vals), d_F_vals(F_vals),
+          d_N_vals(N_vals)
+    {
+        // intentionally blank
+    }
+
+    void operator()(const Pointer<Patch<NDIM> >& patch) const
+    {
+        const Box<NDIM>& patch_box = patch->getBox();
+        const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_idx);
+        for (LNodeSetData::DataIterator it = idx_data->data_begin(patch_box);
+             it != idx_data->data_end();
+             ++it)
+        {
+            const int n = (*it)->getLocalPETScIndex();
+            double F_sum[NDIM], N_sum[NDIM];
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                F_sum[d] = 0.0;
+                N_sum[d] = 0.0;
+            }
+            for (int e = d_local_node_rod_offsets[n]; e < d_local_node_rod_offsets[n + 1]; ++e)
+            {
+                const int k = d_local_node_rod_idxs[e] / 2;
+                const double sgn = (d_local_node_rod_idxs[e] % 2 == 0 ? 1.0 : -1.0);
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    F_sum[d] += sgn * d_F_half_vals[k * NDIM + d];
+                    N_sum[d] +=
+                        sgn * d_N_half_vals[k * NDIM + d] + d_M_half_vals[k * NDIM + d];
+                }
+            }
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                d_F_vals[n * NDIM + d] += F_sum[d];
+                d_N_vals[n * NDIM + d] += N_sum[d];
+            }
+        }
+        return;
+    } // operator()
+
+private:
+    const int d_lag_node_index_idx;
+    const std::vector<int>& d_local_node_rod_offsets;
+    const std::vector<int>& d_local_node_rod_idxs;
+    const double* const d_F_half_vals;
+    const double* const d_N_half_vals;
+    const double* const d_M_half_vals;
+    double* const d_F_vals;
+    double* const d_N_vals;
+}; // RodForceGatherTask
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 IBKirchhoffRodForceGen::IBKirchhoffRodForceGen(Pointer<Database> input_db)
     : d_D_next_mats(), d_X_next_mats(), d_petsc_curr_node_idxs(), d_petsc_next_node_idxs(),
-      d_material_params(), d_is_initialized()
+      d_is_initialized(), d_material_params(), d_local_node_rod_offsets(),
+      d_local_node_rod_idxs(), d_nonlocal_next_rod_idxs(), d_nonlocal_next_node_idxs()
 {
     // Initialize object with data read from the input database.
     getFromInput(input_db);
@@ -149,15 +352,23 @@ IBKirchhoffRodForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM> >
     d_X_next_mats.resize(new_size);
     d_petsc_curr_node_idxs.resize(new_size);
     d_petsc_next_node_idxs.resize(new_size);
-    d_material_params.resize(new_size);
     d_is_initialized.resize(new_size, false);
+    d_material_params.resize(new_size);
+    d_local_node_rod_offsets.resize(new_size);
+    d_local_node_rod_idxs.resize(new_size);
+    d_nonlocal_next_rod_idxs.resize(new_size);
+    d_nonlocal_next_node_idxs.resize(new_size);
 
     Mat& D_next_mat = d_D_next_mats[level_num];
     Mat& X_next_mat = d_X_next_mats[level_num];
     std::vector<int>& petsc_curr_node_idxs = d_petsc_curr_node_idxs[level_num];
     std::vector<int>& petsc_next_node_idxs = d_petsc_next_node_idxs[level_num];
-    std::vector<boost::array<double, IBRodForceSpec::NUM_MATERIAL_PARAMS> >& material_params =
+    boost::array<std::vector<double>, IBRodForceSpec::NUM_MATERIAL_PARAMS>& material_params =
         d_material_params[level_num];
+    std::vector<int>& local_node_rod_offsets = d_local_node_rod_offsets[level_num];
+    std::vector<int>& local_node_rod_idxs = d_local_node_rod_idxs[level_num];
+    std::vector<int>& nonlocal_next_rod_idxs = d_nonlocal_next_rod_idxs[level_num];
+    std::vector<int>& nonlocal_next_node_idxs = d_nonlocal_next_node_idxs[level_num];
 
     if (D_next_mat)
     {
@@ -171,7 +382,14 @@ IBKirchhoffRodForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM> >
     }
     petsc_curr_node_idxs.clear();
     petsc_next_node_idxs.clear();
-    material_params.clear();
+    for (int p = 0; p < IBRodForceSpec::NUM_MATERIAL_PARAMS; ++p)
+    {
+        material_params[p].clear();
+    }
+    local_node_rod_offsets.clear();
+    local_node_rod_idxs.clear();
+    nonlocal_next_rod_idxs.clear();
+    nonlocal_next_node_idxs.clear();
 
     // The LMesh object provides the set of local Lagrangian nodes.
     const Pointer<LMesh> mesh = l_data_manager->getLMesh(level_num);
@@ -202,7 +420,10 @@ IBKirchhoffRodForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM> >
             {
                 petsc_curr_node_idxs.push_back(curr_idx);
                 petsc_next_node_idxs.push_back(next_idxs[k]);
-                material_params.push_back(params[k]);
+                for (int p = 0; p < IBRodForceSpec::NUM_MATERIAL_PARAMS; ++p)
+                {
+                    material_params[p].push_back(params[k][p]);
+                }
             }
         }
     }
@@ -216,9 +437,47 @@ IBKirchhoffRodForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM> >
     const int global_node_offset = l_data_manager->getGlobalNodeOffset(level_num);
     const int num_local_nodes = l_data_manager->getNumberOfLocalNodes(level_num);
 
-    // Determine the non-zero structure for the matrices.
     const unsigned int local_sz = petsc_curr_node_idxs.size();
 
+    // Build the local node-to-rod incidence lists.  Each local node collects
+    // the contributions of all of its incident rods, so that forces and torques
+    // can be accumulated without write conflicts.
+    local_node_rod_offsets.resize(num_local_nodes + 1, 0);
+    for (unsigned int k = 0; k < local_sz; ++k)
+    {
+        const int curr_idx = petsc_curr_node_idxs[k] - global_node_offset;
+        const int next_idx = petsc_next_node_idxs[k] - global_node_offset;
+        ++local_node_rod_offsets[curr_idx + 1];
+        if (next_idx >= 0 && next_idx < num_local_nodes)
+        {
+            ++local_node_rod_offsets[next_idx + 1];
+        }
+        else
+        {
+            nonlocal_next_rod_idxs.push_back(k);
+            nonlocal_next_node_idxs.push_back(petsc_next_node_idxs[k]);
+        }
+    }
+    for (int n = 0; n < num_local_nodes; ++n)
+    {
+        local_node_rod_offsets[n + 1] += local_node_rod_offsets[n];
+    }
+    local_node_rod_idxs.resize(local_node_rod_offsets[num_local_nodes]);
+    {
+        std::vector<int> pos(local_node_rod_offsets.begin(), local_node_rod_offsets.end() - 1);
+        for (unsigned int k = 0; k < local_sz; ++k)
+        {
+            const int curr_idx = petsc_curr_node_idxs[k] - global_node_offset;
+            const int next_idx = petsc_next_node_idxs[k] - global_node_offset;
+            local_node_rod_idxs[pos[curr_idx]++] = 2 * k;
+            if (next_idx >= 0 && next_idx < num_local_nodes)
+            {
+                local_node_rod_idxs[pos[next_idx]++] = 2 * k + 1;
+            }
+        }
+    }
+
+    // Determine the non-zero structure for the matrices.
     std::vector<int> next_d_nz(local_sz, 1), next_o_nz(local_sz, 0);
     for (unsigned int k = 0; k < local_sz; ++k)
     {
@@ -343,7 +602,7 @@ void IBKirchhoffRodForceGen::computeLagrangianForceAndTorque(
     Pointer<LData> N_data,
     Pointer<LData> X_data,
     Pointer<LData> D_data,
-    const Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
+    const Pointer<PatchHierarchy<NDIM> > hierarchy,
     const int level_number,
     const double /*data_time*/,
     LDataManager* const l_data_manager)
@@ -357,8 +616,6 @@ void IBKirchhoffRodForceGen::computeLagrangianForceAndTorque(
     TBOX_ASSERT(d_is_initialized[level_number]);
 #endif
 
-    const int global_offset = l_data_manager->getGlobalNodeOffset(level_number);
-
     int ierr;
 
     // Create appropriately sized temporary vectors.
@@ -403,90 +660,31 @@ void IBKirchhoffRodForceGen::computeLagrangianForceAndTorque(
     ierr = VecGetArray(X_next_vec, &X_next_vals);
     IBTK_CHKERRQ(ierr);
 
-    std::vector<int>& petsc_curr_node_idxs = d_petsc_curr_node_idxs[level_number];
-    std::vector<int>& petsc_next_node_idxs = d_petsc_next_node_idxs[level_number];
-    const std::vector<boost::array<double, IBRodForceSpec::NUM_MATERIAL_PARAMS> >&
-    material_params = d_material_params[level_number];
-
-    const unsigned int local_sz = petsc_curr_node_idxs.size();
-    std::vector<double> F_curr_node_vals(NDIM * local_sz, 0.0);
-    std::vector<double> N_curr_node_vals(NDIM * local_sz, 0.0);
-    std::vector<double> F_next_node_vals(NDIM * local_sz, 0.0);
-    std::vector<double> N_next_node_vals(NDIM * local_sz, 0.0);
-
-    for (unsigned int k = 0; k < local_sz; ++k)
+    // Compute the force, torque, and moment transmitted by each local rod.  The
+    // rods are processed by patch tasks that are grouped by the patch that
+    // contains their "current" node.
+    const Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+    const int lag_node_index_idx = l_data_manager->getLNodePatchDescriptorIndex();
+    const std::vector<int>& local_node_rod_offsets = d_local_node_rod_offsets[level_number];
+    const std::vector<int>& local_node_rod_idxs = d_local_node_rod_idxs[level_number];
+    const unsigned int local_sz = d_petsc_curr_node_idxs[level_number].size();
+    std::vector<double> F_half_vals(NDIM * local_sz);
+    std::vector<double> N_half_vals(NDIM * local_sz);
+    std::vector<double> M_half_vals(NDIM * local_sz);
+    if (local_sz > 0)
     {
-        // Compute the forces applied by the rod to the "current" and "next"
-        // nodes.
-        const int D1_offset = 0;
-        Eigen::Map<const Vector3d> D1(
-            &D_vals[(petsc_curr_node_idxs[k] - global_offset) * 3 * 3 + D1_offset]);
-        Eigen::Map<const Vector3d> D1_next(&D_next_vals[k * 3 * 3 + D1_offset]);
-
-        const int D2_offset = 3;
-        Eigen::Map<const Vector3d> D2(
-            &D_vals[(petsc_curr_node_idxs[k] - global_offset) * 3 * 3 + D2_offset]);
-        Eigen::Map<const Vector3d> D2_next(&D_next_vals[k * 3 * 3 + D2_offset]);
-
-        const int D3_offset = 6;
-        Eigen::Map<const Vector3d> D3(
-            &D_vals[(petsc_curr_node_idxs[k] - global_offset) * 3 * 3 + D3_offset]);
-        Eigen::Map<const Vector3d> D3_next(&D_next_vals[k * 3 * 3 + D3_offset]);
-
-        Eigen::Map<const Vector3d> X(
-            &X_vals[(petsc_curr_node_idxs[k] - global_offset) * NDIM]);
-        Eigen::Map<const Vector3d> X_next(&X_next_vals[k * NDIM]);
-
-        boost::array<Eigen::Map<const Vector3d>*, 3> D = { { &D1, &D2, &D3 } };
-        boost::array<Eigen::Map<const Vector3d>*, 3> D_next = { { &D1_next, &D2_next,
-                                                                  &D3_next } };
-        Matrix3d A(Matrix3d::Zero());
-        for (int i = 0; i < 3; ++i)
-        {
-            A += (*D_next[i]) * (*D[i]).transpose();
-        }
-        Matrix3d sqrt_A = A.sqrt();
-        Vector3d D1_half, D2_half, D3_half;
-        boost::array<Vector3d*, 3> D_half = { { &D1_half, &D2_half, &D3_half } };
-        for (int i = 0; i < 3; ++i)
-        {
-            *D_half[i] = sqrt_A * (*D[i]);
-        }
-
-        const double ds = material_params[k][0];
-        const double a1 = material_params[k][1];
-        const double a2 = material_params[k][2];
-        const double a3 = material_params[k][3];
-        const double b1 = material_params[k][4];
-        const double b2 = material_params[k][5];
-        const double b3 = material_params[k][6];
-        const double kappa1 = material_params[k][7];
-        const double kappa2 = material_params[k][8];
-        const double tau = material_params[k][9];
-
-        const Vector3d dX_ds((X_next - X) / ds);
-        const double F1 = b1 * D1_half.dot(dX_ds);
-        const double F2 = b2 * D2_half.dot(dX_ds);
-        const double F3 = b3 * (D3_half.dot(dX_ds) - 1.0);
-        const Vector3d F_half = F1 * D1_half + F2 * D2_half + F3 * D3_half;
-
-        const Vector3d dD1_ds((D1_next - D1) / ds);
-        const Vector3d dD2_ds((D2_next - D2) / ds);
-        const Vector3d dD3_ds((D3_next - D3) / ds);
-        const double N1 = a1 * (dD2_ds.dot(D3_half) - kappa1);
-        const double N2 = a2 * (dD3_ds.dot(D1_half) - kappa2);
-        const double N3 = a3 * (dD1_ds.dot(D2_half) - tau);
-        const Vector3d N_half = N1 * D1_half + N2 * D2_half + N3 * D3_half;
-
-        Eigen::Map<Vector3d> F_curr(&F_curr_node_vals[k * NDIM]);
-        Eigen::Map<Vector3d> F_next(&F_next_node_vals[k * NDIM]);
-        F_curr = F_half;
-        F_next = -F_half;
-
-        Eigen::Map<Vector3d> N_curr(&N_curr_node_vals[k * NDIM]);
-        Eigen::Map<Vector3d> N_next(&N_next_node_vals[k * NDIM]);
-        N_curr = N_half + 0.5 * (X_next - X).cross(F_half);
-        N_next = -N_half + 0.5 * (X_next - X).cross(F_half);
+        const RodForceTask rod_force_task(lag_node_index_idx,
+                                          local_node_rod_offsets,
+                                          local_node_rod_idxs,
+                                          d_material_params[level_number],
+                                          D_vals,
+                                          D_next_vals,
+                                          X_vals,
+                                          X_next_vals,
+                                          &F_half_vals[0],
+                                          &N_half_vals[0],
+                                          &M_half_vals[0]);
+        PatchTaskExecutor::execute(rod_force_task, level);
     }
 
     ierr = VecRestoreArray(D_vec, &D_vals);
@@ -505,31 +703,59 @@ void IBKirchhoffRodForceGen::computeLagrangianForceAndTorque(
     ierr = VecDestroy(&X_next_vec);
     IBTK_CHKERRQ(ierr);
 
+    // Accumulate the forces and torques at the local nodes.
     Vec F_vec = F_data->getVec();
     Vec N_vec = N_data->getVec();
+    double* F_vals;
+    ierr = VecGetArray(F_vec, &F_vals);
+    IBTK_CHKERRQ(ierr);
+    double* N_vals;
+    ierr = VecGetArray(N_vec, &N_vals);
+    IBTK_CHKERRQ(ierr);
     if (local_sz > 0)
     {
+        const RodForceGatherTask rod_force_gather_task(lag_node_index_idx,
+                                                       local_node_rod_offsets,
+                                                       local_node_rod_idxs,
+                                                       &F_half_vals[0],
+                                                       &N_half_vals[0],
+                                                       &M_half_vals[0],
+                                                       F_vals,
+                                                       N_vals);
+        PatchTaskExecutor::execute(rod_force_gather_task, level);
+    }
+    ierr = VecRestoreArray(F_vec, &F_vals);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecRestoreArray(N_vec, &N_vals);
+    IBTK_CHKERRQ(ierr);
+
+    // Communicate the contributions to "next" nodes owned by other processes.
+    const std::vector<int>& nonlocal_next_rod_idxs = d_nonlocal_next_rod_idxs[level_number];
+    const std::vector<int>& nonlocal_next_node_idxs = d_nonlocal_next_node_idxs[level_number];
+    const unsigned int nonlocal_sz = nonlocal_next_rod_idxs.size();
+    if (nonlocal_sz > 0)
+    {
+        std::vector<double> F_next_node_vals(NDIM * nonlocal_sz);
+        std::vector<double> N_next_node_vals(NDIM * nonlocal_sz);
+        for (unsigned int m = 0; m < nonlocal_sz; ++m)
+        {
+            const int k = nonlocal_next_rod_idxs[m];
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                F_next_node_vals[m * NDIM + d] = -F_half_vals[k * NDIM + d];
+                N_next_node_vals[m * NDIM + d] =
+                    -N_half_vals[k * NDIM + d] + M_half_vals[k * NDIM + d];
+            }
+        }
         ierr = VecSetValuesBlocked(F_vec,
-                                   petsc_curr_node_idxs.size(),
-                                   &petsc_curr_node_idxs[0],
-                                   &F_curr_node_vals[0],
-                                   ADD_VALUES);
-        IBTK_CHKERRQ(ierr);
-        ierr = VecSetValuesBlocked(F_vec,
-                                   petsc_next_node_idxs.size(),
-                                   &petsc_next_node_idxs[0],
+                                   nonlocal_sz,
+                                   &nonlocal_next_node_idxs[0],
                                    &F_next_node_vals[0],
                                    ADD_VALUES);
         IBTK_CHKERRQ(ierr);
         ierr = VecSetValuesBlocked(N_vec,
-                                   petsc_curr_node_idxs.size(),
-                                   &petsc_curr_node_idxs[0],
-                                   &N_curr_node_vals[0],
-                                   ADD_VALUES);
-        IBTK_CHKERRQ(ierr);
-        ierr = VecSetValuesBlocked(N_vec,
-                                   petsc_next_node_idxs.size(),
-                                   &petsc_next_node_idxs[0],
+                                   nonlocal_sz,
+                                   &nonlocal_next_node_idxs[0],
                                    &N_next_node_vals[0],
                                    ADD_VALUES);
         IBTK_CHKERRQ(ierr);
@@ -73,6 +73,18 @@ namespace IBAMR
  * \brief Class IBKirchhoffRodForceGen computes the forces and torques generated
  * by a collection of linear elements based on Kirchhoff rod theory.
  *
+ * Rod forces and torques are computed and accumulated by IBTK::PatchTaskExecutor
+ * tasks over the patches that contain the local nodes.  Each node gathers the
+ * contributions of its incident rods, so that the results do not depend on the
+ * number of threads.
+ *
+ * The half-step directors are obtained by applying the unit-quaternion square
+ * root of the incremental rotation to the directors at the "current" node.
+ * This agrees with the principal matrix square root to rounding error only
+ * when the directors are orthonormal.  If they drift from orthonormality, the
+ * computed forces and torques differ from those obtained with the matrix
+ * square root.
+ *
  * \note Class IBKirchhoffRodForceGen DOES NOT correct for periodic
  * displacements of IB points.
  */
@@ -151,9 +163,30 @@ private:
     //\{
     std::vector<Mat> d_D_next_mats, d_X_next_mats;
     std::vector<std::vector<int> > d_petsc_curr_node_idxs, d_petsc_next_node_idxs;
-    std::vector<std::vector<boost::array<double, IBRodForceSpec::NUM_MATERIAL_PARAMS> > >
-    d_material_params;
     std::vector<bool> d_is_initialized;
+
+    /*
+     * Material parameters stored in structure-of-arrays form: entry k of
+     * d_material_params[ln][p] is material parameter p of the k-th local rod.
+     */
+    std::vector<boost::array<std::vector<double>, IBRodForceSpec::NUM_MATERIAL_PARAMS> >
+    d_material_params;
+
+    /*
+     * Local node-to-rod incidence lists used to accumulate rod forces and
+     * torques without write conflicts.  The rods incident to local node n are
+     * stored in entries [d_local_node_rod_offsets[ln][n],
+     * d_local_node_rod_offsets[ln][n+1]) of d_local_node_rod_idxs[ln], with
+     * rod k encoded as 2*k when n is its "current" node and as 2*k+1 when n is
+     * its "next" node.
+     */
+    std::vector<std::vector<int> > d_local_node_rod_offsets, d_local_node_rod_idxs;
+
+    /*
+     * Rods whose "next" node is not owned by this process, along with the
+     * PETSc indices of those nodes.
+     */
+    std::vector<std::vector<int> > d_nonlocal_next_rod_idxs, d_nonlocal_next_node_idxs;
     //\}
 };
 } // namespace IBAMR
@@ -36,9 +36,12 @@
 #include <algorithm>
 #include <cmath>
 #include <functional>
+#include <iomanip>
 #include <limits>
+#include <map>
 #include <numeric>
 #include <ostream>
+#include <sstream>
 
 #include "BasePatchHierarchy.h"
 #include "BasePatchLevel.h"
@@ -49,6 +52,7 @@
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
 #include "CellIndex.h"
+#include "HierarchyDataOpsManager.h"
 #include "HierarchyDataOpsReal.h"
 #include "IBMethod.h"
 #include "Index.h"
@@ -124,6 +128,38 @@ inline double cos_kernel(const double x, const double eps)
     }
 } // cos_kernel
 
+inline double ib_4_kernel(double r)
+{
+    r = std::abs(r);
+    if (r < 1.0)
+    {
+        return 0.125 * (3.0 - 2.0 * r + sqrt(1.0 + 4.0 * r - 4.0 * r * r));
+    }
+    else if (r < 2.0)
+    {
+        return 0.125 * (5.0 - 2.0 * r - sqrt(-7.0 + 12.0 * r - 4.0 * r * r));
+    }
+    else
+    {
+        return 0.0;
+    }
+} // ib_4_kernel
+
+// Compute sum_m phi(a-m)*phi(b-m) for the IB_4 kernel, in which a and b are
+// positions measured in units of the grid spacing relative to the grid points.
+inline double ib_4_kernel_overlap(const double a, const double b)
+{
+    const int m_lower = static_cast<int>(std::ceil(std::max(a, b) - 2.0));
+    const int m_upper = static_cast<int>(std::floor(std::min(a, b) + 2.0));
+    double overlap = 0.0;
+    for (int m = m_lower; m <= m_upper; ++m)
+    {
+        overlap += ib_4_kernel(a - static_cast<double>(m)) *
+                   ib_4_kernel(b - static_cast<double>(m));
+    }
+    return overlap;
+} // ib_4_kernel_overlap
+
 // Version of IBMethod restart file data.
 static const int IB_METHOD_VERSION = 1;
 }
@@ -158,7 +194,11 @@ IBMethod::IBMethod(const std::string& object_name,
     d_spread_kernel_fcn = "IB_4";
     d_ghosts = std::max(LEInteractor::getMinimumGhostWidth(d_interp_kernel_fcn),
                         LEInteractor::getMinimumGhostWidth(d_spread_kernel_fcn));
+    d_use_occupancy_tagging = false;
+    d_occupancy_tagging_block_size = 4;
     d_do_log = false;
+    d_lag_checkpoint_dirname = "";
+    d_lag_checkpoint_restart_dirname = "";
 
     // Initialize object with data read from the input and restart databases.
     bool from_restart = RestartManager::getManager()->isFromRestart();
@@ -182,6 +222,8 @@ IBMethod::IBMethod(const std::string& object_name,
                                                 d_ghosts,
                                                 d_registered_for_restart);
     d_ghosts = d_l_data_manager->getGhostCellWidth();
+    d_l_data_manager->setUseOccupancyTagging(d_use_occupancy_tagging,
+                                             d_occupancy_tagging_block_size);
 
     // Create the instrument panel object.
     d_instrument_panel =
@@ -211,6 +253,7 @@ IBMethod::IBMethod(const std::string& object_name,
 
     // Indicate that the Jacobian matrix has not been allocated.
     d_force_jac = NULL;
+    d_schur_pc_force_jac = NULL;
     return;
 } // IBMethod
 
@@ -227,6 +270,12 @@ IBMethod::~IBMethod()
         ierr = MatDestroy(&d_force_jac);
         IBTK_CHKERRQ(ierr);
     }
+    if (d_schur_pc_force_jac)
+    {
+        PetscErrorCode ierr;
+        ierr = MatDestroy(&d_schur_pc_force_jac);
+        IBTK_CHKERRQ(ierr);
+    }
     return;
 } // ~IBMethod
 
@@ -479,6 +528,10 @@ IBMethod::postprocessIntegrateData(double current_time, double new_time, int /*n
     d_current_time = std::numeric_limits<double>::quiet_NaN();
     d_new_time = std::numeric_limits<double>::quiet_NaN();
     d_half_time = std::numeric_limits<double>::quiet_NaN();
+
+    // Complete any Lagrangian checkpoint writes posted by the most recent
+    // restart dump.
+    d_l_data_manager->endLagrangianCheckpoint();
     return;
 } // postprocessIntegrateData
 
@@ -799,6 +852,229 @@ void IBMethod::spreadLinearizedForce(
     return;
 } // spreadLinearizedForce
 
+bool IBMethod::constructApproximateSchurComplement(Mat& Sc_mat, Vec& X_vec, const double alpha)
+{
+    if (!d_ib_force_fcn) return false;
+    const int level_num = d_hierarchy->getFinestLevelNumber();
+    if (!d_l_data_manager->levelContainsLagrangianData(level_num)) return false;
+
+    int ierr;
+    const double half_time = d_current_time + 0.5 * (d_new_time - d_current_time);
+    const int global_node_offset = d_l_data_manager->getGlobalNodeOffset(level_num);
+    const int num_local_nodes = d_l_data_manager->getNumberOfLocalNodes(level_num);
+    const int num_global_nodes =
+        static_cast<int>(d_l_data_manager->getNumberOfNodes(level_num));
+
+    // Assemble the Jacobian of the Lagrangian force A = dF/dX, linearized
+    // about the specified configuration.  The non-zero structure of A depends
+    // only on the connectivity of the structure, and so it is determined only
+    // when the Lagrangian data are (re-)distributed.
+    setLinearizedPosition(X_vec);
+    std::vector<Pointer<LData> >* X_jac_data;
+    bool* X_jac_needs_ghost_fill;
+    getLinearizedPositionData(&X_jac_data, &X_jac_needs_ghost_fill);
+    Pointer<LData> X_jac = (*X_jac_data)[level_num];
+    if (*X_jac_needs_ghost_fill)
+    {
+        X_jac->beginGhostUpdate();
+        X_jac->endGhostUpdate();
+        *X_jac_needs_ghost_fill = false;
+    }
+
+    Mat& A_mat = d_schur_pc_force_jac;
+    if (!A_mat)
+    {
+        std::vector<int> d_nnz(NDIM * num_local_nodes, 0), o_nnz(NDIM * num_local_nodes, 0);
+        d_ib_force_fcn->computeLagrangianForceJacobianNonzeroStructure(
+            d_nnz, o_nnz, d_hierarchy, level_num, d_l_data_manager);
+        std::vector<int> d_bnnz(num_local_nodes), o_bnnz(num_local_nodes);
+        for (int k = 0; k < num_local_nodes; ++k)
+        {
+            d_bnnz[k] = std::max(1, std::min(d_nnz[NDIM * k], num_local_nodes));
+            o_bnnz[k] = std::min(o_nnz[NDIM * k], num_global_nodes - num_local_nodes);
+        }
+        ierr = MatCreate(PETSC_COMM_WORLD, &A_mat);
+        IBTK_CHKERRQ(ierr);
+        ierr = MatSetSizes(A_mat,
+                           NDIM * num_local_nodes,
+                           NDIM * num_local_nodes,
+                           PETSC_DETERMINE,
+                           PETSC_DETERMINE);
+        IBTK_CHKERRQ(ierr);
+        ierr = MatSetBlockSize(A_mat, NDIM);
+        IBTK_CHKERRQ(ierr);
+        ierr = MatSetType(A_mat, MATAIJ);
+        IBTK_CHKERRQ(ierr);
+        ierr = MatXAIJSetPreallocation(A_mat,
+                                       NDIM,
+                                       num_local_nodes > 0 ? &d_bnnz[0] : NULL,
+                                       num_local_nodes > 0 ? &o_bnnz[0] : NULL,
+                                       NULL,
+                                       NULL);
+        IBTK_CHKERRQ(ierr);
+    }
+    else
+    {
+        ierr = MatZeroEntries(A_mat);
+        IBTK_CHKERRQ(ierr);
+    }
+    d_ib_force_fcn->computeLagrangianForceJacobian(A_mat,
+                                                   MAT_FINAL_ASSEMBLY,
+                                                   1.0,
+                                                   X_jac,
+                                                   0.0,
+                                                   d_U_half_data[level_num],
+                                                   d_hierarchy,
+                                                   level_num,
+                                                   half_time,
+                                                   d_l_data_manager);
+
+    // Assemble a process-local approximation to J*S.  Because the IB_4 kernel
+    // is supported on four meshwidths, only pairs of Lagrangian points that
+    // are within four meshwidths of each other in each coordinate direction
+    // are coupled, and each such coupling is diagonal in the velocity
+    // components.  Couplings between points owned by different processes are
+    // dropped.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    const double* const grid_x_lower = grid_geom->getXLower();
+    const double* const dx_coarsest = grid_geom->getDx();
+    const IntVector<NDIM>& ratio = d_hierarchy->getPatchLevel(level_num)->getRatio();
+    double dx[NDIM];
+    double dV = 1.0;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        dx[d] = dx_coarsest[d] / static_cast<double>(ratio(d));
+        dV *= dx[d];
+    }
+    static const double KERNEL_SUPPORT = 4.0;
+
+    double* X_arr;
+    ierr = VecGetArray(X_vec, &X_arr);
+    IBTK_CHKERRQ(ierr);
+    typedef std::map<std::vector<int>, std::vector<int> > BinMap;
+    BinMap bins;
+    std::vector<int> bin_idx(NDIM);
+    for (int k = 0; k < num_local_nodes; ++k)
+    {
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const double bin_width = KERNEL_SUPPORT * dx[d];
+            bin_idx[d] = static_cast<int>(
+                std::floor((X_arr[NDIM * k + d] - grid_x_lower[d]) / bin_width));
+        }
+        bins[bin_idx].push_back(k);
+    }
+    std::vector<std::vector<int> > nbr_idxs(num_local_nodes);
+    for (BinMap::const_iterator cit = bins.begin(); cit != bins.end(); ++cit)
+    {
+        const std::vector<int>& pts = cit->second;
+        std::vector<int> nbr_bin_idx(NDIM);
+        for (int offset = 0; offset < static_cast<int>(std::pow(3.0, NDIM)); ++offset)
+        {
+            for (unsigned int d = 0, o = offset; d < NDIM; ++d, o /= 3)
+            {
+                nbr_bin_idx[d] = cit->first[d] + static_cast<int>(o % 3) - 1;
+            }
+            BinMap::const_iterator nbr_cit = bins.find(nbr_bin_idx);
+            if (nbr_cit == bins.end()) continue;
+            const std::vector<int>& nbr_pts = nbr_cit->second;
+            for (unsigned int i = 0; i < pts.size(); ++i)
+            {
+                const double* const X_i = &X_arr[NDIM * pts[i]];
+                for (unsigned int j = 0; j < nbr_pts.size(); ++j)
+                {
+                    const double* const X_j = &X_arr[NDIM * nbr_pts[j]];
+                    bool is_nbr = true;
+                    for (unsigned int d = 0; d < NDIM && is_nbr; ++d)
+                    {
+                        is_nbr = std::abs(X_i[d] - X_j[d]) < KERNEL_SUPPORT * dx[d];
+                    }
+                    if (is_nbr) nbr_idxs[pts[i]].push_back(nbr_pts[j]);
+                }
+            }
+        }
+    }
+
+    std::vector<int> M_d_bnnz(num_local_nodes), M_o_bnnz(num_local_nodes, 0);
+    for (int k = 0; k < num_local_nodes; ++k)
+    {
+        M_d_bnnz[k] = static_cast<int>(nbr_idxs[k].size());
+    }
+    Mat M_mat;
+    ierr = MatCreate(PETSC_COMM_WORLD, &M_mat);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatSetSizes(M_mat,
+                       NDIM * num_local_nodes,
+                       NDIM * num_local_nodes,
+                       PETSC_DETERMINE,
+                       PETSC_DETERMINE);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatSetBlockSize(M_mat, NDIM);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatSetType(M_mat, MATAIJ);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatXAIJSetPreallocation(M_mat,
+                                   NDIM,
+                                   num_local_nodes > 0 ? &M_d_bnnz[0] : NULL,
+                                   num_local_nodes > 0 ? &M_o_bnnz[0] : NULL,
+                                   NULL,
+                                   NULL);
+    IBTK_CHKERRQ(ierr);
+    boost::array<double, NDIM * NDIM> M_block;
+    for (int i = 0; i < num_local_nodes; ++i)
+    {
+        const double* const X_i = &X_arr[NDIM * i];
+        const int i_idx = global_node_offset + i;
+        for (unsigned int n = 0; n < nbr_idxs[i].size(); ++n)
+        {
+            const int j = nbr_idxs[i][n];
+            const double* const X_j = &X_arr[NDIM * j];
+            const int j_idx = global_node_offset + j;
+            M_block.assign(0.0);
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                // Component d of the velocity is stored at the cell faces
+                // normal to direction d.
+                double w = 1.0 / dV;
+                for (unsigned int k = 0; k < NDIM; ++k)
+                {
+                    const double shift = (k == d ? 0.0 : 0.5);
+                    w *= ib_4_kernel_overlap((X_i[k] - grid_x_lower[k]) / dx[k] - shift,
+                                             (X_j[k] - grid_x_lower[k]) / dx[k] - shift);
+                }
+                M_block[NDIM * d + d] = w;
+            }
+            ierr = MatSetValuesBlocked(
+                M_mat, 1, &i_idx, 1, &j_idx, M_block.data(), INSERT_VALUES);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+    ierr = VecRestoreArray(X_vec, &X_arr);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatAssemblyBegin(M_mat, MAT_FINAL_ASSEMBLY);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatAssemblyEnd(M_mat, MAT_FINAL_ASSEMBLY);
+    IBTK_CHKERRQ(ierr);
+
+    // Form Sc = I - alpha*M*A.
+    if (Sc_mat)
+    {
+        ierr = MatDestroy(&Sc_mat);
+        IBTK_CHKERRQ(ierr);
+    }
+    ierr = MatMatMult(M_mat, A_mat, MAT_INITIAL_MATRIX, PETSC_DEFAULT, &Sc_mat);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatScale(Sc_mat, -alpha);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatSetOption(Sc_mat, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_FALSE);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatShift(Sc_mat, 1.0);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatDestroy(&M_mat);
+    IBTK_CHKERRQ(ierr);
+    return true;
+} // constructApproximateSchurComplement
+
 void IBMethod::computeLagrangianFluidSource(const double data_time)
 {
     if (!d_ib_source_fcn) return;
@@ -1176,6 +1452,15 @@ void IBMethod::initializePatchHierarchy(
     d_hierarchy = hierarchy;
     d_gridding_alg = gridding_alg;
 
+    // Read the Lagrangian data from a binary checkpoint if one has been
+    // specified.  Checkpoints are used only to initialize a new simulation; when
+    // restarting, the Lagrangian data are read from the restart files.
+    const bool from_restart = RestartManager::getManager()->isFromRestart();
+    if (initial_time && !from_restart && !d_lag_checkpoint_restart_dirname.empty())
+    {
+        readLagrangianCheckpoint(u_data_idx, init_data_time);
+    }
+
     // Lookup the range of hierarchy levels.
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
@@ -1244,9 +1529,53 @@ void IBMethod::initializePatchHierarchy(
         ierr = MatDestroy(&d_force_jac);
         IBTK_CHKERRQ(ierr);
     }
+    if (d_schur_pc_force_jac)
+    {
+        PetscErrorCode ierr;
+        ierr = MatDestroy(&d_schur_pc_force_jac);
+        IBTK_CHKERRQ(ierr);
+    }
     return;
 } // initializePatchHierarchy
 
+void IBMethod::readLagrangianCheckpoint(const int u_data_idx, const double init_data_time)
+{
+    // Read the Lagrangian data and move them to the patches that contain the
+    // restored node positions.
+    d_l_data_manager->readLagrangianCheckpoint(d_lag_checkpoint_restart_dirname);
+    beginDataRedistribution(d_hierarchy, d_gridding_alg);
+    endDataRedistribution(d_hierarchy, d_gridding_alg);
+
+    // The patch hierarchy was generated from the initial structure
+    // configuration.  Regrid it so that the locally refined levels cover the
+    // restored node positions.
+    Array<int> tag_buffer;
+    setupTagBuffer(tag_buffer, d_gridding_alg);
+    beginDataRedistribution(d_hierarchy, d_gridding_alg);
+    d_gridding_alg->regridAllFinerLevels(d_hierarchy, 0, init_data_time, tag_buffer);
+    endDataRedistribution(d_hierarchy, d_gridding_alg);
+
+    // Reset the velocity data on the regridded patch hierarchy.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<Variable<NDIM> > u_var = d_ib_solver->getVelocityVariable();
+    const int u_current_idx =
+        var_db->mapVariableAndContextToIndex(u_var, d_ib_solver->getCurrentContext());
+    for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (!level->checkAllocated(u_data_idx))
+        {
+            level->allocatePatchData(u_data_idx, init_data_time);
+        }
+    }
+    HierarchyDataOpsManager<NDIM>* hier_ops_manager =
+        HierarchyDataOpsManager<NDIM>::getManager();
+    Pointer<HierarchyDataOpsReal<NDIM, double> > hier_velocity_data_ops =
+        hier_ops_manager->getOperationsDouble(u_var, d_hierarchy, true);
+    hier_velocity_data_ops->copyData(u_data_idx, u_current_idx);
+    return;
+} // readLagrangianCheckpoint
+
 void IBMethod::registerLoadBalancer(Pointer<LoadBalancer<NDIM> > load_balancer,
                                     int workload_data_idx)
 {
@@ -1332,6 +1661,15 @@ void IBMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > hierarchy,
     // Indicate that the force and source strategies need to be re-initialized.
     d_ib_force_fcn_needs_init = true;
     d_ib_source_fcn_needs_init = true;
+
+    // The non-zero structure of the assembled force Jacobian is no longer
+    // valid.
+    if (d_schur_pc_force_jac)
+    {
+        PetscErrorCode ierr;
+        ierr = MatDestroy(&d_schur_pc_force_jac);
+        IBTK_CHKERRQ(ierr);
+    }
     return;
 } // endDataRedistribution
 
@@ -1501,6 +1839,15 @@ void IBMethod::putToDatabase(Pointer<Database> db)
         }
     }
     db->putBool("d_normalize_source_strength", d_normalize_source_strength);
+
+    // Post a binary checkpoint of the Lagrangian data.
+    if (!d_lag_checkpoint_dirname.empty())
+    {
+        std::ostringstream dirname_stream;
+        dirname_stream << d_lag_checkpoint_dirname << "/lag_data." << std::setw(6)
+                       << std::setfill('0') << d_ib_solver->getIntegratorStep();
+        d_l_data_manager->beginLagrangianCheckpoint(dirname_stream.str());
+    }
     return;
 } // putToDatabase
 
@@ -1889,10 +2236,18 @@ void IBMethod::getFromInput(Pointer<Database> db, bool is_from_restart)
         if (db->isBool("normalize_source_strength"))
             d_normalize_source_strength = db->getBool("normalize_source_strength");
     }
+    if (db->isBool("use_occupancy_tagging"))
+        d_use_occupancy_tagging = db->getBool("use_occupancy_tagging");
+    if (db->isInteger("occupancy_tagging_block_size"))
+        d_occupancy_tagging_block_size = db->getInteger("occupancy_tagging_block_size");
     if (db->keyExists("do_log"))
         d_do_log = db->getBool("do_log");
     else if (db->keyExists("enable_logging"))
         d_do_log = db->getBool("enable_logging");
+    if (db->isString("lag_checkpoint_dirname"))
+        d_lag_checkpoint_dirname = db->getString("lag_checkpoint_dirname");
+    if (db->isString("lag_checkpoint_restart_dirname"))
+        d_lag_checkpoint_restart_dirname = db->getString("lag_checkpoint_restart_dirname");
     return;
 } // getFromInput
 
@@ -98,6 +98,15 @@ namespace IBAMR
  * \brief Class IBMethod is an implementation of the abstract base class
  * IBImplicitStrategy that provides functionality required by the standard IB
  * method.
+ *
+ * If the input key \p lag_checkpoint_dirname is set, each restart dump also
+ * writes a binary checkpoint of the Lagrangian data to a subdirectory of that
+ * directory via LDataManager::beginLagrangianCheckpoint().  These checkpoints do
+ * not depend on the number of processors.  If the input key
+ * \p lag_checkpoint_restart_dirname names such a subdirectory, a new (i.e.,
+ * not restarted) simulation initializes its Lagrangian data from it and then
+ * regrids the patch hierarchy to cover the restored node positions, so that a
+ * run may be continued on a different number of processors.
  */
 class IBMethod : public IBImplicitStrategy
 {
@@ -298,6 +307,17 @@ public:
             f_prolongation_scheds,
         double data_time);
 
+    /*!
+     * Construct an explicitly assembled approximation to the Lagrangian Schur
+     * complement Sc = I - alpha*J*S*A using the linearization of the force
+     * about the Lagrangian configuration X_vec.
+     *
+     * The force Jacobian A is assembled by the registered force generator and
+     * J*S is approximated by the overlap of the IB_4 kernels centered at
+     * nearby local Lagrangian points.
+     */
+    bool constructApproximateSchurComplement(Mat& Sc_mat, Vec& X_vec, double alpha);
+
     /*!
      * Indicate whether there are any internal fluid sources/sinks.
      */
@@ -435,6 +455,10 @@ public:
 
     /*!
      * Write out object state to the given database.
+     *
+     * \note If a Lagrangian checkpoint directory has been specified, this
+     * method also posts a binary checkpoint of the Lagrangian data.  The writes
+     * are completed at the end of the next time step.
      */
     void putToDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
 
@@ -542,6 +566,14 @@ protected:
     IBTK::LDataManager* d_l_data_manager;
     std::string d_interp_kernel_fcn, d_spread_kernel_fcn;
     SAMRAI::hier::IntVector<NDIM> d_ghosts;
+    bool d_use_occupancy_tagging;
+    int d_occupancy_tagging_block_size;
+
+    /*
+     * Directories used to write and to read binary checkpoints of the
+     * Lagrangian data.
+     */
+    std::string d_lag_checkpoint_dirname, d_lag_checkpoint_restart_dirname;
 
     /*
      * Lagrangian variables.
@@ -662,6 +694,14 @@ private:
      */
     void updateIBInstrumentationData(int timestep_num, double data_time);
 
+    /*!
+     * Read the Lagrangian data from the checkpoint specified by the input key
+     * \p lag_checkpoint_restart_dirname, regrid the patch hierarchy so that it
+     * covers the restored node positions, and reset the velocity data stored
+     * in \p u_data_idx on the regridded hierarchy.
+     */
+    void readLagrangianCheckpoint(int u_data_idx, double init_data_time);
+
     /*!
      * Read input values from a given database.
      */
@@ -674,6 +714,13 @@ private:
     void getFromRestart();
 
     Mat d_force_jac;
+
+    /*
+     * Assembled Jacobian of the Lagrangian force used to construct the
+     * approximate Lagrangian Schur complement.  Its non-zero structure is
+     * reused until the Lagrangian data are redistributed.
+     */
+    Mat d_schur_pc_force_jac;
 };
 } // namespace IBAMR
 
@@ -65,6 +65,7 @@
 #include "ibtk/compiler_hints.h"
 #include "petscsys.h"
 #include "petscvec.h"
+#include "tbox/SAMRAI_MPI.h"
 #include "tbox/Utilities.h"
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -127,7 +128,7 @@ void resetLocalOrNonlocalPETScIndices(std::vector<int>& inds,
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
-IBStandardForceGen::IBStandardForceGen()
+IBStandardForceGen::IBStandardForceGen() : d_use_structure_partitioning(false)
 {
     // Setup the default force generation functions.
     registerSpringForceFunction(0, &default_spring_force, &default_spring_force_deriv);
@@ -150,6 +151,12 @@ void IBStandardForceGen::registerSpringForceFunction(
     return;
 } // registerSpringForceFunction
 
+void IBStandardForceGen::setUseStructurePartitioning(const bool use_structure_partitioning)
+{
+    d_use_structure_partitioning = use_structure_partitioning;
+    return;
+} // setUseStructurePartitioning
+
 void IBStandardForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM> > hierarchy,
                                              const int level_number,
                                              const double init_data_time,
@@ -168,6 +175,7 @@ void IBStandardForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM>
     const int new_size = std::max(level_number + 1, static_cast<int>(d_is_initialized.size()));
 
     d_spring_data.resize(new_size);
+    d_partitioned_spring_data.resize(new_size);
     d_beam_data.resize(new_size);
     d_target_point_data.resize(new_size);
     d_X_ghost_data.resize(new_size);
@@ -198,6 +206,12 @@ void IBStandardForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM>
                                    init_data_time,
                                    initial_time,
                                    l_data_manager);
+    d_partitioned_spring_data[level_number] = SpringData();
+    if (d_use_structure_partitioning)
+    {
+        initializePartitionedSpringLevelData(
+            nonlocal_petsc_idx_set, level_number, l_data_manager);
+    }
 
     // Put the nonlocal PETSc indices into a vector.
     std::vector<int> nonlocal_petsc_idxs(nonlocal_petsc_idx_set.begin(),
@@ -220,6 +234,16 @@ void IBStandardForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM>
                                      global_node_offset,
                                      num_local_nodes,
                                      nonlocal_petsc_idxs);
+    resetLocalOrNonlocalPETScIndices(
+        d_partitioned_spring_data[level_number].petsc_mastr_node_idxs,
+        global_node_offset,
+        num_local_nodes,
+        nonlocal_petsc_idxs);
+    resetLocalOrNonlocalPETScIndices(
+        d_partitioned_spring_data[level_number].petsc_slave_node_idxs,
+        global_node_offset,
+        num_local_nodes,
+        nonlocal_petsc_idxs);
     resetLocalOrNonlocalPETScIndices(d_beam_data[level_number].petsc_next_node_idxs,
                                      global_node_offset,
                                      num_local_nodes,
@@ -269,6 +293,14 @@ void IBStandardForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM>
                    d_spring_data[level_number].petsc_slave_node_idxs.end(),
                    d_spring_data[level_number].petsc_slave_node_idxs.begin(),
                    std::bind2nd(std::multiplies<int>(), NDIM));
+    std::transform(d_partitioned_spring_data[level_number].petsc_mastr_node_idxs.begin(),
+                   d_partitioned_spring_data[level_number].petsc_mastr_node_idxs.end(),
+                   d_partitioned_spring_data[level_number].petsc_mastr_node_idxs.begin(),
+                   std::bind2nd(std::multiplies<int>(), NDIM));
+    std::transform(d_partitioned_spring_data[level_number].petsc_slave_node_idxs.begin(),
+                   d_partitioned_spring_data[level_number].petsc_slave_node_idxs.end(),
+                   d_partitioned_spring_data[level_number].petsc_slave_node_idxs.begin(),
+                   std::bind2nd(std::multiplies<int>(), NDIM));
     std::transform(d_beam_data[level_number].petsc_mastr_node_idxs.begin(),
                    d_beam_data[level_number].petsc_mastr_node_idxs.end(),
                    d_beam_data[level_number].petsc_mastr_node_idxs.begin(),
@@ -777,20 +809,6 @@ void IBStandardForceGen::initializeSpringLevelData(
     const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
     const int num_local_nodes = local_nodes.size();
 
-    // Quick return if local_nodes is empty.
-    if (local_nodes.empty())
-    {
-        static const unsigned int num_springs = 0;
-        lag_mastr_node_idxs.resize(num_springs);
-        lag_slave_node_idxs.resize(num_springs);
-        petsc_mastr_node_idxs.resize(num_springs);
-        petsc_slave_node_idxs.resize(num_springs);
-        force_fcns.resize(num_springs);
-        force_deriv_fcns.resize(num_springs);
-        parameters.resize(num_springs);
-        return;
-    }
-
     // Determine how many springs are associated with the present MPI process.
     unsigned int num_springs = 0;
     for (std::vector<LNode*>::const_iterator cit = local_nodes.begin();
@@ -812,10 +830,10 @@ void IBStandardForceGen::initializeSpringLevelData(
     force_deriv_fcns.resize(num_springs);
     parameters.resize(num_springs);
 
-    // Return early if there are no local springs.
-    if (num_springs == 0) return;
-
     // Setup the data structures used to compute spring forces.
+    //
+    // NOTE: There is no early return when there are no local springs because
+    // LDataManager::mapLagrangianToPETSc() is collective.
     int current_spring = 0;
     for (std::vector<LNode*>::const_iterator cit = local_nodes.begin();
          cit != local_nodes.end();
@@ -873,6 +891,165 @@ void IBStandardForceGen::initializeSpringLevelData(
     return;
 } // initializeSpringLevelData
 
+void IBStandardForceGen::initializePartitionedSpringLevelData(
+    std::set<int>& nonlocal_petsc_idx_set,
+    const int level_number,
+    LDataManager* const l_data_manager)
+{
+    SpringData& spring_data = d_partitioned_spring_data[level_number];
+
+    // Springs are assigned to MPI processes by contiguous blocks of master node
+    // Lagrangian indices.
+    const int mpi_size = SAMRAI_MPI::getNodes();
+    const int num_nodes = l_data_manager->getNumberOfNodes(level_number);
+    const int block_size = std::max(1, (num_nodes + mpi_size - 1) / mpi_size);
+
+    // Pack the springs associated with the local nodes for their destination
+    // processes.  Each spring is described by its master and slave node
+    // indices, its force function index, and its parameters.
+    std::vector<std::vector<int> > int_send_bufs(mpi_size);
+    std::vector<std::vector<double> > dbl_send_bufs(mpi_size);
+    const Pointer<LMesh> mesh = l_data_manager->getLMesh(level_number);
+    const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+    for (std::vector<LNode*>::const_iterator cit = local_nodes.begin();
+         cit != local_nodes.end();
+         ++cit)
+    {
+        const LNode* const node_idx = *cit;
+        const IBSpringForceSpec* const force_spec =
+            node_idx->getNodeDataItem<IBSpringForceSpec>();
+        if (!force_spec) continue;
+        const int lag_idx = node_idx->getLagrangianIndex();
+        const int dst = std::min(lag_idx / block_size, mpi_size - 1);
+        const std::vector<int>& slv = force_spec->getSlaveNodeIndices();
+        const std::vector<int>& fcn = force_spec->getForceFunctionIndices();
+        const std::vector<std::vector<double> >& params = force_spec->getParameters();
+        const unsigned int num_springs = force_spec->getNumberOfSprings();
+        for (unsigned int k = 0; k < num_springs; ++k)
+        {
+            const int num_params = params.empty() ? 0 : static_cast<int>(params[k].size());
+            int_send_bufs[dst].push_back(lag_idx);
+            int_send_bufs[dst].push_back(slv[k]);
+            int_send_bufs[dst].push_back(fcn[k]);
+            int_send_bufs[dst].push_back(num_params);
+            if (num_params > 0)
+            {
+                dbl_send_bufs[dst].insert(
+                    dbl_send_bufs[dst].end(), params[k].begin(), params[k].end());
+            }
+        }
+    }
+
+    // Exchange the packed spring data.
+    std::vector<int> int_send_counts(mpi_size), dbl_send_counts(mpi_size);
+    for (int rank = 0; rank < mpi_size; ++rank)
+    {
+        int_send_counts[rank] = int_send_bufs[rank].size();
+        dbl_send_counts[rank] = dbl_send_bufs[rank].size();
+    }
+    std::vector<int> int_recv_counts(mpi_size), dbl_recv_counts(mpi_size);
+    MPI_Comm communicator = SAMRAI_MPI::getCommunicator();
+    MPI_Alltoall(
+        &int_send_counts[0], 1, MPI_INT, &int_recv_counts[0], 1, MPI_INT, communicator);
+    MPI_Alltoall(
+        &dbl_send_counts[0], 1, MPI_INT, &dbl_recv_counts[0], 1, MPI_INT, communicator);
+    std::vector<int> int_send_displs(mpi_size, 0), int_recv_displs(mpi_size, 0);
+    std::vector<int> dbl_send_displs(mpi_size, 0), dbl_recv_displs(mpi_size, 0);
+    for (int rank = 1; rank < mpi_size; ++rank)
+    {
+        int_send_displs[rank] = int_send_displs[rank - 1] + int_send_counts[rank - 1];
+        int_recv_displs[rank] = int_recv_displs[rank - 1] + int_recv_counts[rank - 1];
+        dbl_send_displs[rank] = dbl_send_displs[rank - 1] + dbl_send_counts[rank - 1];
+        dbl_recv_displs[rank] = dbl_recv_displs[rank - 1] + dbl_recv_counts[rank - 1];
+    }
+    std::vector<int> int_send_buf;
+    std::vector<int> int_recv_buf(int_recv_displs.back() + int_recv_counts.back());
+    std::vector<double> dbl_send_buf;
+    std::vector<double> dbl_recv_buf(dbl_recv_displs.back() + dbl_recv_counts.back());
+    for (int rank = 0; rank < mpi_size; ++rank)
+    {
+        const std::vector<int>& int_buf = int_send_bufs[rank];
+        const std::vector<double>& dbl_buf = dbl_send_bufs[rank];
+        int_send_buf.insert(int_send_buf.end(), int_buf.begin(), int_buf.end());
+        dbl_send_buf.insert(dbl_send_buf.end(), dbl_buf.begin(), dbl_buf.end());
+    }
+    // Guard against taking the address of the first element of empty buffers.
+    int_send_buf.push_back(0);
+    int_recv_buf.push_back(0);
+    dbl_send_buf.push_back(0.0);
+    dbl_recv_buf.push_back(0.0);
+    MPI_Alltoallv(&int_send_buf[0],
+                  &int_send_counts[0],
+                  &int_send_displs[0],
+                  MPI_INT,
+                  &int_recv_buf[0],
+                  &int_recv_counts[0],
+                  &int_recv_displs[0],
+                  MPI_INT,
+                  communicator);
+    MPI_Alltoallv(&dbl_send_buf[0],
+                  &dbl_send_counts[0],
+                  &dbl_send_displs[0],
+                  MPI_DOUBLE,
+                  &dbl_recv_buf[0],
+                  &dbl_recv_counts[0],
+                  &dbl_recv_displs[0],
+                  MPI_DOUBLE,
+                  communicator);
+    int_recv_buf.pop_back();
+    dbl_recv_buf.pop_back();
+
+    // Unpack the springs assigned to this process.  The received parameter
+    // values are retained (and shared by copies of the cached data) so that
+    // the cached parameter pointers remain valid.
+    const unsigned int num_springs = int_recv_buf.size() / 4;
+    spring_data.lag_mastr_node_idxs.resize(num_springs);
+    spring_data.lag_slave_node_idxs.resize(num_springs);
+    spring_data.force_fcns.resize(num_springs);
+    spring_data.force_deriv_fcns.resize(num_springs);
+    spring_data.parameters.resize(num_springs);
+    spring_data.parameter_data = new std::vector<double>();
+    spring_data.parameter_data->swap(dbl_recv_buf);
+    for (unsigned int k = 0, offset = 0; k < num_springs; ++k)
+    {
+        const int fcn_idx = int_recv_buf[4 * k + 2];
+        const int num_params = int_recv_buf[4 * k + 3];
+        spring_data.lag_mastr_node_idxs[k] = int_recv_buf[4 * k];
+        spring_data.lag_slave_node_idxs[k] = int_recv_buf[4 * k + 1];
+        spring_data.force_fcns[k] = d_spring_force_fcn_map[fcn_idx];
+        spring_data.force_deriv_fcns[k] = d_spring_force_deriv_fcn_map[fcn_idx];
+        spring_data.parameters[k] =
+            num_params > 0 ? &(*spring_data.parameter_data)[offset] : NULL;
+        offset += num_params;
+    }
+
+    // Map the Lagrangian node indices to the PETSc indices corresponding to
+    // the present data distribution and determine the ghost nodes required to
+    // compute the spring forces.  Both master and slave nodes may be "off
+    // processor".
+    spring_data.petsc_mastr_node_idxs = spring_data.lag_mastr_node_idxs;
+    spring_data.petsc_slave_node_idxs = spring_data.lag_slave_node_idxs;
+    l_data_manager->mapLagrangianToPETSc(spring_data.petsc_mastr_node_idxs, level_number);
+    l_data_manager->mapLagrangianToPETSc(spring_data.petsc_slave_node_idxs, level_number);
+    const int global_node_offset = l_data_manager->getGlobalNodeOffset(level_number);
+    const int num_local_nodes = l_data_manager->getNumberOfLocalNodes(level_number);
+    for (unsigned int k = 0; k < num_springs; ++k)
+    {
+        const int mastr_idx = spring_data.petsc_mastr_node_idxs[k];
+        const int slave_idx = spring_data.petsc_slave_node_idxs[k];
+        const int upper_node_offset = global_node_offset + num_local_nodes;
+        if (mastr_idx < global_node_offset || mastr_idx >= upper_node_offset)
+        {
+            nonlocal_petsc_idx_set.insert(mastr_idx);
+        }
+        if (slave_idx < global_node_offset || slave_idx >= upper_node_offset)
+        {
+            nonlocal_petsc_idx_set.insert(slave_idx);
+        }
+    }
+    return;
+} // initializePartitionedSpringLevelData
+
 void IBStandardForceGen::computeLagrangianSpringForce(
     Pointer<LData> F_data,
     Pointer<LData> X_data,
@@ -881,17 +1058,18 @@ void IBStandardForceGen::computeLagrangianSpringForce(
     const double /*data_time*/,
     LDataManager* const /*l_data_manager*/)
 {
-    const int num_springs = d_spring_data[level_number].lag_mastr_node_idxs.size();
+    SpringData& spring_data = d_use_structure_partitioning ?
+                                  d_partitioned_spring_data[level_number] :
+                                  d_spring_data[level_number];
+    const int num_springs = spring_data.lag_mastr_node_idxs.size();
     if (!num_springs) return;
 
-    const int* const lag_mastr_node_idxs = &d_spring_data[level_number].lag_mastr_node_idxs[0];
-    const int* const lag_slave_node_idxs = &d_spring_data[level_number].lag_slave_node_idxs[0];
-    const int* const petsc_mastr_node_idxs =
-        &d_spring_data[level_number].petsc_mastr_node_idxs[0];
-    const int* const petsc_slave_node_idxs =
-        &d_spring_data[level_number].petsc_slave_node_idxs[0];
-    const SpringForceFcnPtr* const force_fcns = &d_spring_data[level_number].force_fcns[0];
-    const double** const parameters = &d_spring_data[level_number].parameters[0];
+    const int* const lag_mastr_node_idxs = &spring_data.lag_mastr_node_idxs[0];
+    const int* const lag_slave_node_idxs = &spring_data.lag_slave_node_idxs[0];
+    const int* const petsc_mastr_node_idxs = &spring_data.petsc_mastr_node_idxs[0];
+    const int* const petsc_slave_node_idxs = &spring_data.petsc_slave_node_idxs[0];
+    const SpringForceFcnPtr* const force_fcns = &spring_data.force_fcns[0];
+    const double** const parameters = &spring_data.parameters[0];
     double* const F_node = F_data->getLocalFormVecArray()->data();
     const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
 
@@ -1042,10 +1220,10 @@ IBStandardForceGen::initializeBeamLevelData(std::set<int>& nonlocal_petsc_idx_se
     rigidities.resize(num_beams);
     curvatures.resize(num_beams);
 
-    // Return early if there are no local beams.
-    if (num_beams == 0) return;
-
     // Setup the data structures used to compute beam forces.
+    //
+    // NOTE: There is no early return when there are no local beams because
+    // LDataManager::mapLagrangianToPETSc() is collective.
     int current_beam = 0;
     for (std::vector<LNode*>::const_iterator cit = local_nodes.begin();
          cit != local_nodes.end();
@@ -109,6 +109,30 @@ public:
         const SpringForceFcnPtr spring_force_fcn_ptr,
         const SpringForceDerivFcnPtr spring_force_deriv_fcn_ptr = NULL);
 
+    /*!
+     * \brief Set whether spring forces should be computed using a partitioning
+     * of the structure that is independent of the Eulerian data distribution.
+     *
+     * By default, each spring force is computed by the MPI process that owns
+     * the spring's master node, i.e., the process that owns the patch that
+     * contains the master node.  When structure partitioning is enabled, the
+     * springs are instead distributed among all MPI processes by contiguous
+     * blocks of master node Lagrangian indices.  Node positions and forces are
+     * communicated between the force-computing processes and the processes
+     * that own the nodes.  Force spreading and velocity interpolation are
+     * unaffected.
+     *
+     * This option is useful for force-dominated models in which the structure
+     * occupies only a few patches.  It requires that the structure's nodes be
+     * numbered so that contiguous blocks of Lagrangian indices correspond to
+     * compact subsets of the structure, as is typically the case for meshes
+     * read by IBStandardInitializer.
+     *
+     * \note Structure partitioning takes effect at the next call to
+     * initializeLevelData() and only affects computeLagrangianForce().
+     */
+    void setUseStructurePartitioning(bool use_structure_partitioning);
+
     /*!
      * \brief Setup the data needed to compute the forces on the specified level
      * of the patch hierarchy.
@@ -211,8 +235,10 @@ private:
         std::vector<SpringForceFcnPtr> force_fcns;
         std::vector<SpringForceDerivFcnPtr> force_deriv_fcns;
         std::vector<const double*> parameters;
+        SAMRAI::tbox::Pointer<std::vector<double> > parameter_data;
     };
-    std::vector<SpringData> d_spring_data;
+    std::vector<SpringData> d_spring_data, d_partitioned_spring_data;
+    bool d_use_structure_partitioning;
 
     struct BeamData
     {
@@ -244,6 +270,9 @@ private:
         double init_data_time,
         bool initial_time,
         IBTK::LDataManager* l_data_manager);
+    void initializePartitionedSpringLevelData(std::set<int>& nonlocal_petsc_idx_set,
+                                              int level_number,
+                                              IBTK::LDataManager* l_data_manager);
     void computeLagrangianSpringForce(
         SAMRAI::tbox::Pointer<IBTK::LData> F_data,
         SAMRAI::tbox::Pointer<IBTK::LData> X_data,
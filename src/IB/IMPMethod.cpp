@@ -54,7 +54,6 @@
 #include "SideData.h"
 #include "SideGeometry.h"
 #include "SideIndex.h"
-#include "boost/array.hpp"
 #include "boost/multi_array.hpp"
 #include "ibamr/MaterialPointSpec.h"
 #include "ibamr/MaterialPointSpec-inl.h"
@@ -274,6 +273,130 @@ kernel_diff(
 }// kernel_diff
 #endif
 
+// Maximum number of kernel weights required in each coordinate direction.
+static const int kernel_stencil_size = 2 * kernel_width + 1;
+
+// Compute the tensor-product kernel weights and their derivatives for the
+// specified component of a staggered-grid field about the point X.  Entry m
+// of phi[d] and dphi[d] corresponds to grid index box.lower(d) + m.
+inline void compute_kernel_weights(Box<NDIM>& box,
+                                   double phi[NDIM][kernel_stencil_size],
+                                   double dphi[NDIM][kernel_stencil_size],
+                                   const Index<NDIM>& i,
+                                   const unsigned int component,
+                                   const double* const X,
+                                   const double* const x_lower,
+                                   const double* const dx,
+                                   const Index<NDIM>& patch_lower)
+{
+    box = Box<NDIM>(i, i);
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        const double X_cell =
+            x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+        if (d == component)
+        {
+            box.lower(d) -= (kernel_width - 1);
+            box.upper(d) += (kernel_width);
+        }
+        else
+        {
+            box.lower(d) -= (X[d] <= X_cell ? kernel_width : kernel_width - 1);
+            box.upper(d) += (X[d] >= X_cell ? kernel_width : kernel_width - 1);
+        }
+        const double shift = (d == component ? 0.0 : 0.5);
+        for (int m = 0, ic = box.lower(d); ic <= box.upper(d); ++m, ++ic)
+        {
+            const double x_grid =
+                x_lower[d] + dx[d] * (static_cast<double>(ic - patch_lower(d)) + shift);
+            const double del = x_grid - X[d];
+            phi[d][m] = kernel(del / dx[d]);
+            dphi[d][m] = kernel_diff(del / dx[d]) / dx[d];
+        }
+    }
+    return;
+} // compute_kernel_weights
+
+// Compute A_inv = inverse(A) for NDIM x NDIM tensors stored in row-major
+// order.
+inline void invert_tensor(double* const A_inv, const double* const A)
+{
+#if (NDIM == 2)
+    const double det_inv = 1.0 / (A[0] * A[3] - A[1] * A[2]);
+    A_inv[0] = A[3] * det_inv;
+    A_inv[1] = -A[1] * det_inv;
+    A_inv[2] = -A[2] * det_inv;
+    A_inv[3] = A[0] * det_inv;
+#endif
+#if (NDIM == 3)
+    A_inv[0] = A[4] * A[8] - A[5] * A[7];
+    A_inv[1] = A[2] * A[7] - A[1] * A[8];
+    A_inv[2] = A[1] * A[5] - A[2] * A[4];
+    A_inv[3] = A[5] * A[6] - A[3] * A[8];
+    A_inv[4] = A[0] * A[8] - A[2] * A[6];
+    A_inv[5] = A[2] * A[3] - A[0] * A[5];
+    A_inv[6] = A[3] * A[7] - A[4] * A[6];
+    A_inv[7] = A[1] * A[6] - A[0] * A[7];
+    A_inv[8] = A[0] * A[4] - A[1] * A[3];
+    const double det_inv = 1.0 / (A[0] * A_inv[0] + A[1] * A_inv[3] + A[2] * A_inv[6]);
+    for (int k = 0; k < NDIM * NDIM; ++k) A_inv[k] *= det_inv;
+#endif
+    return;
+} // invert_tensor
+
+// Update the deformation gradients of a contiguous batch of material points
+// via
+//
+//    F_new = inverse(I - alpha*Grad_U_lhs) * (I + alpha*Grad_U_rhs) * F
+//
+// in which all tensors are stored in row-major order.
+void update_deformation_gradient(double* const F_new,
+                                 const double* const F,
+                                 const double* const Grad_U_lhs,
+                                 const double* const Grad_U_rhs,
+                                 const double alpha,
+                                 const int num_points)
+{
+    static const int NN = NDIM * NDIM;
+    double A[NN], A_inv[NN], B[NN], C[NN];
+    for (int k = 0; k < num_points; ++k)
+    {
+        const double* const F_k = F + NN * k;
+        const double* const Grad_U_lhs_k = Grad_U_lhs + NN * k;
+        const double* const Grad_U_rhs_k = Grad_U_rhs + NN * k;
+        double* const F_new_k = F_new + NN * k;
+        for (int i = 0; i < NDIM; ++i)
+        {
+            for (int j = 0; j < NDIM; ++j)
+            {
+                const double delta = (i == j ? 1.0 : 0.0);
+                A[NDIM * i + j] = delta - alpha * Grad_U_lhs_k[NDIM * i + j];
+                B[NDIM * i + j] = delta + alpha * Grad_U_rhs_k[NDIM * i + j];
+            }
+        }
+        invert_tensor(A_inv, A);
+        for (int i = 0; i < NDIM; ++i)
+        {
+            for (int j = 0; j < NDIM; ++j)
+            {
+                double c = 0.0;
+                for (int l = 0; l < NDIM; ++l) c += B[NDIM * i + l] * F_k[NDIM * l + j];
+                C[NDIM * i + j] = c;
+            }
+        }
+        for (int i = 0; i < NDIM; ++i)
+        {
+            for (int j = 0; j < NDIM; ++j)
+            {
+                double f = 0.0;
+                for (int l = 0; l < NDIM; ++l) f += A_inv[NDIM * i + l] * C[NDIM * l + j];
+                F_new_k[NDIM * i + j] = f;
+            }
+        }
+    }
+    return;
+} // update_deformation_gradient
+
 // Version of IMPMethod restart file data.
 static const int IMP_METHOD_VERSION = 1;
 }
@@ -328,6 +451,7 @@ IMPMethod::IMPMethod(const std::string& object_name,
     d_X_half_needs_ghost_fill = true;
     d_X_half_needs_reinit = true;
     d_U_half_needs_reinit = true;
+    d_mp_data_needs_reinit = true;
     return;
 } // IMPMethod
 
@@ -539,7 +663,7 @@ void IMPMethod::interpolateVelocity(
     *X_needs_ghost_fill = false;
 
     // Interpolate data from the Eulerian grid to the Lagrangian mesh.
-    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    if (d_mp_data_needs_reinit) reinitMaterialPointData();
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
@@ -547,12 +671,14 @@ void IMPMethod::interpolateVelocity(
         {
             u_ghost_fill_scheds[ln]->fillData(data_time);
         }
-        boost::multi_array_ref<double, 2>& U_array = *(*U_data)[ln]->getLocalFormVecArray();
-        boost::multi_array_ref<double, 2>& Grad_U_array =
-            *(*Grad_U_data)[ln]->getLocalFormVecArray();
-        boost::multi_array_ref<double, 2>& X_array = *(*X_data)[ln]->getLocalFormVecArray();
+        const MaterialPointData& mp_data = d_mp_data[ln];
+        double* const U_array = (*U_data)[ln]->getGhostedLocalFormVecArray()->data();
+        double* const Grad_U_array =
+            (*Grad_U_data)[ln]->getGhostedLocalFormVecArray()->data();
+        const double* const X_array = (*X_data)[ln]->getGhostedLocalFormVecArray()->data();
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        int local_patch_num = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(u_data_idx);
@@ -574,97 +700,48 @@ void IMPMethod::interpolateVelocity(
                 if (patch_geom->getTouchesRegularBoundary(axis, /*upper*/ 1))
                     side_boxes[axis].upper(axis) = patch_box.upper(axis) + 1;
             }
-            for (LNodeSetData::CellIterator it(idx_data->getGhostBox()); it; it++)
+            const int k_begin = mp_data.patch_offsets[local_patch_num];
+            const int k_end = mp_data.patch_offsets[local_patch_num + 1];
+            Box<NDIM> box;
+            double phi[NDIM][kernel_stencil_size], dphi[NDIM][kernel_stencil_size];
+            for (int k = k_begin; k < k_end; ++k)
             {
-                const Index<NDIM>& i = *it;
-                LNodeSet* const node_set = idx_data->getItem(i);
-                if (!node_set) continue;
-                for (LNodeSet::iterator it = node_set->begin(); it != node_set->end(); ++it)
+                const int local_idx = mp_data.patch_idxs[k];
+                const double* const X = X_array + NDIM * local_idx;
+                double* const U = U_array + NDIM * local_idx;
+                double* const Grad_U = Grad_U_array + NDIM * NDIM * local_idx;
+                std::fill(U, U + NDIM, 0.0);
+                std::fill(Grad_U, Grad_U + NDIM * NDIM, 0.0);
+
+                // WARNING: As written here, this implicitly imposes u = 0 in
+                // the ghost cell region at physical boundaries.
+                const Index<NDIM> i = IndexUtilities::getCellIndex(
+                    X, x_lower, x_upper, dx, patch_box.lower(), patch_box.upper());
+                for (unsigned int component = 0; component < NDIM; ++component)
                 {
-                    const LNode* const node_idx = *it;
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const X = &X_array[local_idx][0];
-
-                    // WARNING: As written here, this implicitly imposes u = 0 in
-                    // the ghost cell region at physical boundaries.
-                    const Index<NDIM> i = IndexUtilities::getCellIndex(
-                        X, x_lower, x_upper, dx, patch_box.lower(), patch_box.upper());
-                    VectorValue<double> U, X_cell;
-                    TensorValue<double> Grad_U;
-                    U.zero();
-                    Grad_U.zero();
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        X_cell(d) =
-                            x_lower[d] +
-                            dx[d] * (static_cast<double>(i(d) - patch_box.lower(d)) + 0.5);
-                    }
-                    for (unsigned int component = 0; component < NDIM; ++component)
+                    compute_kernel_weights(
+                        box, phi, dphi, i, component, X, x_lower, dx, patch_box.lower());
+                    for (Box<NDIM>::Iterator b(box * side_boxes[component]); b; b++)
                     {
-                        boost::array<boost::multi_array<double, 1>, NDIM> phi, dphi;
-                        Box<NDIM> box(i, i);
+                        const Index<NDIM>& ic = b();
+                        const double u = (*u_data)(
+                            SideIndex<NDIM>(ic, component, SideIndex<NDIM>::Lower));
+                        int m[NDIM];
+                        double w = 1.0;
                         for (unsigned int d = 0; d < NDIM; ++d)
                         {
-                            if (d == component)
-                            {
-                                box.lower(d) -= (kernel_width - 1);
-                                box.upper(d) += (kernel_width);
-                            }
-                            else
-                            {
-                                box.lower(d) -=
-                                    (X[d] <= X_cell(d) ? kernel_width : kernel_width - 1);
-                                box.upper(d) +=
-                                    (X[d] >= X_cell(d) ? kernel_width : kernel_width - 1);
-                            }
-                            typedef boost::multi_array_types::extent_range range;
-                            phi[d].resize(boost::extents[range(box.lower(d), box.upper(d))]);
-                            dphi[d].resize(boost::extents[range(box.lower(d), box.upper(d))]);
+                            m[d] = ic(d) - box.lower(d);
+                            w *= phi[d][m[d]];
                         }
-                        for (unsigned int d = 0; d < NDIM; ++d)
-                        {
-                            for (int i = box.lower(d); i <= box.upper(d); ++i)
-                            {
-                                const double x_grid =
-                                    x_lower[d] +
-                                    dx[d] * (static_cast<double>(i - patch_box.lower(d)) +
-                                             (d == component ? 0.0 : 0.5));
-                                const double del = x_grid - X[d];
-                                phi[d][i] = kernel(del / dx[d]);
-                                dphi[d][i] = kernel_diff(del / dx[d]) / dx[d];
-                            }
-                        }
-                        for (Box<NDIM>::Iterator b(box * side_boxes[component]); b; b++)
+                        U[component] += u * w;
+                        for (unsigned int l = 0; l < NDIM; ++l)
                         {
-                            const Index<NDIM>& i = b();
-                            const double u = (*u_data)(
-                                SideIndex<NDIM>(i, component, SideIndex<NDIM>::Lower));
-                            double w = 1.0;
+                            double dw_dx_l = 1.0;
                             for (unsigned int d = 0; d < NDIM; ++d)
                             {
-                                w *= phi[d][i(d)];
-                            }
-                            U(component) += u * w;
-                            for (unsigned int k = 0; k < NDIM; ++k)
-                            {
-                                double dw_dx_k = 1.0;
-                                for (unsigned int d = 0; d < NDIM; ++d)
-                                {
-                                    if (d == k)
-                                        dw_dx_k *= dphi[d][i(d)];
-                                    else
-                                        dw_dx_k *= phi[d][i(d)];
-                                }
-                                Grad_U(component, k) -= u * dw_dx_k;
+                                dw_dx_l *= (d == l ? dphi[d][m[d]] : phi[d][m[d]]);
                             }
-                        }
-                    }
-                    for (int i = 0; i < NDIM; ++i)
-                    {
-                        U_array[local_idx][i] = U(i);
-                        for (int j = 0; j < NDIM; ++j)
-                        {
-                            Grad_U_array[local_idx][NDIM * i + j] = Grad_U(i, j);
+                            Grad_U[NDIM * component + l] -= u * dw_dx_l;
                         }
                     }
                 }
@@ -698,45 +775,29 @@ void IMPMethod::eulerStep(const double current_time, const double new_time)
         IBTK_CHKERRQ(ierr);
 
         // Update the deformation gradient.
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-        boost::multi_array_ref<double, 2>& F_current_array =
-            *d_F_current_data[ln]->getVecArray();
-        boost::multi_array_ref<double, 2>& F_new_array = *d_F_new_data[ln]->getVecArray();
-        boost::multi_array_ref<double, 2>& F_half_array = *d_F_half_data[ln]->getVecArray();
-        boost::multi_array_ref<double, 2>& Grad_U_array = *(*Grad_U_data)[ln]->getVecArray();
-        TensorValue<double> F_current, F_new, F_half, Grad_U;
-        TensorValue<double> I(1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0);
-        for (std::vector<LNode*>::const_iterator cit = local_nodes.begin();
-             cit != local_nodes.end();
-             ++cit)
-        {
-            const LNode* const node_idx = *cit;
-            const int idx = node_idx->getGlobalPETScIndex();
-            for (int i = 0; i < NDIM; ++i)
-            {
-                for (int j = 0; j < NDIM; ++j)
-                {
-                    F_current(i, j) = F_current_array[idx][NDIM * i + j];
-                    Grad_U(i, j) = Grad_U_array[idx][NDIM * i + j];
-                }
-            }
-#if (NDIM == 2)
-            F_current(2, 2) = 1.0;
-#endif
-            F_new =
-                tensor_inverse(I - 0.50 * dt * Grad_U) * (I + 0.50 * dt * Grad_U) * F_current;
-            F_half =
-                tensor_inverse(I - 0.25 * dt * Grad_U) * (I + 0.25 * dt * Grad_U) * F_current;
-            for (int i = 0; i < NDIM; ++i)
-            {
-                for (int j = 0; j < NDIM; ++j)
-                {
-                    F_new_array[idx][NDIM * i + j] = F_new(i, j);
-                    F_half_array[idx][NDIM * i + j] = F_half(i, j);
-                }
-            }
-        }
+        const int num_local_nodes = d_F_current_data[ln]->getLocalNodeCount();
+        const double* const F_current_array =
+            d_F_current_data[ln]->getLocalFormVecArray()->data();
+        double* const F_new_array = d_F_new_data[ln]->getLocalFormVecArray()->data();
+        double* const F_half_array = d_F_half_data[ln]->getLocalFormVecArray()->data();
+        const double* const Grad_U_array =
+            (*Grad_U_data)[ln]->getLocalFormVecArray()->data();
+        update_deformation_gradient(F_new_array,
+                                    F_current_array,
+                                    Grad_U_array,
+                                    Grad_U_array,
+                                    0.5 * dt,
+                                    num_local_nodes);
+        update_deformation_gradient(F_half_array,
+                                    F_current_array,
+                                    Grad_U_array,
+                                    Grad_U_array,
+                                    0.25 * dt,
+                                    num_local_nodes);
+        d_F_current_data[ln]->restoreArrays();
+        d_F_new_data[ln]->restoreArrays();
+        d_F_half_data[ln]->restoreArrays();
+        (*Grad_U_data)[ln]->restoreArrays();
     }
     d_X_new_needs_ghost_fill = true;
     d_X_half_needs_reinit = true;
@@ -763,41 +824,21 @@ void IMPMethod::midpointStep(const double current_time, const double new_time)
         IBTK_CHKERRQ(ierr);
 
         // Update the deformation gradient.
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-        boost::multi_array_ref<double, 2>& F_current_array =
-            *d_F_current_data[ln]->getVecArray();
-        boost::multi_array_ref<double, 2>& F_new_array = *d_F_new_data[ln]->getVecArray();
-        boost::multi_array_ref<double, 2>& Grad_U_array = *(*Grad_U_data)[ln]->getVecArray();
-        TensorValue<double> F_current, F_new, Grad_U;
-        TensorValue<double> I(1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0);
-        for (std::vector<LNode*>::const_iterator cit = local_nodes.begin();
-             cit != local_nodes.end();
-             ++cit)
-        {
-            const LNode* const node_idx = *cit;
-            const int idx = node_idx->getGlobalPETScIndex();
-            for (int i = 0; i < NDIM; ++i)
-            {
-                for (int j = 0; j < NDIM; ++j)
-                {
-                    F_current(i, j) = F_current_array[idx][NDIM * i + j];
-                    Grad_U(i, j) = Grad_U_array[idx][NDIM * i + j];
-                }
-            }
-#if (NDIM == 2)
-            F_current(2, 2) = 1.0;
-#endif
-            F_new =
-                tensor_inverse(I - 0.5 * dt * Grad_U) * (I + 0.5 * dt * Grad_U) * F_current;
-            for (int i = 0; i < NDIM; ++i)
-            {
-                for (int j = 0; j < NDIM; ++j)
-                {
-                    F_new_array[idx][NDIM * i + j] = F_new(i, j);
-                }
-            }
-        }
+        const int num_local_nodes = d_F_current_data[ln]->getLocalNodeCount();
+        const double* const F_current_array =
+            d_F_current_data[ln]->getLocalFormVecArray()->data();
+        double* const F_new_array = d_F_new_data[ln]->getLocalFormVecArray()->data();
+        const double* const Grad_U_array =
+            (*Grad_U_data)[ln]->getLocalFormVecArray()->data();
+        update_deformation_gradient(F_new_array,
+                                    F_current_array,
+                                    Grad_U_array,
+                                    Grad_U_array,
+                                    0.5 * dt,
+                                    num_local_nodes);
+        d_F_current_data[ln]->restoreArrays();
+        d_F_new_data[ln]->restoreArrays();
+        (*Grad_U_data)[ln]->restoreArrays();
     }
     d_X_new_needs_ghost_fill = true;
     d_X_half_needs_reinit = true;
@@ -828,45 +869,24 @@ void IMPMethod::trapezoidalStep(const double current_time, const double new_time
         IBTK_CHKERRQ(ierr);
 
         // Update the deformation gradient.
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-        boost::multi_array_ref<double, 2>& F_current_array =
-            *d_F_current_data[ln]->getVecArray();
-        boost::multi_array_ref<double, 2>& F_new_array = *d_F_new_data[ln]->getVecArray();
-        boost::multi_array_ref<double, 2>& Grad_U_current_array =
-            *(*Grad_U_current_data)[ln]->getVecArray();
-        boost::multi_array_ref<double, 2>& Grad_U_new_array =
-            *(*Grad_U_new_data)[ln]->getVecArray();
-        TensorValue<double> F_current, F_new, Grad_U_current, Grad_U_new;
-        TensorValue<double> I(1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0);
-        for (std::vector<LNode*>::const_iterator cit = local_nodes.begin();
-             cit != local_nodes.end();
-             ++cit)
-        {
-            const LNode* const node_idx = *cit;
-            const int idx = node_idx->getGlobalPETScIndex();
-            for (int i = 0; i < NDIM; ++i)
-            {
-                for (int j = 0; j < NDIM; ++j)
-                {
-                    F_current(i, j) = F_current_array[idx][NDIM * i + j];
-                    Grad_U_current(i, j) = Grad_U_current_array[idx][NDIM * i + j];
-                    Grad_U_new(i, j) = Grad_U_new_array[idx][NDIM * i + j];
-                }
-            }
-#if (NDIM == 2)
-            F_current(2, 2) = 1.0;
-#endif
-            F_new = tensor_inverse(I - 0.5 * dt * Grad_U_new) *
-                    (I + 0.5 * dt * Grad_U_current) * F_current;
-            for (int i = 0; i < NDIM; ++i)
-            {
-                for (int j = 0; j < NDIM; ++j)
-                {
-                    F_new_array[idx][NDIM * i + j] = F_new(i, j);
-                }
-            }
-        }
+        const int num_local_nodes = d_F_current_data[ln]->getLocalNodeCount();
+        const double* const F_current_array =
+            d_F_current_data[ln]->getLocalFormVecArray()->data();
+        double* const F_new_array = d_F_new_data[ln]->getLocalFormVecArray()->data();
+        const double* const Grad_U_current_array =
+            (*Grad_U_current_data)[ln]->getLocalFormVecArray()->data();
+        const double* const Grad_U_new_array =
+            (*Grad_U_new_data)[ln]->getLocalFormVecArray()->data();
+        update_deformation_gradient(F_new_array,
+                                    F_current_array,
+                                    Grad_U_new_array,
+                                    Grad_U_current_array,
+                                    0.5 * dt,
+                                    num_local_nodes);
+        d_F_current_data[ln]->restoreArrays();
+        d_F_new_data[ln]->restoreArrays();
+        (*Grad_U_current_data)[ln]->restoreArrays();
+        (*Grad_U_new_data)[ln]->restoreArrays();
     }
     d_X_new_needs_ghost_fill = true;
     d_X_half_needs_reinit = true;
@@ -875,66 +895,68 @@ void IMPMethod::trapezoidalStep(const double current_time, const double new_time
 
 void IMPMethod::computeLagrangianForce(const double data_time)
 {
+    int ierr;
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
     std::vector<Pointer<LData> >* X_data, *F_data;
     bool* X_needs_ghost_fill;
     getPositionData(&X_data, &X_needs_ghost_fill, data_time);
     getDeformationGradientData(&F_data, data_time);
+    if (d_mp_data_needs_reinit) reinitMaterialPointData();
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-        boost::multi_array_ref<double, 2>& x_array = *(*X_data)[ln]->getVecArray();
-        boost::multi_array_ref<double, 2>& X_array = *d_X0_data[ln]->getVecArray();
-        boost::multi_array_ref<double, 2>& F_array = *(*F_data)[ln]->getVecArray();
-        boost::multi_array_ref<double, 2>& tau_array = *d_tau_data[ln]->getVecArray();
-        TensorValue<double> FF, PP, tau;
+        MaterialPointData& mp_data = d_mp_data[ln];
+        ierr = VecSet(d_tau_data[ln]->getVec(), 0.0);
+        IBTK_CHKERRQ(ierr);
+        const double* const x_array = (*X_data)[ln]->getLocalFormVecArray()->data();
+        const double* const X_array = d_X0_data[ln]->getLocalFormVecArray()->data();
+        const double* const F_array = (*F_data)[ln]->getLocalFormVecArray()->data();
+        double* const tau_array = d_tau_data[ln]->getLocalFormVecArray()->data();
+        TensorValue<double> FF, PP;
         VectorValue<double> X, x;
-        for (std::vector<LNode*>::const_iterator cit = local_nodes.begin();
-             cit != local_nodes.end();
-             ++cit)
+#if (NDIM == 2)
+        FF(2, 2) = 1.0;
+#endif
+        const int num_points = static_cast<int>(mp_data.local_idxs.size());
+        for (int k = 0; k < num_points; ++k)
         {
-            const LNode* const node_idx = *cit;
-            const int idx = node_idx->getGlobalPETScIndex();
-            MaterialPointSpec* mp_spec = node_idx->getNodeDataItem<MaterialPointSpec>();
-            if (mp_spec)
+            const int idx = mp_data.local_idxs[k];
+            const double* const F = F_array + NDIM * NDIM * idx;
+            for (int i = 0; i < NDIM; ++i)
             {
-                for (int i = 0; i < NDIM; ++i)
+                for (int j = 0; j < NDIM; ++j)
                 {
-                    for (int j = 0; j < NDIM; ++j)
-                    {
-                        FF(i, j) = F_array[idx][NDIM * i + j];
-                    }
-                    x(i) = x_array[idx][i];
-                    X(i) = X_array[idx][i];
+                    FF(i, j) = F[NDIM * i + j];
                 }
-#if (NDIM == 2)
-                FF(2, 2) = 1.0;
-#endif
-                (*d_PK1_stress_fcn)(PP,
-                                    FF,
-                                    x,
-                                    X,
-                                    mp_spec->getSubdomainId(),
-                                    mp_spec->getInternalVariables(),
-                                    data_time,
-                                    d_PK1_stress_fcn_ctx);
-                tau = PP * FF.transpose();
-            }
-            else
-            {
-                tau.zero();
+                x(i) = x_array[NDIM * idx + i];
+                X(i) = X_array[NDIM * idx + i];
             }
+            (*d_PK1_stress_fcn)(PP,
+                                FF,
+                                x,
+                                X,
+                                mp_data.subdomain_ids[k],
+                                mp_data.specs[k]->getInternalVariables(),
+                                data_time,
+                                d_PK1_stress_fcn_ctx);
+
+            // tau = PP * FF^T
+            double* const tau = tau_array + NDIM * NDIM * idx;
             for (int i = 0; i < NDIM; ++i)
             {
                 for (int j = 0; j < NDIM; ++j)
                 {
-                    tau_array[idx][NDIM * i + j] = tau(i, j);
+                    double tau_ij = 0.0;
+                    for (int l = 0; l < NDIM; ++l) tau_ij += PP(i, l) * FF(j, l);
+                    tau[NDIM * i + j] = tau_ij;
                 }
             }
         }
+        (*X_data)[ln]->restoreArrays();
+        d_X0_data[ln]->restoreArrays();
+        (*F_data)[ln]->restoreArrays();
+        d_tau_data[ln]->restoreArrays();
     }
     return;
 } // computeLagrangianForce
@@ -965,21 +987,19 @@ void IMPMethod::spreadForce(
     *X_needs_ghost_fill = false;
 
     // Spread data from the Lagrangian mesh to the Eulerian grid.
-    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    if (d_mp_data_needs_reinit) reinitMaterialPointData();
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
-        boost::multi_array_ref<double, 2>& X_array =
-            *(*X_data)[ln]->getGhostedLocalFormVecArray();
-        boost::multi_array_ref<double, 2>& tau_array =
-            *d_tau_data[ln]->getGhostedLocalFormVecArray();
+        const MaterialPointData& mp_data = d_mp_data[ln];
+        const double* const X_array = (*X_data)[ln]->getGhostedLocalFormVecArray()->data();
+        const double* const tau_array = d_tau_data[ln]->getGhostedLocalFormVecArray()->data();
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        int local_patch_num = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<SideData<NDIM, double> > f_data = patch->getPatchData(f_data_idx);
-            Pointer<LNodeSetData> idx_data =
-                patch->getPatchData(d_l_data_manager->getLNodePatchDescriptorIndex());
             const Box<NDIM>& patch_box = patch->getBox();
             Box<NDIM> side_boxes[NDIM];
             for (unsigned int d = 0; d < NDIM; ++d)
@@ -991,98 +1011,47 @@ void IMPMethod::spreadForce(
             const double* const dx = patch_geom->getDx();
             double dV_c = 1.0;
             for (unsigned int d = 0; d < NDIM; ++d) dV_c *= dx[d];
-            for (LNodeSetData::CellIterator it(idx_data->getGhostBox()); it; it++)
+            const int k_begin = mp_data.spread_patch_offsets[local_patch_num];
+            const int k_end = mp_data.spread_patch_offsets[local_patch_num + 1];
+            Box<NDIM> box;
+            double phi[NDIM][kernel_stencil_size], dphi[NDIM][kernel_stencil_size];
+            for (int k = k_begin; k < k_end; ++k)
             {
-                const Index<NDIM>& i = *it;
-                LNodeSet* const node_set = idx_data->getItem(i);
-                if (!node_set) continue;
-                for (LNodeSet::iterator it = node_set->begin(); it != node_set->end(); ++it)
+                const int local_idx = mp_data.spread_idxs[k];
+                const double wgt = mp_data.spread_wgts[k] / dV_c;
+                const double* const X = X_array + NDIM * local_idx;
+                const double* const tau = tau_array + NDIM * NDIM * local_idx;
+
+                // Weight tau using a smooth kernel function evaluated about X.
+                const Index<NDIM> i = IndexUtilities::getCellIndex(
+                    X, x_lower, x_upper, dx, patch_box.lower(), patch_box.upper());
+                for (unsigned int component = 0; component < NDIM; ++component)
                 {
-                    const LNode* const node_idx = *it;
-                    MaterialPointSpec* mp_spec =
-                        node_idx->getNodeDataItem<MaterialPointSpec>();
-                    if (!mp_spec) continue;
-                    const double wgt = mp_spec->getWeight();
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const X = &X_array[local_idx][0];
-                    TensorValue<double> tau;
-                    for (int i = 0; i < NDIM; ++i)
-                    {
-                        for (int j = 0; j < NDIM; ++j)
-                        {
-                            tau(i, j) = tau_array[local_idx][NDIM * i + j];
-                        }
-                    }
-
-                    // Weight tau using a smooth kernel function evaluated about
-                    // X.
-                    const Index<NDIM> i = IndexUtilities::getCellIndex(
-                        X, x_lower, x_upper, dx, patch_box.lower(), patch_box.upper());
-                    VectorValue<double> X_cell;
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        X_cell(d) =
-                            x_lower[d] +
-                            dx[d] * (static_cast<double>(i(d) - patch_box.lower(d)) + 0.5);
-                    }
-                    for (unsigned int component = 0; component < NDIM; ++component)
+                    compute_kernel_weights(
+                        box, phi, dphi, i, component, X, x_lower, dx, patch_box.lower());
+                    for (Box<NDIM>::Iterator b(box * side_boxes[component]); b; b++)
                     {
-                        boost::array<boost::multi_array<double, 1>, NDIM> phi, dphi;
-                        Box<NDIM> box(i, i);
-                        for (unsigned int d = 0; d < NDIM; ++d)
-                        {
-                            if (d == component)
-                            {
-                                box.lower(d) -= (kernel_width - 1);
-                                box.upper(d) += (kernel_width);
-                            }
-                            else
-                            {
-                                box.lower(d) -=
-                                    (X[d] <= X_cell(d) ? kernel_width : kernel_width - 1);
-                                box.upper(d) +=
-                                    (X[d] >= X_cell(d) ? kernel_width : kernel_width - 1);
-                            }
-                            typedef boost::multi_array_types::extent_range range;
-                            phi[d].resize(boost::extents[range(box.lower(d), box.upper(d))]);
-                            dphi[d].resize(boost::extents[range(box.lower(d), box.upper(d))]);
-                        }
-                        for (unsigned int d = 0; d < NDIM; ++d)
-                        {
-                            for (int i = box.lower(d); i <= box.upper(d); ++i)
-                            {
-                                const double x_grid =
-                                    x_lower[d] +
-                                    dx[d] * (static_cast<double>(i - patch_box.lower(d)) +
-                                             (d == component ? 0.0 : 0.5));
-                                const double del = x_grid - X[d];
-                                phi[d][i] = kernel(del / dx[d]);
-                                dphi[d][i] = kernel_diff(del / dx[d]) / dx[d];
-                            }
-                        }
-                        for (Box<NDIM>::Iterator b(box * side_boxes[component]); b; b++)
+                        const Index<NDIM>& ic = b();
+                        int m[NDIM];
+                        for (unsigned int d = 0; d < NDIM; ++d) m[d] = ic(d) - box.lower(d);
+                        double f = 0.0;
+                        for (unsigned int l = 0; l < NDIM; ++l)
                         {
-                            const Index<NDIM>& i = b();
-                            double f = 0.0;
-                            for (unsigned int k = 0; k < NDIM; ++k)
+                            double dw_dx_l = 1.0;
+                            for (unsigned int d = 0; d < NDIM; ++d)
                             {
-                                double dw_dx_k = 1.0;
-                                for (unsigned int d = 0; d < NDIM; ++d)
-                                {
-                                    if (d == k)
-                                        dw_dx_k *= dphi[d][i(d)];
-                                    else
-                                        dw_dx_k *= phi[d][i(d)];
-                                }
-                                f += tau(component, k) * dw_dx_k;
+                                dw_dx_l *= (d == l ? dphi[d][m[d]] : phi[d][m[d]]);
                             }
-                            (*f_data)(SideIndex<NDIM>(i, component, SideIndex<NDIM>::Lower)) +=
-                                f * wgt / dV_c;
+                            f += tau[NDIM * component + l] * dw_dx_l;
                         }
+                        (*f_data)(SideIndex<NDIM>(ic, component, SideIndex<NDIM>::Lower)) +=
+                            f * wgt;
                     }
                 }
             }
         }
+        (*X_data)[ln]->restoreArrays();
+        d_tau_data[ln]->restoreArrays();
     }
     return;
 } // spreadForce
@@ -1149,6 +1118,7 @@ void IMPMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > /*hierarchy
                                       Pointer<GriddingAlgorithm<NDIM> > /*gridding_alg*/)
 {
     d_l_data_manager->endDataRedistribution();
+    d_mp_data_needs_reinit = true;
     return;
 } // endDataRedistribution
 
@@ -1170,6 +1140,7 @@ void IMPMethod::initializeLevelData(Pointer<BasePatchHierarchy<NDIM> > hierarchy
                                           initial_time,
                                           old_level,
                                           allocate_data);
+    d_mp_data_needs_reinit = true;
     if (initial_time && d_l_data_manager->levelContainsLagrangianData(level_number))
     {
         Pointer<LData> Grad_U_data = d_l_data_manager->createLData(
@@ -1234,6 +1205,7 @@ void IMPMethod::resetHierarchyConfiguration(Pointer<BasePatchHierarchy<NDIM> > h
     d_l_data_manager->setPatchHierarchy(hierarchy);
     d_l_data_manager->setPatchLevels(0, finest_hier_level);
     d_l_data_manager->resetHierarchyConfiguration(hierarchy, coarsest_level, finest_level);
+    d_mp_data_needs_reinit = true;
     return;
 } // resetHierarchyConfiguration
 
@@ -1390,6 +1362,66 @@ void IMPMethod::reinitMidpointData(const std::vector<Pointer<LData> >& current_d
     return;
 } // reinitMidpointData
 
+void IMPMethod::reinitMaterialPointData()
+{
+    const int coarsest_ln = 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    d_mp_data.clear();
+    d_mp_data.resize(finest_ln + 1);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+        MaterialPointData& mp_data = d_mp_data[ln];
+
+        // Collect the nodes associated with each local patch.
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        mp_data.patch_offsets.push_back(0);
+        mp_data.spread_patch_offsets.push_back(0);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<LNodeSetData> idx_data =
+                patch->getPatchData(d_l_data_manager->getLNodePatchDescriptorIndex());
+            for (LNodeSetData::CellIterator it(idx_data->getGhostBox()); it; it++)
+            {
+                LNodeSet* const node_set = idx_data->getItem(*it);
+                if (!node_set) continue;
+                for (LNodeSet::iterator n = node_set->begin(); n != node_set->end(); ++n)
+                {
+                    const LNode* const node_idx = *n;
+                    const int local_idx = node_idx->getLocalPETScIndex();
+                    mp_data.patch_idxs.push_back(local_idx);
+                    const MaterialPointSpec* const mp_spec =
+                        node_idx->getNodeDataItem<MaterialPointSpec>();
+                    if (!mp_spec) continue;
+                    mp_data.spread_idxs.push_back(local_idx);
+                    mp_data.spread_wgts.push_back(mp_spec->getWeight());
+                }
+            }
+            mp_data.patch_offsets.push_back(static_cast<int>(mp_data.patch_idxs.size()));
+            mp_data.spread_patch_offsets.push_back(
+                static_cast<int>(mp_data.spread_idxs.size()));
+        }
+
+        // Collect the material point parameters of the local nodes.
+        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
+        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+        for (std::vector<LNode*>::const_iterator cit = local_nodes.begin();
+             cit != local_nodes.end();
+             ++cit)
+        {
+            const LNode* const node_idx = *cit;
+            MaterialPointSpec* const mp_spec = node_idx->getNodeDataItem<MaterialPointSpec>();
+            if (!mp_spec) continue;
+            mp_data.local_idxs.push_back(node_idx->getLocalPETScIndex());
+            mp_data.subdomain_ids.push_back(mp_spec->getSubdomainId());
+            mp_data.specs.push_back(mp_spec);
+        }
+    }
+    d_mp_data_needs_reinit = false;
+    return;
+} // reinitMaterialPointData
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 void IMPMethod::getFromInput(Pointer<Database> db, bool is_from_restart)
@@ -90,6 +90,11 @@ template <typename T>
 class TensorValue;
 } // namespace libMesh
 
+namespace IBAMR
+{
+class MaterialPointSpec;
+} // namespace IBAMR
+
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
 
 namespace IBAMR
@@ -351,6 +356,12 @@ protected:
                        const std::vector<SAMRAI::tbox::Pointer<IBTK::LData> >& new_data,
                        const std::vector<SAMRAI::tbox::Pointer<IBTK::LData> >& half_data);
 
+    /*!
+     * Rebuild the contiguous per-level material point data from the
+     * Lagrangian node data stored on the patch hierarchy.
+     */
+    void reinitMaterialPointData();
+
     /*
      * Indicates whether the integrator should output logging messages.
      */
@@ -401,6 +412,35 @@ protected:
         d_F_half_data;
     std::vector<SAMRAI::tbox::Pointer<IBTK::LData> > d_tau_data;
 
+    /*
+     * Contiguous per-level material point data.
+     *
+     * These arrays cache the node indices and material point parameters that
+     * would otherwise be obtained by traversing the LNode objects associated
+     * with each patch.  They are rebuilt lazily after the Lagrangian data are
+     * initialized or redistributed.
+     */
+    struct MaterialPointData
+    {
+        // Ghosted local PETSc indices of the nodes in the ghost box of each
+        // local patch, in patch order; patch p owns entries
+        // [patch_offsets[p], patch_offsets[p+1]).
+        std::vector<int> patch_offsets, patch_idxs;
+
+        // Ghosted local PETSc indices and weights of the material points in
+        // the ghost box of each local patch, in patch order.
+        std::vector<int> spread_patch_offsets, spread_idxs;
+        std::vector<double> spread_wgts;
+
+        // Local PETSc indices, subdomain IDs, and specifications of the local
+        // material points.
+        std::vector<int> local_idxs;
+        std::vector<libMesh::subdomain_id_type> subdomain_ids;
+        std::vector<MaterialPointSpec*> specs;
+    };
+    std::vector<MaterialPointData> d_mp_data;
+    bool d_mp_data_needs_reinit;
+
     /*
      * The specification and initialization information for the Lagrangian data
      * used by the integrator.
@@ -60,6 +60,7 @@
 #include "ibamr/ibamr_utilities.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/CartExtrapPhysBdryOp.h"
+#include "ibtk/PatchTaskExecutor.h"
 #include "tbox/Timer.h"
 #include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
@@ -283,6 +284,172 @@ static Timer* t_apply_convective_operator;
 static Timer* t_apply;
 static Timer* t_initialize_operator_state;
 static Timer* t_deallocate_operator_state;
+
+// Computes the convective derivative on a single patch from the face-centered
+// extrapolated values and fluxes.  Tasks are executed on each patch of a level
+// by PatchTaskExecutor::execute().
+class DifferenceTask
+{
+public:
+    DifferenceTask(const int N_idx,
+                   const int u_idx,
+                   const int q_extrap_idx,
+                   const int q_flux_idx,
+                   const unsigned int Q_data_depth,
+                   const ConvectiveDifferencingType difference_form)
+        : d_N_idx(N_idx), d_u_idx(u_idx), d_q_extrap_idx(q_extrap_idx), d_q_flux_idx(q_flux_idx),
+          d_Q_data_depth(Q_data_depth), d_difference_form(difference_form)
+    {
+    } // DifferenceTask
+
+    void operator()(const Pointer<Patch<NDIM> >& patch) const
+    {
+        const Box<NDIM>& patch_box = patch->getBox();
+        const IntVector<NDIM>& patch_lower = patch_box.lower();
+        const IntVector<NDIM>& patch_upper = patch_box.upper();
+
+        const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+        const double* const dx = patch_geom->getDx();
+
+        Pointer<CellData<NDIM, double> > N_data = patch->getPatchData(d_N_idx);
+        const IntVector<NDIM>& N_data_gcw = N_data->getGhostCellWidth();
+
+        if (d_difference_form == ADVECTIVE || d_difference_form == SKEW_SYMMETRIC)
+        {
+            Pointer<FaceData<NDIM, double> > u_ADV_data = patch->getPatchData(d_u_idx);
+            const IntVector<NDIM>& u_ADV_data_gcw = u_ADV_data->getGhostCellWidth();
+            Pointer<FaceData<NDIM, double> > q_extrap_data = patch->getPatchData(d_q_extrap_idx);
+            const IntVector<NDIM>& q_extrap_data_gcw = q_extrap_data->getGhostCellWidth();
+            for (unsigned int d = 0; d < d_Q_data_depth; ++d)
+            {
+                ADVECT_DERIVATIVE_FC(dx,
+#if (NDIM == 2)
+                                     patch_lower(0),
+                                     patch_upper(0),
+                                     patch_lower(1),
+                                     patch_upper(1),
+                                     u_ADV_data_gcw(0),
+                                     u_ADV_data_gcw(1),
+                                     q_extrap_data_gcw(0),
+                                     q_extrap_data_gcw(1),
+                                     u_ADV_data->getPointer(0),
+                                     u_ADV_data->getPointer(1),
+                                     q_extrap_data->getPointer(0, d),
+                                     q_extrap_data->getPointer(1, d),
+                                     N_data_gcw(0),
+                                     N_data_gcw(1),
+#endif
+#if (NDIM == 3)
+                                     patch_lower(0),
+                                     patch_upper(0),
+                                     patch_lower(1),
+                                     patch_upper(1),
+                                     patch_lower(2),
+                                     patch_upper(2),
+                                     u_ADV_data_gcw(0),
+                                     u_ADV_data_gcw(1),
+                                     u_ADV_data_gcw(2),
+                                     q_extrap_data_gcw(0),
+                                     q_extrap_data_gcw(1),
+                                     q_extrap_data_gcw(2),
+                                     u_ADV_data->getPointer(0),
+                                     u_ADV_data->getPointer(1),
+                                     u_ADV_data->getPointer(2),
+                                     q_extrap_data->getPointer(0, d),
+                                     q_extrap_data->getPointer(1, d),
+                                     q_extrap_data->getPointer(2, d),
+                                     N_data_gcw(0),
+                                     N_data_gcw(1),
+                                     N_data_gcw(2),
+#endif
+                                     N_data->getPointer(d));
+            }
+        }
+
+        if (d_difference_form == CONSERVATIVE)
+        {
+            Pointer<FaceData<NDIM, double> > q_flux_data = patch->getPatchData(d_q_flux_idx);
+            const IntVector<NDIM>& q_flux_data_gcw = q_flux_data->getGhostCellWidth();
+            for (unsigned int d = 0; d < d_Q_data_depth; ++d)
+            {
+                static const double alpha = 1.0;
+                F_TO_C_DIV_FC(N_data->getPointer(d),
+                              N_data_gcw.min(),
+                              alpha,
+#if (NDIM == 2)
+                              q_flux_data->getPointer(0, d),
+                              q_flux_data->getPointer(1, d),
+                              q_flux_data_gcw.min(),
+                              patch_lower(0),
+                              patch_upper(0),
+                              patch_lower(1),
+                              patch_upper(1),
+#endif
+#if (NDIM == 3)
+                              q_flux_data->getPointer(0, d),
+                              q_flux_data->getPointer(1, d),
+                              q_flux_data->getPointer(2, d),
+                              q_flux_data_gcw.min(),
+                              patch_lower(0),
+                              patch_upper(0),
+                              patch_lower(1),
+                              patch_upper(1),
+                              patch_lower(2),
+                              patch_upper(2),
+#endif
+                              dx);
+            }
+        }
+
+        if (d_difference_form == SKEW_SYMMETRIC)
+        {
+            Pointer<FaceData<NDIM, double> > q_flux_data = patch->getPatchData(d_q_flux_idx);
+            const IntVector<NDIM>& q_flux_data_gcw = q_flux_data->getGhostCellWidth();
+            for (unsigned int d = 0; d < d_Q_data_depth; ++d)
+            {
+                static const double alpha = 0.5;
+                static const double beta = 0.5;
+                F_TO_C_DIV_ADD_FC(N_data->getPointer(d),
+                                  N_data_gcw.min(),
+                                  alpha,
+#if (NDIM == 2)
+                                  q_flux_data->getPointer(0, d),
+                                  q_flux_data->getPointer(1, d),
+                                  q_flux_data_gcw.min(),
+                                  beta,
+                                  N_data->getPointer(d),
+                                  N_data_gcw.min(),
+                                  patch_lower(0),
+                                  patch_upper(0),
+                                  patch_lower(1),
+                                  patch_upper(1),
+#endif
+#if (NDIM == 3)
+                                  q_flux_data->getPointer(0, d),
+                                  q_flux_data->getPointer(1, d),
+                                  q_flux_data->getPointer(2, d),
+                                  q_flux_data_gcw.min(),
+                                  beta,
+                                  N_data->getPointer(d),
+                                  N_data_gcw.min(),
+                                  patch_lower(0),
+                                  patch_upper(0),
+                                  patch_lower(1),
+                                  patch_upper(1),
+                                  patch_lower(2),
+                                  patch_upper(2),
+#endif
+                                  dx);
+            }
+        }
+        return;
+    } // operator()
+
+private:
+    const int d_N_idx, d_u_idx, d_q_extrap_idx, d_q_flux_idx;
+    const unsigned int d_Q_data_depth;
+    const ConvectiveDifferencingType d_difference_form;
+};
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -537,156 +704,11 @@ void AdvDiffCenteredConvectiveOperator::applyConvectiveOperator(const int Q_idx,
     }
 
     // Difference values on the patches.
+    const DifferenceTask difference_task(
+        N_idx, d_u_idx, d_q_extrap_idx, d_q_flux_idx, d_Q_data_depth, d_difference_form);
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            const Box<NDIM>& patch_box = patch->getBox();
-            const IntVector<NDIM>& patch_lower = patch_box.lower();
-            const IntVector<NDIM>& patch_upper = patch_box.upper();
-
-            const Pointer<CartesianPatchGeometry<NDIM> > patch_geom =
-                patch->getPatchGeometry();
-            const double* const dx = patch_geom->getDx();
-
-            Pointer<CellData<NDIM, double> > N_data = patch->getPatchData(N_idx);
-            const IntVector<NDIM>& N_data_gcw = N_data->getGhostCellWidth();
-
-            if (d_difference_form == ADVECTIVE || d_difference_form == SKEW_SYMMETRIC)
-            {
-                Pointer<FaceData<NDIM, double> > u_ADV_data = patch->getPatchData(d_u_idx);
-                const IntVector<NDIM>& u_ADV_data_gcw = u_ADV_data->getGhostCellWidth();
-                Pointer<FaceData<NDIM, double> > q_extrap_data =
-                    patch->getPatchData(d_q_extrap_idx);
-                const IntVector<NDIM>& q_extrap_data_gcw = q_extrap_data->getGhostCellWidth();
-                for (unsigned int d = 0; d < d_Q_data_depth; ++d)
-                {
-                    ADVECT_DERIVATIVE_FC(dx,
-#if (NDIM == 2)
-                                         patch_lower(0),
-                                         patch_upper(0),
-                                         patch_lower(1),
-                                         patch_upper(1),
-                                         u_ADV_data_gcw(0),
-                                         u_ADV_data_gcw(1),
-                                         q_extrap_data_gcw(0),
-                                         q_extrap_data_gcw(1),
-                                         u_ADV_data->getPointer(0),
-                                         u_ADV_data->getPointer(1),
-                                         q_extrap_data->getPointer(0, d),
-                                         q_extrap_data->getPointer(1, d),
-                                         N_data_gcw(0),
-                                         N_data_gcw(1),
-#endif
-#if (NDIM == 3)
-                                         patch_lower(0),
-                                         patch_upper(0),
-                                         patch_lower(1),
-                                         patch_upper(1),
-                                         patch_lower(2),
-                                         patch_upper(2),
-                                         u_ADV_data_gcw(0),
-                                         u_ADV_data_gcw(1),
-                                         u_ADV_data_gcw(2),
-                                         q_extrap_data_gcw(0),
-                                         q_extrap_data_gcw(1),
-                                         q_extrap_data_gcw(2),
-                                         u_ADV_data->getPointer(0),
-                                         u_ADV_data->getPointer(1),
-                                         u_ADV_data->getPointer(2),
-                                         q_extrap_data->getPointer(0, d),
-                                         q_extrap_data->getPointer(1, d),
-                                         q_extrap_data->getPointer(2, d),
-                                         N_data_gcw(0),
-                                         N_data_gcw(1),
-                                         N_data_gcw(2),
-#endif
-                                         N_data->getPointer(d));
-                }
-            }
-
-            if (d_difference_form == CONSERVATIVE)
-            {
-                Pointer<FaceData<NDIM, double> > q_flux_data =
-                    patch->getPatchData(d_q_flux_idx);
-                const IntVector<NDIM>& q_flux_data_gcw = q_flux_data->getGhostCellWidth();
-                for (unsigned int d = 0; d < d_Q_data_depth; ++d)
-                {
-                    static const double alpha = 1.0;
-                    F_TO_C_DIV_FC(N_data->getPointer(d),
-                                  N_data_gcw.min(),
-                                  alpha,
-#if (NDIM == 2)
-                                  q_flux_data->getPointer(0, d),
-                                  q_flux_data->getPointer(1, d),
-                                  q_flux_data_gcw.min(),
-                                  patch_lower(0),
-                                  patch_upper(0),
-                                  patch_lower(1),
-                                  patch_upper(1),
-#endif
-#if (NDIM == 3)
-                                  q_flux_data->getPointer(0, d),
-                                  q_flux_data->getPointer(1, d),
-                                  q_flux_data->getPointer(2, d),
-                                  q_flux_data_gcw.min(),
-                                  patch_lower(0),
-                                  patch_upper(0),
-                                  patch_lower(1),
-                                  patch_upper(1),
-                                  patch_lower(2),
-                                  patch_upper(2),
-#endif
-                                  dx);
-                }
-            }
-
-            if (d_difference_form == SKEW_SYMMETRIC)
-            {
-                Pointer<FaceData<NDIM, double> > q_flux_data =
-                    patch->getPatchData(d_q_flux_idx);
-                const IntVector<NDIM>& q_flux_data_gcw = q_flux_data->getGhostCellWidth();
-                for (unsigned int d = 0; d < d_Q_data_depth; ++d)
-                {
-                    static const double alpha = 0.5;
-                    static const double beta = 0.5;
-                    F_TO_C_DIV_ADD_FC(N_data->getPointer(d),
-                                      N_data_gcw.min(),
-                                      alpha,
-#if (NDIM == 2)
-                                      q_flux_data->getPointer(0, d),
-                                      q_flux_data->getPointer(1, d),
-                                      q_flux_data_gcw.min(),
-                                      beta,
-                                      N_data->getPointer(d),
-                                      N_data_gcw.min(),
-                                      patch_lower(0),
-                                      patch_upper(0),
-                                      patch_lower(1),
-                                      patch_upper(1),
-#endif
-#if (NDIM == 3)
-                                      q_flux_data->getPointer(0, d),
-                                      q_flux_data->getPointer(1, d),
-                                      q_flux_data->getPointer(2, d),
-                                      q_flux_data_gcw.min(),
-                                      beta,
-                                      N_data->getPointer(d),
-                                      N_data_gcw.min(),
-                                      patch_lower(0),
-                                      patch_upper(0),
-                                      patch_lower(1),
-                                      patch_upper(1),
-                                      patch_lower(2),
-                                      patch_upper(2),
-#endif
-                                      dx);
-                }
-            }
-        }
+        PatchTaskExecutor::execute(difference_task, d_hierarchy->getPatchLevel(ln));
     }
     IBAMR_TIMER_STOP(t_apply_convective_operator);
     return;
@@ -989,6 +989,11 @@ void AdvDiffHierarchyIntegrator::resetHierarchyConfigurationSpecialized(
     return;
 } // resetHierarchyConfigurationSpecialized
 
+bool AdvDiffHierarchyIntegrator::canResetIntegratorToPreadvanceStateSpecialized() const
+{
+    return true;
+} // canResetIntegratorToPreadvanceStateSpecialized
+
 void AdvDiffHierarchyIntegrator::putToDatabaseSpecialized(Pointer<Database> db)
 {
 #if !defined(NDEBUG)
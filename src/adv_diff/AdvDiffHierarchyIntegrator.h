@@ -460,6 +460,12 @@ protected:
         int coarsest_level,
         int finest_level);
 
+    /*!
+     * Indicate that the integrator can be reset to the state at the beginning
+     * of the current time step.
+     */
+    bool canResetIntegratorToPreadvanceStateSpecialized() const;
+
     /*!
      * Write out specialized object state to the given database.
      */
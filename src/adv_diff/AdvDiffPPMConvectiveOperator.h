@@ -47,6 +47,7 @@
 #include "RefinePatchStrategy.h"
 #include "ibamr/ConvectiveOperator.h"
 #include "ibamr/ibamr_enums.h"
+#include "ibtk/PatchScratchPool.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 
@@ -220,6 +221,9 @@ private:
     SAMRAI::tbox::Pointer<SAMRAI::pdat::FaceVariable<NDIM, double> > d_q_extrap_var,
         d_q_flux_var;
     int d_q_extrap_idx, d_q_flux_idx;
+
+    // Reusable storage for per-patch temporaries.
+    IBTK::PatchScratchPool d_scratch_pool;
 };
 } // namespace IBAMR
 
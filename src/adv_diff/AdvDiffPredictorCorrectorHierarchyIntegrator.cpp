@@ -56,6 +56,9 @@
 #include "HierarchySideDataOpsReal.h"
 #include "IntVector.h"
 #include "Patch.h"
+#include "PatchData.h"
+#include "PatchDataFactory.h"
+#include "PatchDescriptor.h"
 #include "PatchFaceDataOpsReal.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
@@ -74,6 +77,7 @@
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/LaplaceOperator.h"
 #include "ibtk/PoissonSolver.h"
+#include "tbox/Array.h"
 #include "tbox/MathUtilities.h"
 #include "tbox/NullDatabase.h"
 #include "tbox/PIO.h"
@@ -108,6 +112,26 @@ namespace
 {
 // Number of ghosts cells used for each variable quantity.
 static const int CELLG = 1;
+
+// Copy patch data, along with its time stamp, between pairs of patch data
+// indices on a single level of the patch hierarchy.
+inline void copy_level_data(Pointer<PatchLevel<NDIM> > level,
+                            const std::vector<int>& dst_idxs,
+                            const std::vector<int>& src_idxs)
+{
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        for (unsigned int k = 0; k < dst_idxs.size(); ++k)
+        {
+            Pointer<PatchData<NDIM> > dst_data = patch->getPatchData(dst_idxs[k]);
+            Pointer<PatchData<NDIM> > src_data = patch->getPatchData(src_idxs[k]);
+            dst_data->copy(*src_data);
+            dst_data->setTime(src_data->getTime());
+        }
+    }
+    return;
+} // copy_level_data
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -119,7 +143,9 @@ AdvDiffPredictorCorrectorHierarchyIntegrator::AdvDiffPredictorCorrectorHierarchy
     bool register_for_restart)
     : AdvDiffHierarchyIntegrator(object_name, input_db, register_for_restart),
       d_hyp_level_integrator(NULL), d_hyp_level_integrator_db(NULL), d_hyp_patch_ops(NULL),
-      d_hyp_patch_ops_db(NULL), d_explicit_predictor(explicit_predictor)
+      d_hyp_patch_ops_db(NULL), d_explicit_predictor(explicit_predictor),
+      d_use_subcycling(false), d_subcycle_context(NULL), d_subcycle_data(),
+      d_subcycle_current_idxs(), d_subcycle_saved_idxs()
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(!object_name.empty());
@@ -144,6 +170,10 @@ AdvDiffPredictorCorrectorHierarchyIntegrator::AdvDiffPredictorCorrectorHierarchy
     {
         d_hyp_patch_ops_db = new NullDatabase();
     }
+    if (input_db->keyExists("use_subcycling"))
+    {
+        d_use_subcycling = input_db->getBool("use_subcycling");
+    }
 
     // Check to make sure the time stepping types are supported.
     switch (d_default_diffusion_time_stepping_type)
@@ -219,7 +249,7 @@ void AdvDiffPredictorCorrectorHierarchyIntegrator::initializeHierarchyIntegrator
                                             d_hyp_level_integrator_db,
                                             d_hyp_patch_ops,
                                             d_registered_for_restart,
-                                            /*using_time_refinement*/ false);
+                                            /*using_time_refinement*/ d_use_subcycling);
 
     // Setup variable contexts.
     d_current_context = d_hyp_level_integrator->getCurrentContext();
@@ -312,6 +342,11 @@ void AdvDiffPredictorCorrectorHierarchyIntegrator::initializeHierarchyIntegrator
         if (d_Q_init[Q_var]) d_hyp_patch_ops->setInitialConditions(Q_var, d_Q_init[Q_var]);
         if (!d_Q_bc_coef[Q_var].empty())
             d_hyp_patch_ops->setPhysicalBcCoefs(Q_var, d_Q_bc_coef[Q_var]);
+
+        // The transported quantities are maintained by the level integrator
+        // rather than registered as state variables, so they must be
+        // registered separately for use in the embedded error estimate.
+        registerEmbeddedErrorEstimateVariable(Q_var);
     }
 
     // Initialize the HyperbolicLevelIntegrator.
@@ -320,6 +355,34 @@ void AdvDiffPredictorCorrectorHierarchyIntegrator::initializeHierarchyIntegrator
     // the level integrator.
     d_hyp_level_integrator->initializeLevelIntegrator(d_gridding_alg);
 
+    // Setup storage used to save the current values of all time-dependent
+    // quantities while finer levels are subcycled.
+    if (d_use_subcycling)
+    {
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        d_subcycle_context = var_db->getContext(d_object_name + "::SUBCYCLE");
+        std::vector<Pointer<Variable<NDIM> > > time_dep_vars;
+        time_dep_vars.insert(time_dep_vars.end(), d_Q_var.begin(), d_Q_var.end());
+        time_dep_vars.insert(time_dep_vars.end(), d_Q_rhs_var.begin(), d_Q_rhs_var.end());
+        time_dep_vars.insert(time_dep_vars.end(), d_u_var.begin(), d_u_var.end());
+        time_dep_vars.insert(time_dep_vars.end(), d_F_var.begin(), d_F_var.end());
+        time_dep_vars.insert(
+            time_dep_vars.end(), d_diffusion_coef_var.begin(), d_diffusion_coef_var.end());
+        for (unsigned int k = 0; k < time_dep_vars.size(); ++k)
+        {
+            const int current_idx =
+                var_db->mapVariableAndContextToIndex(time_dep_vars[k], getCurrentContext());
+            const IntVector<NDIM>& ghosts = var_db->getPatchDescriptor()
+                                                ->getPatchDataFactory(current_idx)
+                                                ->getGhostCellWidth();
+            const int saved_idx = var_db->registerVariableAndContext(
+                time_dep_vars[k], d_subcycle_context, ghosts);
+            d_subcycle_current_idxs.push_back(current_idx);
+            d_subcycle_saved_idxs.push_back(saved_idx);
+            d_subcycle_data.setFlag(saved_idx);
+        }
+    }
+
     // Perform hierarchy initialization operations common to all implementations
     // of AdvDiffHierarchyIntegrator.
     AdvDiffHierarchyIntegrator::initializeHierarchyIntegrator(hierarchy, gridding_alg);
@@ -472,22 +535,46 @@ AdvDiffPredictorCorrectorHierarchyIntegrator::integrateHierarchy(const double cu
         }
     }
 
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    if (d_use_subcycling && finest_ln > coarsest_ln)
     {
+        // Save the current data on the finer levels, which is overwritten while
+        // those levels are subcycled, advance the hierarchy recursively, and
+        // then restore the current data.
+        for (int ln = coarsest_ln + 1; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(d_subcycle_data, current_time);
+            copy_level_data(level, d_subcycle_saved_idxs, d_subcycle_current_idxs);
+        }
         static const bool first_step = true;
         static const bool last_step = false;
-        d_hyp_level_integrator->advanceLevel(d_hierarchy->getPatchLevel(ln),
-                                             d_hierarchy,
-                                             current_time,
-                                             new_time,
-                                             first_step,
-                                             last_step);
+        advanceLevelSubcycled(coarsest_ln, current_time, new_time, first_step, last_step);
+        for (int ln = coarsest_ln + 1; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            copy_level_data(level, d_subcycle_current_idxs, d_subcycle_saved_idxs);
+            level->deallocatePatchData(d_subcycle_data);
+        }
     }
-
-    if (finest_ln > 0)
+    else
     {
-        d_hyp_level_integrator->standardLevelSynchronization(
-            d_hierarchy, coarsest_ln, finest_ln, new_time, current_time);
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            static const bool first_step = true;
+            static const bool last_step = false;
+            d_hyp_level_integrator->advanceLevel(d_hierarchy->getPatchLevel(ln),
+                                                 d_hierarchy,
+                                                 current_time,
+                                                 new_time,
+                                                 first_step,
+                                                 last_step);
+        }
+
+        if (finest_ln > 0)
+        {
+            d_hyp_level_integrator->standardLevelSynchronization(
+                d_hierarchy, coarsest_ln, finest_ln, new_time, current_time);
+        }
     }
 
     // Compute any time-dependent source terms at time-level n+1/2.
@@ -760,11 +847,17 @@ double AdvDiffPredictorCorrectorHierarchyIntegrator::getMaximumTimeStepSizeSpeci
 {
     double dt = d_dt_max;
     const bool initial_time = MathUtilities<double>::equalEps(d_integrator_time, d_start_time);
+    int num_level_steps = 1;
     for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        dt = std::min(
-            dt, d_hyp_level_integrator->getLevelDt(level, d_integrator_time, initial_time));
+        if (d_use_subcycling && ln > 0)
+        {
+            num_level_steps *= level->getRatioToCoarserLevel().max();
+        }
+        dt = std::min(dt,
+                      num_level_steps * d_hyp_level_integrator->getLevelDt(
+                                            level, d_integrator_time, initial_time));
     }
     if (!initial_time && d_dt_growth_factor >= 1.0)
     {
@@ -936,6 +1029,64 @@ void AdvDiffPredictorCorrectorHierarchyIntegrator::applyGradientDetectorSpeciali
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+AdvDiffPredictorCorrectorHierarchyIntegrator::advanceLevelSubcycled(const int ln,
+                                                                    const double current_time,
+                                                                    const double new_time,
+                                                                    const bool first_step,
+                                                                    const bool last_step)
+{
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    d_hyp_level_integrator->advanceLevel(d_hierarchy->getPatchLevel(ln),
+                                         d_hierarchy,
+                                         current_time,
+                                         new_time,
+                                         first_step,
+                                         last_step);
+    if (ln == finest_ln) return;
+
+    // Advance the next finer level to new_time using a sequence of time steps
+    // whose number is given by the refinement ratio.  Coarse-fine ghost cell
+    // values are obtained by time interpolation of the coarse level data.
+    const int fine_ln = ln + 1;
+    Pointer<PatchLevel<NDIM> > fine_level = d_hierarchy->getPatchLevel(fine_ln);
+    const int num_steps = fine_level->getRatioToCoarserLevel().max();
+    const double fine_dt = (new_time - current_time) / static_cast<double>(num_steps);
+    double fine_current_time = current_time;
+    for (int step = 0; step < num_steps; ++step)
+    {
+        const bool fine_first_step = (step == 0);
+        const bool fine_last_step = (step == num_steps - 1);
+        const double fine_new_time =
+            fine_last_step ? new_time : current_time + static_cast<double>(step + 1) * fine_dt;
+        if (!fine_first_step)
+        {
+            // Make the data computed during the previous step the current data
+            // on the finer levels, all of which have reached fine_current_time.
+            for (int reset_ln = fine_ln; reset_ln <= finest_ln; ++reset_ln)
+            {
+                d_hyp_level_integrator->resetTimeDependentData(
+                    d_hierarchy->getPatchLevel(reset_ln),
+                    fine_current_time,
+                    d_gridding_alg->levelCanBeRefined(reset_ln));
+            }
+        }
+        advanceLevelSubcycled(
+            fine_ln, fine_current_time, fine_new_time, fine_first_step, fine_last_step);
+        fine_current_time = fine_new_time;
+    }
+
+    // Synchronize the two levels: correct the coarse level fluxes along the
+    // coarse-fine interface using the time-integrated fine level fluxes and
+    // coarsen the fine level data.
+    Array<double> old_times(fine_ln + 1);
+    for (int k = 0; k < fine_ln; ++k) old_times[k] = current_time;
+    old_times[fine_ln] = new_time - fine_dt;
+    d_hyp_level_integrator->standardLevelSynchronization(
+        d_hierarchy, ln, fine_ln, new_time, old_times);
+    return;
+} // advanceLevelSubcycled
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBAMR
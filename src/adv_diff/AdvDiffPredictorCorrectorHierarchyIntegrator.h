@@ -36,7 +36,9 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <string>
+#include <vector>
 
+#include "ComponentSelector.h"
 #include "HyperbolicLevelIntegrator.h"
 #include "IntVector.h"
 #include "MultiblockDataTranslator.h"
@@ -56,6 +58,7 @@ template <int DIM>
 class BasePatchLevel;
 template <int DIM>
 class PatchHierarchy;
+class VariableContext;
 } // namespace hier
 namespace mesh
 {
@@ -79,9 +82,15 @@ namespace IBAMR
  * advection velocity may be used with each quantity registered with the
  * integrator.
  *
- * This hierarchy integrator advances all levels of the patch hierarchy
- * synchronously in time.  In particular, subcycling in time is \em not
- * performed.
+ * By default, this hierarchy integrator advances all levels of the patch
+ * hierarchy synchronously in time.  When the input key <TT>use_subcycling</TT>
+ * is set to <TT>TRUE</TT>, the explicit advective step is instead subcycled in
+ * time: each finer level takes as many time steps as its refinement ratio per
+ * time step of the next coarser level, using time-interpolated coarse-fine
+ * ghost values, and the levels are synchronized by refluxing.  The time step
+ * size is then limited by the coarsest level, accounting for the refinement
+ * ratios.  The implicit diffusive step is always performed synchronously on
+ * the entire hierarchy.
  *
  * Either Crank-Nicolson (i.e., the trapezoidal rule) or backward Euler is used
  * for the linearly implicit treatment of the diffusive terms.  The advective
@@ -152,8 +161,7 @@ public:
     preprocessIntegrateHierarchy(double current_time, double new_time, int num_cycles = 1);
 
     /*!
-     * Synchronously advance each level in the hierarchy over the given time
-     * increment.
+     * Advance each level in the hierarchy over the given time increment.
      */
     void integrateHierarchy(double current_time, double new_time, int cycle_num = 0);
 
@@ -247,6 +255,18 @@ private:
     AdvDiffPredictorCorrectorHierarchyIntegrator&
     operator=(const AdvDiffPredictorCorrectorHierarchyIntegrator& that);
 
+    /*!
+     * Advance the explicit advective terms on level ln from current_time to
+     * new_time, and recursively advance all finer levels using refinement
+     * ratio-smaller time steps.  Each pair of levels is synchronized once the
+     * finer level reaches new_time.
+     */
+    void advanceLevelSubcycled(int ln,
+                               double current_time,
+                               double new_time,
+                               bool first_step,
+                               bool last_step);
+
     /*
      * The SAMRAI::algs::HyperbolicLevelIntegrator supplies generic operations
      * use to handle the explicit integration of advection terms.
@@ -260,6 +280,17 @@ private:
     SAMRAI::tbox::Pointer<AdvDiffPredictorCorrectorHyperbolicPatchOps> d_hyp_patch_ops;
     SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> d_hyp_patch_ops_db;
     SAMRAI::tbox::Pointer<AdvectorExplicitPredictorPatchOps> d_explicit_predictor;
+
+    /*
+     * Data used when subcycling the advective terms in time.  The current data
+     * on the finer levels is saved prior to subcycling and restored afterwards
+     * so that the diffusive terms are treated exactly as in the synchronous
+     * case.
+     */
+    bool d_use_subcycling;
+    SAMRAI::tbox::Pointer<SAMRAI::hier::VariableContext> d_subcycle_context;
+    SAMRAI::hier::ComponentSelector d_subcycle_data;
+    std::vector<int> d_subcycle_current_idxs, d_subcycle_saved_idxs;
 };
 } // namespace IBAMR
 
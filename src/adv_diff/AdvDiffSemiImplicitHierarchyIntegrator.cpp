@@ -34,8 +34,11 @@
 
 #include <stddef.h>
 #include <algorithm>
+#include <cmath>
 #include <deque>
+#include <limits>
 #include <ostream>
+#include <sstream>
 #include <utility>
 #include <vector>
 
@@ -43,6 +46,7 @@
 #include "BasePatchHierarchy.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
+#include "CellData.h"
 #include "CellDataFactory.h"
 #include "CellVariable.h"
 #include "FaceData.h"
@@ -57,6 +61,7 @@
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
 #include "PoissonSpecifications.h"
+#include "SAMRAIVectorReal.h"
 #include "SideVariable.h"
 #include "Variable.h"
 #include "VariableContext.h"
@@ -65,6 +70,8 @@
 #include "ibamr/ConvectiveOperator.h"
 #include "ibamr/ibamr_utilities.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
+#include "ibtk/CCLaplaceOperator.h"
+#include "ibtk/CCPoissonSolverManager.h"
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/LaplaceOperator.h"
 #include "ibtk/PoissonSolver.h"
@@ -102,6 +109,35 @@ namespace IBAMR
 // Number of ghosts cells used for each variable quantity.
 static const int CELLG = 1;
 
+namespace
+{
+// Copy a range of data depths between two cell-centered patch data indices on
+// all levels of the patch hierarchy, including ghost cell values.
+inline void copy_cc_data_depths(const int dst_idx,
+                                const int dst_depth_offset,
+                                const int src_idx,
+                                const int src_depth_offset,
+                                const int num_depths,
+                                Pointer<PatchHierarchy<NDIM> > hierarchy)
+{
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
+            Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
+            for (int d = 0; d < num_depths; ++d)
+            {
+                dst_data->copyDepth(dst_depth_offset + d, *src_data, src_depth_offset + d);
+            }
+        }
+    }
+    return;
+} // copy_cc_data_depths
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 AdvDiffSemiImplicitHierarchyIntegrator::AdvDiffSemiImplicitHierarchyIntegrator(
@@ -120,6 +156,8 @@ AdvDiffSemiImplicitHierarchyIntegrator::AdvDiffSemiImplicitHierarchyIntegrator(
     d_default_convective_op_type = AdvDiffConvectiveOperatorManager::DEFAULT;
     d_default_convective_op_input_db =
         new MemoryDatabase(d_object_name + "::default_convective_op_input_db");
+    d_group_helmholtz_solves = false;
+    d_verify_grouped_helmholtz_solves = false;
 
     // Initialize object with data read from the input and restart databases.
     bool from_restart = RestartManager::getManager()->isFromRestart();
@@ -431,10 +469,39 @@ void AdvDiffSemiImplicitHierarchyIntegrator::initializeHierarchyIntegrator(
                          "CONSERVATIVE_LINEAR_REFINE");
     }
 
+    // Determine which quantities may share a single Helmholtz solve.  This must
+    // be done before default solvers are allocated so that user-supplied
+    // solvers and operators can be detected.
+    setupHelmholtzGroups();
+
     // Perform hierarchy initialization operations common to all implementations
     // of AdvDiffHierarchyIntegrator.
     AdvDiffHierarchyIntegrator::initializeHierarchyIntegrator(hierarchy, gridding_alg);
 
+    // Setup the solvers and operators for the grouped Helmholtz solves.
+    const unsigned int num_groups = d_helmholtz_groups.size();
+    d_helmholtz_group_solvers.resize(num_groups);
+    d_helmholtz_group_rhs_ops.resize(num_groups);
+    d_helmholtz_group_solvers_need_init.resize(num_groups, true);
+    d_helmholtz_group_rhs_ops_need_init.resize(num_groups, true);
+    d_helmholtz_group_sol_vecs.resize(num_groups);
+    d_helmholtz_group_rhs_vecs.resize(num_groups);
+    for (unsigned int g = 0; g < num_groups; ++g)
+    {
+        const std::string& name = d_helmholtz_group_var[g]->getName();
+        d_helmholtz_group_solvers[g] = CCPoissonSolverManager::getManager()->allocateSolver(
+            d_helmholtz_solver_type,
+            d_object_name + "::helmholtz_solver::" + name,
+            d_helmholtz_solver_db,
+            "adv_diff_",
+            d_helmholtz_precond_type,
+            d_object_name + "::helmholtz_precond::" + name,
+            d_helmholtz_precond_db,
+            "adv_diff_pc_");
+        d_helmholtz_group_rhs_ops[g] = new CCLaplaceOperator(
+            d_object_name + "::helmholtz_rhs_op::" + name, /*homogeneous_bc*/ false);
+    }
+
     // Indicate that the integrator has been initialized.
     d_integrator_is_initialized = true;
     return;
@@ -487,6 +554,12 @@ AdvDiffSemiImplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
             d_helmholtz_solvers_need_init.begin(), d_helmholtz_solvers_need_init.end(), true);
         std::fill(
             d_helmholtz_rhs_ops_need_init.begin(), d_helmholtz_rhs_ops_need_init.end(), true);
+        std::fill(d_helmholtz_group_solvers_need_init.begin(),
+                  d_helmholtz_group_solvers_need_init.end(),
+                  true);
+        std::fill(d_helmholtz_group_rhs_ops_need_init.begin(),
+                  d_helmholtz_group_rhs_ops_need_init.end(),
+                  true);
         d_coarsest_reset_ln = 0;
         d_finest_reset_ln = finest_ln;
     }
@@ -614,43 +687,151 @@ AdvDiffSemiImplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
             rhs_op_spec.setDConstant(+(1.0 - K) * kappa);
         }
 
-        // Initialize the RHS operator and compute the RHS vector.
-        Pointer<LaplaceOperator> helmholtz_rhs_op = d_helmholtz_rhs_ops[l];
-        helmholtz_rhs_op->setPoissonSpecifications(rhs_op_spec);
-        helmholtz_rhs_op->setPhysicalBcCoefs(Q_bc_coef);
-        helmholtz_rhs_op->setHomogeneousBc(false);
-        helmholtz_rhs_op->setSolutionTime(current_time);
-        helmholtz_rhs_op->setTimeInterval(current_time, new_time);
-        if (d_helmholtz_rhs_ops_need_init[l])
+        const int group_num = d_Q_helmholtz_group[l];
+        if (group_num < 0)
         {
-            if (d_enable_logging)
+            // Initialize the RHS operator and compute the RHS vector.
+            Pointer<LaplaceOperator> helmholtz_rhs_op = d_helmholtz_rhs_ops[l];
+            helmholtz_rhs_op->setPoissonSpecifications(rhs_op_spec);
+            helmholtz_rhs_op->setPhysicalBcCoefs(Q_bc_coef);
+            helmholtz_rhs_op->setHomogeneousBc(false);
+            helmholtz_rhs_op->setSolutionTime(current_time);
+            helmholtz_rhs_op->setTimeInterval(current_time, new_time);
+            if (d_helmholtz_rhs_ops_need_init[l])
             {
-                plog << d_object_name << ": "
-                     << "Initializing Helmholtz RHS operator for variable number " << l
-                     << "\n";
+                if (d_enable_logging)
+                {
+                    plog << d_object_name << ": "
+                         << "Initializing Helmholtz RHS operator for variable number " << l
+                         << "\n";
+                }
+                helmholtz_rhs_op->initializeOperatorState(*d_sol_vecs[l], *d_rhs_vecs[l]);
+                d_helmholtz_rhs_ops_need_init[l] = false;
             }
-            helmholtz_rhs_op->initializeOperatorState(*d_sol_vecs[l], *d_rhs_vecs[l]);
-            d_helmholtz_rhs_ops_need_init[l] = false;
+            d_hier_cc_data_ops->copyData(Q_scratch_idx, Q_current_idx, false);
+            helmholtz_rhs_op->apply(*d_sol_vecs[l], *d_rhs_vecs[l]);
+
         }
-        d_hier_cc_data_ops->copyData(Q_scratch_idx, Q_current_idx, false);
-        helmholtz_rhs_op->apply(*d_sol_vecs[l], *d_rhs_vecs[l]);
-
-        // Initialize the linear solver.
-        Pointer<PoissonSolver> helmholtz_solver = d_helmholtz_solvers[l];
-        helmholtz_solver->setPoissonSpecifications(solver_spec);
-        helmholtz_solver->setPhysicalBcCoefs(Q_bc_coef);
-        helmholtz_solver->setHomogeneousBc(false);
-        helmholtz_solver->setSolutionTime(new_time);
-        helmholtz_solver->setTimeInterval(current_time, new_time);
-        if (d_helmholtz_solvers_need_init[l])
+        else if (l == d_helmholtz_groups[group_num].front())
         {
-            if (d_enable_logging)
+            // Setup the shared operator and solver using the coefficients of
+            // the first quantity in the group, and compute the RHS vectors of
+            // all quantities in the group with a single operator application.
+            const std::vector<unsigned int>& group = d_helmholtz_groups[group_num];
+            for (unsigned int m = 1; m < group.size(); ++m)
             {
-                plog << d_object_name << ": "
-                     << "Initializing Helmholtz solvers for variable number " << l << "\n";
+                if (!haveCompatibleHelmholtzSystems(l, group[m]))
+                {
+                    TBOX_ERROR(d_object_name
+                               << "::preprocessIntegrateHierarchy():\n"
+                               << "  variables " << Q_var->getName() << " and "
+                               << d_Q_var[group[m]]->getName()
+                               << " share a Helmholtz solve but no longer have compatible "
+                                  "coefficients.\n"
+                               << "  set group_helmholtz_solves = FALSE to solve for these "
+                                  "variables separately.\n");
+                }
+            }
+            const int Q_group_scratch_idx = var_db->mapVariableAndContextToIndex(
+                d_helmholtz_group_var[group_num], getScratchContext());
+            const int Q_rhs_group_scratch_idx = var_db->mapVariableAndContextToIndex(
+                d_helmholtz_group_rhs_var[group_num], getScratchContext());
+            SAMRAIVectorReal<NDIM, double>& group_sol_vec =
+                *d_helmholtz_group_sol_vecs[group_num];
+            SAMRAIVectorReal<NDIM, double>& group_rhs_vec =
+                *d_helmholtz_group_rhs_vecs[group_num];
+            const std::vector<RobinBcCoefStrategy<NDIM>*>& group_bc_coefs =
+                d_helmholtz_group_bc_coefs[group_num];
+
+            Pointer<LaplaceOperator> helmholtz_rhs_op = d_helmholtz_group_rhs_ops[group_num];
+            helmholtz_rhs_op->setPoissonSpecifications(rhs_op_spec);
+            helmholtz_rhs_op->setPhysicalBcCoefs(group_bc_coefs);
+            helmholtz_rhs_op->setHomogeneousBc(false);
+            helmholtz_rhs_op->setSolutionTime(current_time);
+            helmholtz_rhs_op->setTimeInterval(current_time, new_time);
+            if (d_helmholtz_group_rhs_ops_need_init[group_num])
+            {
+                if (d_enable_logging)
+                {
+                    plog << d_object_name << ": "
+                         << "Initializing Helmholtz RHS operator for group number "
+                         << group_num << "\n";
+                }
+                helmholtz_rhs_op->initializeOperatorState(group_sol_vec, group_rhs_vec);
+                d_helmholtz_group_rhs_ops_need_init[group_num] = false;
+            }
+            for (unsigned int m = 0; m < group.size(); ++m)
+            {
+                Pointer<CellVariable<NDIM, double> > Q_m_var = d_Q_var[group[m]];
+                Pointer<CellDataFactory<NDIM, double> > Q_m_factory =
+                    Q_m_var->getPatchDataFactory();
+                copy_cc_data_depths(
+                    Q_group_scratch_idx,
+                    d_Q_helmholtz_group_depth_offset[group[m]],
+                    var_db->mapVariableAndContextToIndex(Q_m_var, getCurrentContext()),
+                    0,
+                    Q_m_factory->getDefaultDepth(),
+                    d_hierarchy);
+            }
+            helmholtz_rhs_op->apply(group_sol_vec, group_rhs_vec);
+            for (unsigned int m = 0; m < group.size(); ++m)
+            {
+                Pointer<CellVariable<NDIM, double> > Q_m_var = d_Q_var[group[m]];
+                Pointer<CellDataFactory<NDIM, double> > Q_m_factory =
+                    Q_m_var->getPatchDataFactory();
+                copy_cc_data_depths(var_db->mapVariableAndContextToIndex(
+                                        d_Q_Q_rhs_map[Q_m_var], getScratchContext()),
+                                    0,
+                                    Q_rhs_group_scratch_idx,
+                                    d_Q_helmholtz_group_depth_offset[group[m]],
+                                    Q_m_factory->getDefaultDepth(),
+                                    d_hierarchy);
+            }
+
+            Pointer<PoissonSolver> helmholtz_solver = d_helmholtz_group_solvers[group_num];
+            helmholtz_solver->setPoissonSpecifications(solver_spec);
+            helmholtz_solver->setPhysicalBcCoefs(group_bc_coefs);
+            helmholtz_solver->setHomogeneousBc(false);
+            helmholtz_solver->setSolutionTime(new_time);
+            helmholtz_solver->setTimeInterval(current_time, new_time);
+            if (d_helmholtz_group_solvers_need_init[group_num])
+            {
+                if (d_enable_logging)
+                {
+                    plog << d_object_name << ": "
+                         << "Initializing Helmholtz solvers for group number " << group_num
+                         << "\n";
+                }
+                helmholtz_solver->initializeSolverState(group_sol_vec, group_rhs_vec);
+                d_helmholtz_group_solvers_need_init[group_num] = false;
+            }
+        }
+        if (group_num >= 0)
+        {
+            d_hier_cc_data_ops->copyData(Q_scratch_idx, Q_current_idx, false);
+        }
+
+        // Initialize the linear solver used to solve for Q(n+1) separately.
+        // For quantities that share a Helmholtz solve, this solver is used only
+        // to verify the grouped solve.
+        if (group_num < 0 || d_verify_grouped_helmholtz_solves)
+        {
+            Pointer<PoissonSolver> helmholtz_solver = d_helmholtz_solvers[l];
+            helmholtz_solver->setPoissonSpecifications(solver_spec);
+            helmholtz_solver->setPhysicalBcCoefs(Q_bc_coef);
+            helmholtz_solver->setHomogeneousBc(false);
+            helmholtz_solver->setSolutionTime(new_time);
+            helmholtz_solver->setTimeInterval(current_time, new_time);
+            if (d_helmholtz_solvers_need_init[l])
+            {
+                if (d_enable_logging)
+                {
+                    plog << d_object_name << ": "
+                         << "Initializing Helmholtz solvers for variable number " << l << "\n";
+                }
+                helmholtz_solver->initializeSolverState(*d_sol_vecs[l], *d_rhs_vecs[l]);
+                d_helmholtz_solvers_need_init[l] = false;
             }
-            helmholtz_solver->initializeSolverState(*d_sol_vecs[l], *d_rhs_vecs[l]);
-            d_helmholtz_solvers_need_init[l] = false;
         }
 
         // Account for the convective difference term.
@@ -740,6 +921,8 @@ void AdvDiffSemiImplicitHierarchyIntegrator::integrateHierarchy(const double cur
     }
 
     // Perform a single step of fixed point iteration.
+    std::vector<TimeSteppingType> convective_time_stepping_types(d_Q_var.size(),
+                                                                 UNKNOWN_TIME_STEPPING_TYPE);
     unsigned int l = 0;
     for (std::vector<Pointer<CellVariable<NDIM, double> > >::const_iterator
              cit = d_Q_var.begin();
@@ -756,8 +939,6 @@ void AdvDiffSemiImplicitHierarchyIntegrator::integrateHierarchy(const double cur
         const int F_scratch_idx =
             d_F_fcn[F_var] ? var_db->mapVariableAndContextToIndex(F_var, getScratchContext()) :
                              -1;
-        const int F_new_idx =
-            d_F_fcn[F_var] ? var_db->mapVariableAndContextToIndex(F_var, getNewContext()) : -1;
         const int Q_rhs_scratch_idx =
             var_db->mapVariableAndContextToIndex(Q_rhs_var, getScratchContext());
 
@@ -901,25 +1082,148 @@ void AdvDiffSemiImplicitHierarchyIntegrator::integrateHierarchy(const double cur
             d_hier_cc_data_ops->axpy(Q_rhs_scratch_idx, 1.0, F_scratch_idx, Q_rhs_scratch_idx);
         }
 
-        // Solve for Q(n+1).
-        Pointer<PoissonSolver> helmholtz_solver = d_helmholtz_solvers[l];
-        helmholtz_solver->solveSystem(*d_sol_vecs[l], *d_rhs_vecs[l]);
-        d_hier_cc_data_ops->copyData(Q_new_idx, Q_scratch_idx);
+        convective_time_stepping_types[l] = convective_time_stepping_type;
+
+        // Solve for Q(n+1), unless Q shares a Helmholtz solve with other
+        // quantities.
+        if (d_Q_helmholtz_group[l] < 0)
+        {
+            Pointer<PoissonSolver> helmholtz_solver = d_helmholtz_solvers[l];
+            helmholtz_solver->solveSystem(*d_sol_vecs[l], *d_rhs_vecs[l]);
+            d_hier_cc_data_ops->copyData(Q_new_idx, Q_scratch_idx);
+            if (d_enable_logging)
+                plog << d_object_name
+                     << "::integrateHierarchy(): diffusion solve number of iterations = "
+                     << helmholtz_solver->getNumIterations() << "\n";
+            if (d_enable_logging)
+                plog << d_object_name
+                     << "::integrateHierarchy(): diffusion solve residual norm        = "
+                     << helmholtz_solver->getResidualNorm() << "\n";
+            if (helmholtz_solver->getNumIterations() == helmholtz_solver->getMaxIterations())
+            {
+                pout << d_object_name << "::integrateHierarchy():"
+                     << "  WARNING: linear solver iterations == max iterations\n";
+            }
+        }
+    }
+
+    // Solve for Q(n+1) for quantities that share Helmholtz solves.
+    for (unsigned int g = 0; g < d_helmholtz_groups.size(); ++g)
+    {
+        const std::vector<unsigned int>& group = d_helmholtz_groups[g];
+        const int Q_group_scratch_idx = var_db->mapVariableAndContextToIndex(
+            d_helmholtz_group_var[g], getScratchContext());
+        const int Q_rhs_group_scratch_idx = var_db->mapVariableAndContextToIndex(
+            d_helmholtz_group_rhs_var[g], getScratchContext());
+        for (unsigned int m = 0; m < group.size(); ++m)
+        {
+            Pointer<CellVariable<NDIM, double> > Q_var = d_Q_var[group[m]];
+            Pointer<CellDataFactory<NDIM, double> > Q_factory = Q_var->getPatchDataFactory();
+            const int Q_depth = Q_factory->getDefaultDepth();
+            const int Q_scratch_idx =
+                var_db->mapVariableAndContextToIndex(Q_var, getScratchContext());
+            const int Q_rhs_scratch_idx = var_db->mapVariableAndContextToIndex(
+                d_Q_Q_rhs_map[Q_var], getScratchContext());
+            const int depth_offset = d_Q_helmholtz_group_depth_offset[group[m]];
+            copy_cc_data_depths(
+                Q_group_scratch_idx, depth_offset, Q_scratch_idx, 0, Q_depth, d_hierarchy);
+            copy_cc_data_depths(Q_rhs_group_scratch_idx,
+                                depth_offset,
+                                Q_rhs_scratch_idx,
+                                0,
+                                Q_depth,
+                                d_hierarchy);
+        }
+        Pointer<PoissonSolver> helmholtz_solver = d_helmholtz_group_solvers[g];
+        helmholtz_solver->solveSystem(*d_helmholtz_group_sol_vecs[g],
+                                      *d_helmholtz_group_rhs_vecs[g]);
+        for (unsigned int m = 0; m < group.size(); ++m)
+        {
+            Pointer<CellVariable<NDIM, double> > Q_var = d_Q_var[group[m]];
+            Pointer<CellDataFactory<NDIM, double> > Q_factory = Q_var->getPatchDataFactory();
+            const int Q_depth = Q_factory->getDefaultDepth();
+            const int Q_new_idx = var_db->mapVariableAndContextToIndex(Q_var, getNewContext());
+            copy_cc_data_depths(Q_new_idx,
+                                0,
+                                Q_group_scratch_idx,
+                                d_Q_helmholtz_group_depth_offset[group[m]],
+                                Q_depth,
+                                d_hierarchy);
+        }
         if (d_enable_logging)
             plog << d_object_name
                  << "::integrateHierarchy(): diffusion solve number of iterations = "
-                 << helmholtz_solver->getNumIterations() << "\n";
+                 << helmholtz_solver->getNumIterations() << " (group " << g << ")\n";
         if (d_enable_logging)
             plog << d_object_name
                  << "::integrateHierarchy(): diffusion solve residual norm        = "
-                 << helmholtz_solver->getResidualNorm() << "\n";
+                 << helmholtz_solver->getResidualNorm() << " (group " << g << ")\n";
         if (helmholtz_solver->getNumIterations() == helmholtz_solver->getMaxIterations())
         {
             pout << d_object_name << "::integrateHierarchy():"
                  << "  WARNING: linear solver iterations == max iterations\n";
         }
 
-        // Reset the right-hand side vector.
+        // When requested, verify the grouped solve by solving for each quantity
+        // in the group separately and comparing the solutions.
+        if (d_verify_grouped_helmholtz_solves)
+        {
+            for (unsigned int m = 0; m < group.size(); ++m)
+            {
+                Pointer<CellVariable<NDIM, double> > Q_var = d_Q_var[group[m]];
+                const int Q_scratch_idx =
+                    var_db->mapVariableAndContextToIndex(Q_var, getScratchContext());
+                const int Q_new_idx =
+                    var_db->mapVariableAndContextToIndex(Q_var, getNewContext());
+                Pointer<PoissonSolver> Q_helmholtz_solver = d_helmholtz_solvers[group[m]];
+                Q_helmholtz_solver->solveSystem(*d_sol_vecs[group[m]], *d_rhs_vecs[group[m]]);
+                const double Q_norm = d_hier_cc_data_ops->maxNorm(Q_scratch_idx);
+                d_hier_cc_data_ops->subtract(Q_scratch_idx, Q_scratch_idx, Q_new_idx);
+                const double Q_diff_norm = d_hier_cc_data_ops->maxNorm(Q_scratch_idx);
+                d_hier_cc_data_ops->copyData(Q_scratch_idx, Q_new_idx);
+                const double rel_diff =
+                    Q_diff_norm / std::max(Q_norm, std::numeric_limits<double>::epsilon());
+                if (d_enable_logging)
+                    plog << d_object_name << "::integrateHierarchy(): variable "
+                         << Q_var->getName()
+                         << ": relative difference between grouped and separate solves = "
+                         << rel_diff << "\n";
+                if (rel_diff > std::sqrt(Q_helmholtz_solver->getRelativeTolerance()))
+                {
+                    TBOX_ERROR(d_object_name
+                               << "::integrateHierarchy():\n"
+                               << "  grouped and separate Helmholtz solves for variable "
+                               << Q_var->getName() << " differ\n"
+                               << "  relative max-norm difference = " << rel_diff
+                               << std::endl);
+                }
+            }
+        }
+    }
+
+    // Reset the right-hand side vectors.
+    l = 0;
+    for (std::vector<Pointer<CellVariable<NDIM, double> > >::const_iterator
+             cit = d_Q_var.begin();
+         cit != d_Q_var.end();
+         ++cit, ++l)
+    {
+        Pointer<CellVariable<NDIM, double> > Q_var = *cit;
+        Pointer<CellVariable<NDIM, double> > F_var = d_Q_F_map[Q_var];
+        Pointer<CellVariable<NDIM, double> > Q_rhs_var = d_Q_Q_rhs_map[Q_var];
+        Pointer<FaceVariable<NDIM, double> > u_var = d_Q_u_map[Q_var];
+        Pointer<CellVariable<NDIM, double> > N_var = d_Q_N_map[Q_var];
+        const TimeSteppingType convective_time_stepping_type =
+            convective_time_stepping_types[l];
+
+        const int F_scratch_idx =
+            d_F_fcn[F_var] ? var_db->mapVariableAndContextToIndex(F_var, getScratchContext()) :
+                             -1;
+        const int F_new_idx =
+            d_F_fcn[F_var] ? var_db->mapVariableAndContextToIndex(F_var, getNewContext()) : -1;
+        const int Q_rhs_scratch_idx =
+            var_db->mapVariableAndContextToIndex(Q_rhs_var, getScratchContext());
+
         if (u_var)
         {
             const int N_scratch_idx =
@@ -1020,6 +1324,35 @@ void AdvDiffSemiImplicitHierarchyIntegrator::resetHierarchyConfigurationSpeciali
     }
     AdvDiffHierarchyIntegrator::resetHierarchyConfigurationSpecialized(
         base_hierarchy, coarsest_level, finest_level);
+
+    // Reset the solution and rhs vectors for the grouped Helmholtz solves.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    const int wgt_idx = d_hier_math_ops->getCellWeightPatchDescriptorIndex();
+    for (unsigned int g = 0; g < d_helmholtz_groups.size(); ++g)
+    {
+        Pointer<CellVariable<NDIM, double> > Q_group_var = d_helmholtz_group_var[g];
+        const std::string& name = Q_group_var->getName();
+        const int Q_group_scratch_idx =
+            var_db->mapVariableAndContextToIndex(Q_group_var, getScratchContext());
+        d_helmholtz_group_sol_vecs[g] = new SAMRAIVectorReal<NDIM, double>(
+            d_object_name + "::sol_vec::" + name, d_hierarchy, 0, finest_hier_level);
+        d_helmholtz_group_sol_vecs[g]->addComponent(
+            Q_group_var, Q_group_scratch_idx, wgt_idx, d_hier_cc_data_ops);
+
+        Pointer<CellVariable<NDIM, double> > Q_rhs_group_var = d_helmholtz_group_rhs_var[g];
+        const int Q_rhs_group_scratch_idx =
+            var_db->mapVariableAndContextToIndex(Q_rhs_group_var, getScratchContext());
+        d_helmholtz_group_rhs_vecs[g] = new SAMRAIVectorReal<NDIM, double>(
+            d_object_name + "::rhs_vec::" + name, d_hierarchy, 0, finest_hier_level);
+        d_helmholtz_group_rhs_vecs[g]->addComponent(
+            Q_rhs_group_var, Q_rhs_group_scratch_idx, wgt_idx, d_hier_cc_data_ops);
+    }
+    std::fill(d_helmholtz_group_solvers_need_init.begin(),
+              d_helmholtz_group_solvers_need_init.end(),
+              true);
+    std::fill(d_helmholtz_group_rhs_ops_need_init.begin(),
+              d_helmholtz_group_rhs_ops_need_init.end(),
+              true);
     return;
 } // resetHierarchyConfigurationSpecialized
 
@@ -1085,6 +1418,11 @@ void AdvDiffSemiImplicitHierarchyIntegrator::getFromInput(Pointer<Database> db,
         else if (db->keyExists("default_convective_op_db"))
             d_default_convective_op_input_db = db->getDatabase("default_convective_op_db");
     }
+
+    if (db->keyExists("group_helmholtz_solves"))
+        d_group_helmholtz_solves = db->getBool("group_helmholtz_solves");
+    if (db->keyExists("verify_grouped_helmholtz_solves"))
+        d_verify_grouped_helmholtz_solves = db->getBool("verify_grouped_helmholtz_solves");
     return;
 } // getFromInput
 
@@ -1109,6 +1447,109 @@ void AdvDiffSemiImplicitHierarchyIntegrator::getFromRestart()
     return;
 } // getFromRestart
 
+void AdvDiffSemiImplicitHierarchyIntegrator::setupHelmholtzGroups()
+{
+    const unsigned int num_Q = d_Q_var.size();
+    d_Q_helmholtz_group.assign(num_Q, -1);
+    d_Q_helmholtz_group_depth_offset.assign(num_Q, 0);
+    d_helmholtz_groups.clear();
+    d_helmholtz_group_var.clear();
+    d_helmholtz_group_rhs_var.clear();
+    d_helmholtz_group_bc_coefs.clear();
+    if (!d_group_helmholtz_solves) return;
+
+    // Quantities with variable diffusion coefficients or with user-supplied
+    // solvers or operators are always solved separately.  All other quantities
+    // are grouped with the first previously encountered quantity that has a
+    // compatible Helmholtz system.
+    std::vector<std::vector<unsigned int> > candidate_groups;
+    for (unsigned int l = 0; l < num_Q; ++l)
+    {
+        const bool user_solver = l < d_helmholtz_solvers.size() && d_helmholtz_solvers[l];
+        const bool user_rhs_op = l < d_helmholtz_rhs_ops.size() && d_helmholtz_rhs_ops[l];
+        if (user_solver || user_rhs_op || isDiffusionCoefficientVariable(d_Q_var[l])) continue;
+        bool grouped = false;
+        for (unsigned int k = 0; k < candidate_groups.size() && !grouped; ++k)
+        {
+            if (haveCompatibleHelmholtzSystems(candidate_groups[k].front(), l))
+            {
+                candidate_groups[k].push_back(l);
+                grouped = true;
+            }
+        }
+        if (!grouped) candidate_groups.push_back(std::vector<unsigned int>(1, l));
+    }
+
+    // Register stacked solution and right-hand side variables for each group
+    // with more than one member.
+    const IntVector<NDIM> cell_ghosts = CELLG;
+    for (unsigned int k = 0; k < candidate_groups.size(); ++k)
+    {
+        const std::vector<unsigned int>& group = candidate_groups[k];
+        if (group.size() < 2) continue;
+        const int group_num = d_helmholtz_groups.size();
+        int depth = 0;
+        std::vector<RobinBcCoefStrategy<NDIM>*> bc_coefs;
+        for (unsigned int m = 0; m < group.size(); ++m)
+        {
+            Pointer<CellVariable<NDIM, double> > Q_var = d_Q_var[group[m]];
+            Pointer<CellDataFactory<NDIM, double> > Q_factory = Q_var->getPatchDataFactory();
+            d_Q_helmholtz_group[group[m]] = group_num;
+            d_Q_helmholtz_group_depth_offset[group[m]] = depth;
+            depth += Q_factory->getDefaultDepth();
+            const std::vector<RobinBcCoefStrategy<NDIM>*>& Q_bc_coef = d_Q_bc_coef[Q_var];
+            bc_coefs.insert(bc_coefs.end(), Q_bc_coef.begin(), Q_bc_coef.end());
+        }
+        d_helmholtz_groups.push_back(group);
+        d_helmholtz_group_bc_coefs.push_back(bc_coefs);
+
+        std::ostringstream name_stream;
+        name_stream << d_object_name << "::helmholtz_group_" << group_num;
+        const std::string name = name_stream.str();
+        Pointer<CellVariable<NDIM, double> > Q_group_var =
+            new CellVariable<NDIM, double>(name + "::Q", depth);
+        d_helmholtz_group_var.push_back(Q_group_var);
+        int Q_group_scratch_idx;
+        registerVariable(Q_group_scratch_idx, Q_group_var, cell_ghosts, getScratchContext());
+        Pointer<CellVariable<NDIM, double> > Q_rhs_group_var =
+            new CellVariable<NDIM, double>(name + "::Q_rhs", depth);
+        d_helmholtz_group_rhs_var.push_back(Q_rhs_group_var);
+        int Q_rhs_group_scratch_idx;
+        registerVariable(
+            Q_rhs_group_scratch_idx, Q_rhs_group_var, cell_ghosts, getScratchContext());
+
+        if (d_enable_logging)
+        {
+            plog << d_object_name << ": "
+                 << "Helmholtz group " << group_num << " contains variables";
+            for (unsigned int m = 0; m < group.size(); ++m)
+            {
+                plog << " " << d_Q_var[group[m]]->getName();
+            }
+            plog << "\n";
+        }
+    }
+    return;
+} // setupHelmholtzGroups
+
+bool
+AdvDiffSemiImplicitHierarchyIntegrator::haveCompatibleHelmholtzSystems(const unsigned int l,
+                                                                       const unsigned int m)
+{
+    Pointer<CellVariable<NDIM, double> > Q_l_var = d_Q_var[l];
+    Pointer<CellVariable<NDIM, double> > Q_m_var = d_Q_var[m];
+    if (isDiffusionCoefficientVariable(Q_l_var) || isDiffusionCoefficientVariable(Q_m_var))
+    {
+        return false;
+    }
+    return d_Q_diffusion_time_stepping_type[Q_l_var] ==
+               d_Q_diffusion_time_stepping_type[Q_m_var] &&
+           MathUtilities<double>::equalEps(d_Q_diffusion_coef[Q_l_var],
+                                           d_Q_diffusion_coef[Q_m_var]) &&
+           MathUtilities<double>::equalEps(d_Q_damping_coef[Q_l_var],
+                                           d_Q_damping_coef[Q_m_var]);
+} // haveCompatibleHelmholtzSystems
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBAMR
@@ -38,6 +38,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "HierarchyFaceDataOpsReal.h"
 #include "IntVector.h"
@@ -52,6 +53,11 @@ namespace IBAMR
 {
 class ConvectiveOperator;
 } // namespace IBAMR
+namespace IBTK
+{
+class LaplaceOperator;
+class PoissonSolver;
+} // namespace IBTK
 namespace SAMRAI
 {
 namespace hier
@@ -71,6 +77,13 @@ namespace pdat
 template <int DIM, class TYPE>
 class CellVariable;
 } // namespace pdat
+namespace solv
+{
+template <int DIM>
+class RobinBcCoefStrategy;
+template <int DIM, class TYPE>
+class SAMRAIVectorReal;
+} // namespace solv
 } // namespace SAMRAI
 
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
@@ -94,6 +107,22 @@ namespace IBAMR
  *
  * Various options are available for the spatial and temporal discretizations.
  *
+ * When the input key <TT>group_helmholtz_solves</TT> is set to <TT>TRUE</TT>,
+ * quantities that use the same diffusion time stepping type, the same constant
+ * diffusion coefficient, and the same damping coefficient, and for which no
+ * Helmholtz solver or RHS operator has been supplied by the user, are advanced
+ * by a single Helmholtz solve whose data depth is the sum of the depths of the
+ * grouped quantities.  The boundary condition specifications of the grouped
+ * quantities are concatenated, so their boundary conditions need not agree.
+ * Because the grouped systems are solved together, the forcing terms of all
+ * quantities in a group are evaluated before any of those quantities is
+ * updated.  When the input key <TT>verify_grouped_helmholtz_solves</TT> is also
+ * set to <TT>TRUE</TT>, each grouped quantity is additionally solved for
+ * separately, and an error is raised if the relative max-norm difference of
+ * the two solutions exceeds the square root of the relative tolerance of the
+ * Helmholtz solver.  This doubles the cost of the grouped solves and is
+ * intended for testing.
+ *
  * \see HierarchyIntegrator
  * \see SAMRAI::mesh::StandardTagAndInitStrategy
  * \see SAMRAI::algs::TimeRefinementIntegrator
@@ -361,6 +390,27 @@ protected:
     std::map<SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> >, bool>
     d_Q_convective_op_needs_init;
 
+    /*!
+     * Data used to solve the Helmholtz systems for compatible transported
+     * quantities simultaneously.
+     *
+     * d_Q_helmholtz_group[l] is the group number of quantity l, or -1 if
+     * quantity l is solved separately, and d_Q_helmholtz_group_depth_offset[l]
+     * is the first depth of the group data occupied by quantity l.
+     */
+    bool d_group_helmholtz_solves, d_verify_grouped_helmholtz_solves;
+    std::vector<int> d_Q_helmholtz_group, d_Q_helmholtz_group_depth_offset;
+    std::vector<std::vector<unsigned int> > d_helmholtz_groups;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > >
+        d_helmholtz_group_var, d_helmholtz_group_rhs_var;
+    std::vector<std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*> >
+        d_helmholtz_group_bc_coefs;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > >
+        d_helmholtz_group_sol_vecs, d_helmholtz_group_rhs_vecs;
+    std::vector<SAMRAI::tbox::Pointer<IBTK::PoissonSolver> > d_helmholtz_group_solvers;
+    std::vector<SAMRAI::tbox::Pointer<IBTK::LaplaceOperator> > d_helmholtz_group_rhs_ops;
+    std::vector<bool> d_helmholtz_group_solvers_need_init, d_helmholtz_group_rhs_ops_need_init;
+
 private:
     /*!
      * \brief Default constructor.
@@ -401,6 +451,18 @@ private:
      * by the object_name specified in the class constructor.
      */
     void getFromRestart();
+
+    /*!
+     * Determine which transported quantities can share a single Helmholtz
+     * solve, and register the data required by the grouped solves.
+     */
+    void setupHelmholtzGroups();
+
+    /*!
+     * Determine whether the Helmholtz systems for quantities l and m use the
+     * same time stepping type and the same constant problem coefficients.
+     */
+    bool haveCompatibleHelmholtzSystems(unsigned int l, unsigned int m);
 };
 } // namespace IBAMR
 
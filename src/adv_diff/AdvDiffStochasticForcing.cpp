@@ -73,21 +73,6 @@ namespace IBAMR
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
-namespace
-{
-void genrandn(ArrayData<NDIM, double>& data, const Box<NDIM>& box)
-{
-    for (int depth = 0; depth < data.getDepth(); ++depth)
-    {
-        for (Box<NDIM>::Iterator i(box); i; i++)
-        {
-            RNG::genrandn(&data(i(), depth));
-        }
-    }
-    return;
-} // genrandn
-}
-
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 AdvDiffStochasticForcing::AdvDiffStochasticForcing(
@@ -97,7 +82,7 @@ AdvDiffStochasticForcing::AdvDiffStochasticForcing(
     const AdvDiffSemiImplicitHierarchyIntegrator* const adv_diff_solver)
     : d_object_name(object_name), d_C_var(C_var), d_f_parser(),
       d_adv_diff_solver(adv_diff_solver), d_std(std::numeric_limits<double>::quiet_NaN()),
-      d_num_rand_vals(0), d_weights(), d_dirichlet_bc_scaling(sqrt(2.0)),
+      d_num_rand_vals(0), d_weights(), d_rng_stream(0), d_dirichlet_bc_scaling(sqrt(2.0)),
       d_neumann_bc_scaling(0.0), d_context(NULL), d_C_cc_var(NULL), d_C_current_cc_idx(-1),
       d_C_half_cc_idx(-1), d_C_new_cc_idx(-1), d_F_sc_var(NULL), d_F_sc_idx(-1), d_F_sc_idxs()
 {
@@ -129,6 +114,9 @@ AdvDiffStochasticForcing::AdvDiffStochasticForcing(
     }
     d_f_parser.SetExpr(f_expression);
 
+    // Reserve random number streams for each component of each random flux.
+    d_rng_stream = RNG::allocateStreams(NDIM * d_num_rand_vals);
+
     // Determine the number of components that need to be allocated.
     Pointer<CellDataFactory<NDIM, double> > C_factory = d_C_var->getPatchDataFactory();
     const int C_depth = C_factory->getDefaultDepth();
@@ -265,8 +253,10 @@ AdvDiffStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
         // Generate random components.
         if (cycle_num == 0)
         {
+            const unsigned int step = d_adv_diff_solver->getIntegratorStep();
             for (int k = 0; k < d_num_rand_vals; ++k)
             {
+                const unsigned int stream = d_rng_stream + NDIM * k;
                 for (int level_num = coarsest_ln; level_num <= finest_ln; ++level_num)
                 {
                     Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_num);
@@ -277,8 +267,12 @@ AdvDiffStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
                             patch->getPatchData(d_F_sc_idxs[k]);
                         for (int d = 0; d < NDIM; ++d)
                         {
-                            genrandn(F_sc_data->getArrayData(d),
-                                     SideGeometry<NDIM>::toSideBox(F_sc_data->getBox(), d));
+                            RNG::genrandn(
+                                F_sc_data->getArrayData(d),
+                                SideGeometry<NDIM>::toSideBox(F_sc_data->getBox(), d),
+                                stream + d,
+                                step,
+                                level_num);
                         }
                     }
                 }
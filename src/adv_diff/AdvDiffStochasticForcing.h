@@ -191,6 +191,12 @@ private:
     int d_num_rand_vals;
     std::vector<SAMRAI::tbox::Array<double> > d_weights;
 
+    /*!
+     * First stream identifier used with the counter-based random number
+     * generator.
+     */
+    unsigned int d_rng_stream;
+
     /*!
      * Boundary condition scalings.
      */
@@ -0,0 +1,692 @@
+// Filename: AdvectorExplicitPredictorKernels.cpp
+// Created on 19 Oct 2026 by Boyce Griffith
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of New York University nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <stddef.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "AdvectorExplicitPredictorKernels.h"
+#include "ArrayData.h"
+#include "Box.h"
+#include "CartesianPatchGeometry.h"
+#include "CellData.h"
+#include "FaceData.h"
+#include "FaceGeometry.h"
+#include "IBAMR_config.h"
+#include "IntVector.h"
+#include "Patch.h"
+#include "ibamr/namespaces.h" // IWYU pragma: keep
+#include "ibtk/PatchScratchPool.h"
+#include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBAMR
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Constants used by the Fortran predictors (see src/fortran/const.i).
+static const double HALF = 0.5;
+static const double SIXTH = 0.16666666666667;
+static const double TWOTHIRD = 0.66666666666667;
+
+// Tolerance used to determine the upwind direction.
+static const double SIGN_EPS = 1.0e-8;
+
+inline int box_lower(const Box<NDIM>& box, const unsigned int d)
+{
+    return d < NDIM ? box.lower(d) : 0;
+} // box_lower
+
+inline int box_upper(const Box<NDIM>& box, const unsigned int d)
+{
+    return d < NDIM ? box.upper(d) : 0;
+} // box_upper
+
+// Return the box whose k-th coordinate direction is coordinate direction
+// (axis+k)%NDIM of the specified box, i.e., the index space used by SAMRAI to
+// store face-centered data with normal direction axis.
+inline Box<NDIM> permute_box(const Box<NDIM>& box, const unsigned int axis)
+{
+    Box<NDIM> permuted_box;
+    for (unsigned int k = 0; k < NDIM; ++k)
+    {
+        permuted_box.lower(k) = box.lower((axis + k) % NDIM);
+        permuted_box.upper(k) = box.upper((axis + k) % NDIM);
+    }
+    return permuted_box;
+} // permute_box
+
+/*
+ * A lightweight view of a single depth of column-major patch data.  In 2D, the
+ * third index is ignored.
+ */
+template <class T>
+struct PatchArray
+{
+    PatchArray(T* const data, const Box<NDIM>& box) : ptr(data)
+    {
+        for (unsigned int d = 0; d < 3; ++d) lower[d] = box_lower(box, d);
+        stride[0] = 1;
+        stride[1] = box.numberCells(0);
+        stride[2] = NDIM > 2 ? stride[1] * box.numberCells(1) : 0;
+        return;
+    } // PatchArray
+
+    inline T* at(const int i0, const int i1, const int i2 = 0) const
+    {
+        return ptr + (i0 - lower[0]) + (i1 - lower[1]) * stride[1] +
+               (i2 - lower[2]) * stride[2];
+    } // at
+
+    T* ptr;
+    int lower[3];
+    int stride[3];
+};
+
+inline double sign_eps(const double x)
+{
+    return (x > SIGN_EPS ? 1.0 : 0.0) - (x < -SIGN_EPS ? 1.0 : 0.0);
+} // sign_eps
+
+inline double minmod(const double a, const double b)
+{
+    const double sa = a >= 0.0 ? 0.5 : -0.5;
+    const double sb = b >= 0.0 ? 0.5 : -0.5;
+    return 0.5 * (sa + sb) * (std::abs(a + b) - std::abs(a - b));
+} // minmod
+
+inline double minmod3(const double a, const double b, const double c)
+{
+    if (a >= 0.0 && b >= 0.0 && c >= 0.0) return std::min(a, std::min(b, c));
+    if (a <= 0.0 && b <= 0.0 && c <= 0.0) return std::max(a, std::max(b, c));
+    return 0.0;
+} // minmod3
+
+inline double maxmod2(const double a, const double b)
+{
+    if (a >= 0.0 && b >= 0.0) return std::max(a, b);
+    if (a <= 0.0 && b <= 0.0) return std::min(a, b);
+    return 0.0;
+} // maxmod2
+
+// The MUSCL limited fourth-order centered difference (see muscldiff in
+// fortran/advect_helpers.f.m4).  Q points to the center of the stencil.
+inline double muscldiff(const double* const Q)
+{
+    if ((Q[1] - Q[0]) * (Q[0] - Q[-1]) <= 0.0) return 0.0;
+
+    double dQf_left = 0.0;
+    if ((Q[0] - Q[-1]) * (Q[-1] - Q[-2]) > 0.0)
+    {
+        const double dQ_lim = 2.0 * std::min(std::abs(Q[0] - Q[-1]), std::abs(Q[-1] - Q[-2]));
+        dQf_left = std::min(0.5 * std::abs(Q[0] - Q[-2]), dQ_lim);
+        if (Q[0] - Q[-2] < 0.0) dQf_left = -dQf_left;
+    }
+    double dQf_rght = 0.0;
+    if ((Q[2] - Q[1]) * (Q[1] - Q[0]) > 0.0)
+    {
+        const double dQ_lim = 2.0 * std::min(std::abs(Q[2] - Q[1]), std::abs(Q[1] - Q[0]));
+        dQf_rght = std::min(0.5 * std::abs(Q[2] - Q[0]), dQ_lim);
+        if (Q[2] - Q[0] < 0.0) dQf_rght = -dQf_rght;
+    }
+    const double dQ_lim = 2.0 * std::min(std::abs(Q[1] - Q[0]), std::abs(Q[0] - Q[-1]));
+    const double dQ = std::min(
+        TWOTHIRD * std::abs(Q[1] - 0.25 * dQf_rght - Q[-1] - 0.25 * dQf_left), dQ_lim);
+    return Q[1] - Q[-1] < 0.0 ? -dQ : dQ;
+} // muscldiff
+
+/*
+ * Limited slopes, selected at compile time.  Q points to the cell at which the
+ * slope is to be computed; the data are assumed to be stored contiguously in
+ * the normal direction.
+ */
+template <LimiterType limiter>
+inline double limited_slope(const double* Q);
+
+template <>
+inline double limited_slope<CTU_ONLY>(const double* const /*Q*/)
+{
+    return 0.0;
+} // limited_slope<CTU_ONLY>
+
+template <>
+inline double limited_slope<SECOND_ORDER>(const double* const Q)
+{
+    return HALF * (Q[1] - Q[-1]);
+} // limited_slope<SECOND_ORDER>
+
+template <>
+inline double limited_slope<FOURTH_ORDER>(const double* const Q)
+{
+    return TWOTHIRD * (Q[1] - Q[-1]) - SIXTH * HALF * (Q[2] - Q[-2]);
+} // limited_slope<FOURTH_ORDER>
+
+template <>
+inline double limited_slope<MINMOD_LIMITED>(const double* const Q)
+{
+    return minmod(Q[0] - Q[-1], Q[1] - Q[0]);
+} // limited_slope<MINMOD_LIMITED>
+
+template <>
+inline double limited_slope<MC_LIMITED>(const double* const Q)
+{
+    return minmod3(0.5 * (Q[1] - Q[-1]), 2.0 * (Q[0] - Q[-1]), 2.0 * (Q[1] - Q[0]));
+} // limited_slope<MC_LIMITED>
+
+template <>
+inline double limited_slope<SUPERBEE_LIMITED>(const double* const Q)
+{
+    return maxmod2(minmod(2.0 * (Q[0] - Q[-1]), Q[1] - Q[0]),
+                   minmod(Q[0] - Q[-1], 2.0 * (Q[1] - Q[0])));
+} // limited_slope<SUPERBEE_LIMITED>
+
+template <>
+inline double limited_slope<MUSCL_LIMITED>(const double* const Q)
+{
+    return muscldiff(Q);
+} // limited_slope<MUSCL_LIMITED>
+
+/*
+ * Predict face-centered values in the normal direction, neglecting transverse
+ * derivatives (see advect_predictnormal2d and advect_predict_normal3d).  All
+ * arrays are indexed in the permuted index space associated with the normal
+ * direction, as is box.
+ *
+ * Each pencil is processed in two passes: the first computes the left and
+ * right extrapolated states in each cell, and the second selects the upwind
+ * state on each face.  Neither pass carries a loop dependency.
+ */
+template <LimiterType limiter, bool with_source>
+void predict_normal(const PatchArray<double>& qtemp,
+                    const PatchArray<const double>& u,
+                    const PatchArray<const double>& Q,
+                    const PatchArray<const double>& F,
+                    const Box<NDIM>& box,
+                    const double dx0,
+                    const double dt,
+                    double* const qL,
+                    double* const qR)
+{
+    const int lo0 = box.lower(0);
+    const int num_cells = box.upper(0) - lo0 + 3;
+    const int t2_lower = NDIM > 2 ? box_lower(box, 2) - 1 : 0;
+    const int t2_upper = NDIM > 2 ? box_upper(box, 2) + 1 : 0;
+    for (int t2 = t2_lower; t2 <= t2_upper; ++t2)
+    {
+        for (int t1 = box.lower(1) - 1; t1 <= box.upper(1) + 1; ++t1)
+        {
+            const double* const Q_row = Q.at(lo0 - 1, t1, t2);
+            const double* const F_row = with_source ? F.at(lo0 - 1, t1, t2) : NULL;
+            const double* const u_row = u.at(lo0 - 1, t1, t2);
+            for (int k = 0; k < num_cells; ++k)
+            {
+                const double Qx = limited_slope<limiter>(Q_row + k);
+                const double unorm = 0.5 * (u_row[k] + u_row[k + 1]);
+                qL[k] = Q_row[k] + 0.5 * (1.0 - unorm * dt / dx0) * Qx;
+                qR[k] = Q_row[k] - 0.5 * (1.0 + unorm * dt / dx0) * Qx;
+                if (with_source)
+                {
+                    qL[k] += 0.5 * dt * F_row[k];
+                    qR[k] += 0.5 * dt * F_row[k];
+                }
+            }
+            double* const qtemp_row = qtemp.at(lo0, t1, t2);
+            for (int k = 0; k < num_cells - 1; ++k)
+            {
+                qtemp_row[k] = 0.5 * (qL[k] + qR[k + 1]) +
+                               sign_eps(u_row[k + 1]) * 0.5 * (qL[k] - qR[k + 1]);
+            }
+        }
+    }
+    return;
+} // predict_normal
+
+template <LimiterType limiter>
+inline void predict_normal(const bool with_source,
+                           const PatchArray<double>& qtemp,
+                           const PatchArray<const double>& u,
+                           const PatchArray<const double>& Q,
+                           const PatchArray<const double>& F,
+                           const Box<NDIM>& box,
+                           const double dx0,
+                           const double dt,
+                           double* const qL,
+                           double* const qR)
+{
+    if (with_source)
+    {
+        predict_normal<limiter, true>(qtemp, u, Q, F, box, dx0, dt, qL, qR);
+    }
+    else
+    {
+        predict_normal<limiter, false>(qtemp, u, Q, F, box, dx0, dt, qL, qR);
+    }
+    return;
+} // predict_normal
+
+void predict_normal(const LimiterType limiter_type,
+                    const bool with_source,
+                    const PatchArray<double>& qtemp,
+                    const PatchArray<const double>& u,
+                    const PatchArray<const double>& Q,
+                    const PatchArray<const double>& F,
+                    const Box<NDIM>& box,
+                    const double dx0,
+                    const double dt,
+                    double* const qL,
+                    double* const qR)
+{
+    switch (limiter_type)
+    {
+    case CTU_ONLY:
+        predict_normal<CTU_ONLY>(with_source, qtemp, u, Q, F, box, dx0, dt, qL, qR);
+        break;
+    case MINMOD_LIMITED:
+        predict_normal<MINMOD_LIMITED>(with_source, qtemp, u, Q, F, box, dx0, dt, qL, qR);
+        break;
+    case MC_LIMITED:
+        predict_normal<MC_LIMITED>(with_source, qtemp, u, Q, F, box, dx0, dt, qL, qR);
+        break;
+    case SUPERBEE_LIMITED:
+        predict_normal<SUPERBEE_LIMITED>(with_source, qtemp, u, Q, F, box, dx0, dt, qL, qR);
+        break;
+    case MUSCL_LIMITED:
+        predict_normal<MUSCL_LIMITED>(with_source, qtemp, u, Q, F, box, dx0, dt, qL, qR);
+        break;
+    case SECOND_ORDER:
+        predict_normal<SECOND_ORDER>(with_source, qtemp, u, Q, F, box, dx0, dt, qL, qR);
+        break;
+    case FOURTH_ORDER:
+        predict_normal<FOURTH_ORDER>(with_source, qtemp, u, Q, F, box, dx0, dt, qL, qR);
+        break;
+    default:
+        TBOX_ERROR("AdvectorExplicitPredictorKernels::predict():\n"
+                   << "  unsupported limiter type: "
+                   << enum_to_string<LimiterType>(limiter_type)
+                   << "\n");
+    }
+    return;
+} // predict_normal
+
+/*
+ * Add transverse corrections computed from centered differences of the
+ * temporary predicted values (see advect_transverse_fix2d,
+ * advect_transverse_fix3d, and advect_transverse_ctu_fix3d).  Here, u0 and
+ * qtemp0 are associated with the normal direction, u1 and qtemp1 with the next
+ * coordinate direction, and (in 3D) u2 and qtemp2 with the one after that.
+ */
+#if (NDIM == 2)
+void transverse_fix(const PatchArray<double>& qhalf,
+                    const PatchArray<const double>& u0,
+                    const PatchArray<const double>& u1,
+                    const PatchArray<const double>& qtemp0,
+                    const PatchArray<const double>& qtemp1,
+                    const Box<NDIM>& box,
+                    const double dx1,
+                    const double dt,
+                    double* const corr)
+{
+    const int lo0 = box.lower(0);
+    const int num_cells = box.upper(0) - lo0 + 3;
+    for (int t1 = box.lower(1); t1 <= box.upper(1); ++t1)
+    {
+        const double* const v = u1.at(t1, lo0 - 1);
+        const double* const qy = qtemp1.at(t1, lo0 - 1);
+        const int vs = u1.stride[1], qys = qtemp1.stride[1];
+        for (int k = 0; k < num_cells; ++k)
+        {
+            const double vtan = 0.5 * (v[k * vs] + v[k * vs + 1]);
+            const double Qy = qy[k * qys + 1] - qy[k * qys];
+            corr[k] = -0.5 * dt * vtan * Qy / dx1;
+        }
+        const double* const u_row = u0.at(lo0 - 1, t1);
+        const double* const qtemp_row = qtemp0.at(lo0, t1);
+        double* const qhalf_row = qhalf.at(lo0, t1);
+        for (int k = 0; k < num_cells - 1; ++k)
+        {
+            qhalf_row[k] = qtemp_row[k] + 0.5 * (corr[k] + corr[k + 1]) +
+                           sign_eps(u_row[k + 1]) * 0.5 * (corr[k] - corr[k + 1]);
+        }
+    }
+    return;
+} // transverse_fix
+#endif
+#if (NDIM == 3)
+template <bool using_full_ctu>
+void transverse_fix(const PatchArray<double>& qhalf,
+                    const PatchArray<const double>& u0,
+                    const PatchArray<const double>& u1,
+                    const PatchArray<const double>& u2,
+                    const PatchArray<const double>& qtemp0,
+                    const PatchArray<const double>& qtemp1,
+                    const PatchArray<const double>& qtemp2,
+                    const Box<NDIM>& box,
+                    const double dx1,
+                    const double dx2,
+                    const double dt,
+                    double* const corr)
+{
+    const int lo0 = box.lower(0);
+    const int num_cells = box.upper(0) - lo0 + 3;
+    const int vs = u1.stride[2], qys = qtemp1.stride[2];
+    const int ws = u2.stride[1], qzs = qtemp2.stride[1];
+    for (int t2 = box.lower(2); t2 <= box.upper(2); ++t2)
+    {
+        for (int t1 = box.lower(1); t1 <= box.upper(1); ++t1)
+        {
+            const double* const v = u1.at(t1, t2, lo0 - 1);
+            const double* const w = u2.at(t2, lo0 - 1, t1);
+            const double* const qy = qtemp1.at(t1, t2, lo0 - 1);
+            const double* const qz = qtemp2.at(t2, lo0 - 1, t1);
+            for (int k = 0; k < num_cells; ++k)
+            {
+                const double vtan = 0.5 * (v[k * vs] + v[k * vs + 1]);
+                const double wtan = 0.5 * (w[k * ws] + w[k * ws + 1]);
+                const double Qy = qy[k * qys + 1] - qy[k * qys];
+                const double Qz = qz[k * qzs + 1] - qz[k * qzs];
+                corr[k] = -0.5 * dt * vtan * Qy / dx1 - 0.5 * dt * wtan * Qz / dx2;
+            }
+            if (using_full_ctu)
+            {
+                // Include the corner transport upwinding terms, in which the
+                // transverse differences are evaluated in the upwind
+                // neighboring pencils.
+                const double* const v_m = u1.at(t1, t2 - 1, lo0 - 1);
+                const double* const v_p = u1.at(t1, t2 + 1, lo0 - 1);
+                const double* const w_m = u2.at(t2, lo0 - 1, t1 - 1);
+                const double* const w_p = u2.at(t2, lo0 - 1, t1 + 1);
+                const double* const qy_m = qtemp1.at(t1, t2 - 1, lo0 - 1);
+                const double* const qy_p = qtemp1.at(t1, t2 + 1, lo0 - 1);
+                const double* const qz_m = qtemp2.at(t2, lo0 - 1, t1 - 1);
+                const double* const qz_p = qtemp2.at(t2, lo0 - 1, t1 + 1);
+                for (int k = 0; k < num_cells; ++k)
+                {
+                    const double vtan = 0.5 * (v[k * vs] + v[k * vs + 1]);
+                    const double wtan = 0.5 * (w[k * ws] + w[k * ws + 1]);
+                    const double Qy = qy[k * qys + 1] - qy[k * qys];
+                    const double Qz = qz[k * qzs + 1] - qz[k * qzs];
+
+                    const double* const w_up = vtan > 0.0 ? w_m : w_p;
+                    const double* const qz_up = vtan > 0.0 ? qz_m : qz_p;
+                    const double wtan_up = 0.5 * (w_up[k * ws] + w_up[k * ws + 1]);
+                    const double Qz_up = qz_up[k * qzs + 1] - qz_up[k * qzs];
+                    const double vDywQz = vtan > 0.0 ? vtan * (wtan * Qz - wtan_up * Qz_up) :
+                                                       vtan * (wtan_up * Qz_up - wtan * Qz);
+
+                    const double* const v_up = wtan > 0.0 ? v_m : v_p;
+                    const double* const qy_up = wtan > 0.0 ? qy_m : qy_p;
+                    const double vtan_up = 0.5 * (v_up[k * vs] + v_up[k * vs + 1]);
+                    const double Qy_up = qy_up[k * qys + 1] - qy_up[k * qys];
+                    const double wDzvQy = wtan > 0.0 ? wtan * (vtan * Qy - vtan_up * Qy_up) :
+                                                       wtan * (vtan_up * Qy_up - vtan * Qy);
+
+                    corr[k] += SIXTH * (dt * dt) * (wDzvQy + vDywQz) / (dx1 * dx2);
+                }
+            }
+            const double* const u_row = u0.at(lo0 - 1, t1, t2);
+            const double* const qtemp_row = qtemp0.at(lo0, t1, t2);
+            double* const qhalf_row = qhalf.at(lo0, t1, t2);
+            for (int k = 0; k < num_cells - 1; ++k)
+            {
+                qhalf_row[k] = qtemp_row[k] + 0.5 * (corr[k] + corr[k + 1]) +
+                               sign_eps(u_row[k + 1]) * 0.5 * (corr[k] - corr[k + 1]);
+            }
+        }
+    }
+    return;
+} // transverse_fix
+#endif
+
+// Copy cell-centered data into the permuted index space associated with the
+// specified axis.
+void copy_permuted(const PatchArray<double>& dst,
+                   const PatchArray<const double>& src,
+                   const Box<NDIM>& src_box,
+                   const unsigned int axis)
+{
+    int i[3], p[3] = { 0, 0, 0 };
+    for (i[2] = box_lower(src_box, 2); i[2] <= box_upper(src_box, 2); ++i[2])
+    {
+        for (i[1] = src_box.lower(1); i[1] <= src_box.upper(1); ++i[1])
+        {
+            for (i[0] = src_box.lower(0); i[0] <= src_box.upper(0); ++i[0])
+            {
+                for (unsigned int k = 0; k < NDIM; ++k) p[k] = i[(axis + k) % NDIM];
+                *dst.at(p[0], p[1], p[2]) = *src.at(i[0], i[1], i[2]);
+            }
+        }
+    }
+    return;
+} // copy_permuted
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+bool AdvectorExplicitPredictorKernels::isSupported(const LimiterType limiter_type)
+{
+    switch (limiter_type)
+    {
+    case CTU_ONLY:
+    case MINMOD_LIMITED:
+    case MC_LIMITED:
+    case SUPERBEE_LIMITED:
+    case MUSCL_LIMITED:
+    case SECOND_ORDER:
+    case FOURTH_ORDER:
+        return true;
+    default:
+        return false;
+    }
+    return false;
+} // isSupported
+
+void AdvectorExplicitPredictorKernels::predict(FaceData<NDIM, double>& q_half,
+                                               const FaceData<NDIM, double>& u_ADV,
+                                               const CellData<NDIM, double>& Q,
+                                               const CellData<NDIM, double>* const F,
+                                               const int depth,
+                                               const Patch<NDIM>& patch,
+                                               const double dt,
+                                               const LimiterType limiter_type,
+                                               const bool using_full_ctu,
+                                               PatchScratchPool& scratch_pool)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(isSupported(limiter_type));
+    TBOX_ASSERT(0 <= depth && depth < Q.getDepth());
+    TBOX_ASSERT(q_half.getDepth() == Q.getDepth());
+    TBOX_ASSERT(u_ADV.getDepth() == 1);
+    TBOX_ASSERT(!F || F->getDepth() == Q.getDepth());
+#endif
+#if (NDIM == 2)
+    NULL_USE(using_full_ctu);
+#endif
+    const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch.getPatchGeometry();
+    const double* const dx = patch_geom->getDx();
+    const Box<NDIM>& patch_box = patch.getBox();
+    const Box<NDIM>& Q_box = Q.getGhostBox();
+    const Box<NDIM> qtemp_box = Box<NDIM>::grow(patch_box, IntVector<NDIM>(1));
+
+    // Obtain all scratch storage before setting up any views; buffers 0 and 1
+    // are per-pencil, buffers 2 through 2+NDIM-1 hold the temporary predicted
+    // values, and the remaining buffers hold permuted copies of Q and F.
+    const size_t pencil_size = patch_box.numberCells().max() + 3;
+    double* const qL = scratch_pool.getBuffer(0, pencil_size);
+    double* const qR = scratch_pool.getBuffer(1, pencil_size);
+    double* qtemp_ptr[NDIM];
+    double* Q_ptr[NDIM];
+    double* F_ptr[NDIM];
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        const Box<NDIM> qtemp_face_box = FaceGeometry<NDIM>::toFaceBox(qtemp_box, axis);
+        qtemp_ptr[axis] = scratch_pool.getBuffer(2 + axis, qtemp_face_box.size());
+        Q_ptr[axis] = NULL;
+        F_ptr[axis] = NULL;
+    }
+    for (unsigned int axis = 1; axis < NDIM; ++axis)
+    {
+        Q_ptr[axis] = scratch_pool.getBuffer(2 + NDIM + axis - 1, Q_box.size());
+        if (!F) continue;
+        F_ptr[axis] = scratch_pool.getBuffer(2 + 2 * NDIM + axis - 2, F->getGhostBox().size());
+    }
+
+    std::vector<PatchArray<const double> > u, qtemp_in;
+    std::vector<PatchArray<double> > qtemp, qhalf;
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        u.push_back(PatchArray<const double>(u_ADV.getPointer(axis),
+                                             u_ADV.getArrayData(axis).getBox()));
+        qhalf.push_back(PatchArray<double>(q_half.getPointer(axis, depth),
+                                           q_half.getArrayData(axis).getBox()));
+        const Box<NDIM> qtemp_face_box = FaceGeometry<NDIM>::toFaceBox(qtemp_box, axis);
+        qtemp.push_back(PatchArray<double>(qtemp_ptr[axis], qtemp_face_box));
+        qtemp_in.push_back(PatchArray<const double>(qtemp_ptr[axis], qtemp_face_box));
+    }
+
+    // Compute temporary predicted values on the faces normal to each axis,
+    // neglecting transverse derivatives.
+    const PatchArray<const double> Q0(Q.getPointer(depth), Q_box);
+    const PatchArray<const double> F0(F ? F->getPointer(depth) : NULL,
+                                      F ? F->getGhostBox() : Q_box);
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        const Box<NDIM> box = permute_box(patch_box, axis);
+        if (axis == 0)
+        {
+            predict_normal(limiter_type,
+                           F != NULL,
+                           qtemp[axis],
+                           u[axis],
+                           Q0,
+                           F0,
+                           box,
+                           dx[axis],
+                           dt,
+                           qL,
+                           qR);
+            continue;
+        }
+        const Box<NDIM> Q_permuted_box = permute_box(Q_box, axis);
+        copy_permuted(PatchArray<double>(Q_ptr[axis], Q_permuted_box), Q0, Q_box, axis);
+        const PatchArray<const double> Q_permuted(Q_ptr[axis], Q_permuted_box);
+        if (F)
+        {
+            const Box<NDIM> F_permuted_box = permute_box(F->getGhostBox(), axis);
+            copy_permuted(
+                PatchArray<double>(F_ptr[axis], F_permuted_box), F0, F->getGhostBox(), axis);
+            const PatchArray<const double> F_permuted(F_ptr[axis], F_permuted_box);
+            predict_normal(limiter_type,
+                           true,
+                           qtemp[axis],
+                           u[axis],
+                           Q_permuted,
+                           F_permuted,
+                           box,
+                           dx[axis],
+                           dt,
+                           qL,
+                           qR);
+        }
+        else
+        {
+            predict_normal(limiter_type,
+                           false,
+                           qtemp[axis],
+                           u[axis],
+                           Q_permuted,
+                           F0,
+                           box,
+                           dx[axis],
+                           dt,
+                           qL,
+                           qR);
+        }
+    }
+
+    // Compute the final predicted values by including transverse derivatives.
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        const Box<NDIM> box = permute_box(patch_box, axis);
+        const unsigned int b = (axis + 1) % NDIM;
+#if (NDIM == 2)
+        transverse_fix(
+            qhalf[axis], u[axis], u[b], qtemp_in[axis], qtemp_in[b], box, dx[b], dt, qL);
+#endif
+#if (NDIM == 3)
+        const unsigned int c = (axis + 2) % NDIM;
+        if (using_full_ctu)
+        {
+            transverse_fix<true>(qhalf[axis],
+                                 u[axis],
+                                 u[b],
+                                 u[c],
+                                 qtemp_in[axis],
+                                 qtemp_in[b],
+                                 qtemp_in[c],
+                                 box,
+                                 dx[b],
+                                 dx[c],
+                                 dt,
+                                 qL);
+        }
+        else
+        {
+            transverse_fix<false>(qhalf[axis],
+                                  u[axis],
+                                  u[b],
+                                  u[c],
+                                  qtemp_in[axis],
+                                  qtemp_in[b],
+                                  qtemp_in[c],
+                                  box,
+                                  dx[b],
+                                  dx[c],
+                                  dt,
+                                  qL);
+        }
+#endif
+    }
+    return;
+} // predict
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
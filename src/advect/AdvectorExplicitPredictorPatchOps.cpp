@@ -32,19 +32,25 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <ostream>
 
+#include "AdvectorExplicitPredictorKernels.h"
 #include "AdvectorExplicitPredictorPatchOps.h"
 #include "ArrayData.h"
 #include "Box.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
 #include "FaceData.h"
+#include "FaceIndex.h"
+#include "FaceIterator.h"
 #include "IBAMR_config.h"
 #include "Index.h"
 #include "IntVector.h"
 #include "Patch.h"
+#include "boost/array.hpp"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "tbox/Database.h"
 #include "tbox/RestartManager.h"
@@ -511,6 +517,9 @@ static const int FACEG = 1;
 // Version of AdvectorExplicitPredictorPatchOps restart file data
 // TODO: get rid of this ?
 static const int GODUNOV_ADVECTOR_VERSION = 1;
+
+// Relative tolerance used when comparing the C++ and Fortran predictors.
+static const double PREDICTOR_COMPARISON_TOL = 1.0e-12;
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -525,6 +534,8 @@ AdvectorExplicitPredictorPatchOps::AdvectorExplicitPredictorPatchOps(
       ,
       d_using_full_ctu(true)
 #endif
+      ,
+      d_use_cxx_predictor(false), d_compare_predictor_backends(false)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(!object_name.empty());
@@ -944,6 +955,93 @@ void AdvectorExplicitPredictorPatchOps::predict(FaceData<NDIM, double>& q_half,
                                                 const CellData<NDIM, double>& Q,
                                                 const Patch<NDIM>& patch,
                                                 const double dt) const
+{
+    if (!d_use_cxx_predictor || !AdvectorExplicitPredictorKernels::isSupported(d_limiter_type))
+    {
+        predictFortran(q_half, u_ADV, Q, patch, dt);
+        return;
+    }
+    predictCXX(q_half, u_ADV, Q, NULL, patch, dt);
+    if (d_compare_predictor_backends)
+    {
+        FaceData<NDIM, double> q_half_fortran(
+            q_half.getBox(), q_half.getDepth(), q_half.getGhostCellWidth());
+        predictFortran(q_half_fortran, u_ADV, Q, patch, dt);
+        comparePredictorBackends(q_half, q_half_fortran, patch);
+    }
+    return;
+} // predict
+
+void AdvectorExplicitPredictorPatchOps::predictWithSourceTerm(
+    FaceData<NDIM, double>& q_half,
+    const FaceData<NDIM, double>& u_ADV,
+    const CellData<NDIM, double>& Q,
+    const CellData<NDIM, double>& F,
+    const Patch<NDIM>& patch,
+    const double dt) const
+{
+    if (!d_use_cxx_predictor || !AdvectorExplicitPredictorKernels::isSupported(d_limiter_type))
+    {
+        predictWithSourceTermFortran(q_half, u_ADV, Q, F, patch, dt);
+        return;
+    }
+    predictCXX(q_half, u_ADV, Q, &F, patch, dt);
+    if (d_compare_predictor_backends)
+    {
+        FaceData<NDIM, double> q_half_fortran(
+            q_half.getBox(), q_half.getDepth(), q_half.getGhostCellWidth());
+        predictWithSourceTermFortran(q_half_fortran, u_ADV, Q, F, patch, dt);
+        comparePredictorBackends(q_half, q_half_fortran, patch);
+    }
+    return;
+} // predictWithSourceTerm
+
+void AdvectorExplicitPredictorPatchOps::predictCXX(FaceData<NDIM, double>& q_half,
+                                                   const FaceData<NDIM, double>& u_ADV,
+                                                   const CellData<NDIM, double>& Q,
+                                                   const CellData<NDIM, double>* const F,
+                                                   const Patch<NDIM>& patch,
+                                                   const double dt) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(q_half.getDepth() == Q.getDepth());
+    TBOX_ASSERT(q_half.getBox() == patch.getBox());
+
+    TBOX_ASSERT(u_ADV.getDepth() == 1);
+    TBOX_ASSERT(u_ADV.getBox() == patch.getBox());
+
+    TBOX_ASSERT(Q.getBox() == patch.getBox());
+
+    TBOX_ASSERT(!F || F->getDepth() == Q.getDepth());
+    TBOX_ASSERT(!F || F->getBox() == patch.getBox());
+#endif
+#if (NDIM == 2)
+    const bool using_full_ctu = false;
+#endif
+#if (NDIM == 3)
+    const bool using_full_ctu = d_using_full_ctu;
+#endif
+    for (int depth = 0; depth < Q.getDepth(); ++depth)
+    {
+        AdvectorExplicitPredictorKernels::predict(q_half,
+                                                  u_ADV,
+                                                  Q,
+                                                  F,
+                                                  depth,
+                                                  patch,
+                                                  dt,
+                                                  d_limiter_type,
+                                                  using_full_ctu,
+                                                  d_scratch_pool);
+    }
+    return;
+} // predictCXX
+
+void AdvectorExplicitPredictorPatchOps::predictFortran(FaceData<NDIM, double>& q_half,
+                                                       const FaceData<NDIM, double>& u_ADV,
+                                                       const CellData<NDIM, double>& Q,
+                                                       const Patch<NDIM>& patch,
+                                                       const double dt) const
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_half.getDepth() == Q.getDepth());
@@ -964,14 +1062,23 @@ void AdvectorExplicitPredictorPatchOps::predict(FaceData<NDIM, double>& q_half,
     const IntVector<NDIM>& Q_ghost_cells = Q.getGhostCellWidth();
     const IntVector<NDIM>& q_half_ghost_cells = q_half.getGhostCellWidth();
 
-    CellData<NDIM, double> dQ(patch.getBox(), 1, Q_ghost_cells);
-    CellData<NDIM, double> Q_L(patch.getBox(), 1, Q_ghost_cells);
-    CellData<NDIM, double> Q_R(patch.getBox(), 1, Q_ghost_cells);
-    CellData<NDIM, double> Q_temp1(patch.getBox(), 1, Q_ghost_cells);
-    FaceData<NDIM, double> q_half_temp(patch.getBox(), 1, q_half_ghost_cells);
+    const size_t Q_scratch_size = Box<NDIM>::grow(patch.getBox(), Q_ghost_cells).size();
+    double* const dQ = d_scratch_pool.getBuffer(0, Q_scratch_size);
+    double* const Q_L = d_scratch_pool.getBuffer(1, Q_scratch_size);
+    double* const Q_R = d_scratch_pool.getBuffer(2, Q_scratch_size);
+    double* const Q_temp1 = d_scratch_pool.getBuffer(3, Q_scratch_size);
 #if (NDIM > 2)
-    CellData<NDIM, double> Q_temp2(patch.getBox(), 1, Q_ghost_cells);
+    double* const Q_temp2 = d_scratch_pool.getBuffer(4, Q_scratch_size);
 #endif
+    boost::array<double*, NDIM> q_half_temp;
+    Box<NDIM> q_half_scratch_box = patch.getBox();
+    q_half_scratch_box.upper() += IntVector<NDIM>(1);
+    const size_t q_half_scratch_size =
+        Box<NDIM>::grow(q_half_scratch_box, q_half_ghost_cells).size();
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        q_half_temp[axis] = d_scratch_pool.getBuffer(5 + axis, q_half_scratch_size);
+    }
 
     for (int depth = 0; depth < Q.getDepth(); ++depth)
     {
@@ -995,15 +1102,15 @@ void AdvectorExplicitPredictorPatchOps::predict(FaceData<NDIM, double>& q_half,
                               Q_ghost_cells(0),
                               Q_ghost_cells(1),
                               Q.getPointer(depth),
-                              Q_temp1.getPointer(0),
+                              Q_temp1,
                               u_ADV_ghost_cells(0),
                               u_ADV_ghost_cells(1),
                               q_half_ghost_cells(0),
                               q_half_ghost_cells(1),
                               u_ADV.getPointer(0),
                               u_ADV.getPointer(1),
-                              q_half_temp.getPointer(0),
-                              q_half_temp.getPointer(1),
+                              q_half_temp[0],
+                              q_half_temp[1],
                               q_half.getPointer(0, depth),
                               q_half.getPointer(1, depth));
 #endif
@@ -1022,8 +1129,8 @@ void AdvectorExplicitPredictorPatchOps::predict(FaceData<NDIM, double>& q_half,
                               Q_ghost_cells(1),
                               Q_ghost_cells(2),
                               Q.getPointer(depth),
-                              Q_temp1.getPointer(0),
-                              Q_temp2.getPointer(0),
+                              Q_temp1,
+                              Q_temp2,
                               u_ADV_ghost_cells(0),
                               u_ADV_ghost_cells(1),
                               u_ADV_ghost_cells(2),
@@ -1033,9 +1140,9 @@ void AdvectorExplicitPredictorPatchOps::predict(FaceData<NDIM, double>& q_half,
                               u_ADV.getPointer(0),
                               u_ADV.getPointer(1),
                               u_ADV.getPointer(2),
-                              q_half_temp.getPointer(0),
-                              q_half_temp.getPointer(1),
-                              q_half_temp.getPointer(2),
+                              q_half_temp[0],
+                              q_half_temp[1],
+                              q_half_temp[2],
                               q_half.getPointer(0, depth),
                               q_half.getPointer(1, depth),
                               q_half.getPointer(2, depth));
@@ -1054,18 +1161,18 @@ void AdvectorExplicitPredictorPatchOps::predict(FaceData<NDIM, double>& q_half,
                                   Q_ghost_cells(0),
                                   Q_ghost_cells(1),
                                   Q.getPointer(depth),
-                                  Q_temp1.getPointer(0),
-                                  dQ.getPointer(0),
-                                  Q_L.getPointer(0),
-                                  Q_R.getPointer(0),
+                                  Q_temp1,
+                                  dQ,
+                                  Q_L,
+                                  Q_R,
                                   u_ADV_ghost_cells(0),
                                   u_ADV_ghost_cells(1),
                                   q_half_ghost_cells(0),
                                   q_half_ghost_cells(1),
                                   u_ADV.getPointer(0),
                                   u_ADV.getPointer(1),
-                                  q_half_temp.getPointer(0),
-                                  q_half_temp.getPointer(1),
+                                  q_half_temp[0],
+                                  q_half_temp[1],
                                   q_half.getPointer(0, depth),
                                   q_half.getPointer(1, depth));
 #endif
@@ -1084,11 +1191,11 @@ void AdvectorExplicitPredictorPatchOps::predict(FaceData<NDIM, double>& q_half,
                                   Q_ghost_cells(1),
                                   Q_ghost_cells(2),
                                   Q.getPointer(depth),
-                                  Q_temp1.getPointer(0),
-                                  Q_temp2.getPointer(0),
-                                  dQ.getPointer(0),
-                                  Q_L.getPointer(0),
-                                  Q_R.getPointer(0),
+                                  Q_temp1,
+                                  Q_temp2,
+                                  dQ,
+                                  Q_L,
+                                  Q_R,
                                   u_ADV_ghost_cells(0),
                                   u_ADV_ghost_cells(1),
                                   u_ADV_ghost_cells(2),
@@ -1098,31 +1205,31 @@ void AdvectorExplicitPredictorPatchOps::predict(FaceData<NDIM, double>& q_half,
                                   u_ADV.getPointer(0),
                                   u_ADV.getPointer(1),
                                   u_ADV.getPointer(2),
-                                  q_half_temp.getPointer(0),
-                                  q_half_temp.getPointer(1),
-                                  q_half_temp.getPointer(2),
+                                  q_half_temp[0],
+                                  q_half_temp[1],
+                                  q_half_temp[2],
                                   q_half.getPointer(0, depth),
                                   q_half.getPointer(1, depth),
                                   q_half.getPointer(2, depth));
 #endif
             break;
         case UNKNOWN_LIMITER_TYPE:
-            TBOX_ERROR(d_object_name << "::predict(q_half, u_ADV, Q, patch, dt):\n"
+            TBOX_ERROR(d_object_name << "::predictFortran(q_half, u_ADV, Q, patch, dt):\n"
                                      << "  Limiter corresponding to d_limiter_type = "
                                      << d_limiter_type << " not implemented");
             break;
         }
     }
     return;
-} // predict
+} // predictFortran
 
-void
-AdvectorExplicitPredictorPatchOps::predictWithSourceTerm(FaceData<NDIM, double>& q_half,
-                                                         const FaceData<NDIM, double>& u_ADV,
-                                                         const CellData<NDIM, double>& Q,
-                                                         const CellData<NDIM, double>& F,
-                                                         const Patch<NDIM>& patch,
-                                                         const double dt) const
+void AdvectorExplicitPredictorPatchOps::predictWithSourceTermFortran(
+    FaceData<NDIM, double>& q_half,
+    const FaceData<NDIM, double>& u_ADV,
+    const CellData<NDIM, double>& Q,
+    const CellData<NDIM, double>& F,
+    const Patch<NDIM>& patch,
+    const double dt) const
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_half.getDepth() == Q.getDepth());
@@ -1147,16 +1254,26 @@ AdvectorExplicitPredictorPatchOps::predictWithSourceTerm(FaceData<NDIM, double>&
     const IntVector<NDIM>& F_ghost_cells = F.getGhostCellWidth();
     const IntVector<NDIM>& q_half_ghost_cells = q_half.getGhostCellWidth();
 
-    CellData<NDIM, double> dQ(patch.getBox(), 1, Q_ghost_cells);
-    CellData<NDIM, double> Q_L(patch.getBox(), 1, Q_ghost_cells);
-    CellData<NDIM, double> Q_R(patch.getBox(), 1, Q_ghost_cells);
-    CellData<NDIM, double> Q_temp1(patch.getBox(), 1, Q_ghost_cells);
-    CellData<NDIM, double> F_temp1(patch.getBox(), 1, F_ghost_cells);
-    FaceData<NDIM, double> q_half_temp(patch.getBox(), 1, q_half_ghost_cells);
+    const size_t Q_scratch_size = Box<NDIM>::grow(patch.getBox(), Q_ghost_cells).size();
+    const size_t F_scratch_size = Box<NDIM>::grow(patch.getBox(), F_ghost_cells).size();
+    double* const dQ = d_scratch_pool.getBuffer(0, Q_scratch_size);
+    double* const Q_L = d_scratch_pool.getBuffer(1, Q_scratch_size);
+    double* const Q_R = d_scratch_pool.getBuffer(2, Q_scratch_size);
+    double* const Q_temp1 = d_scratch_pool.getBuffer(3, Q_scratch_size);
+    double* const F_temp1 = d_scratch_pool.getBuffer(4, F_scratch_size);
 #if (NDIM > 2)
-    CellData<NDIM, double> Q_temp2(patch.getBox(), 1, Q_ghost_cells);
-    CellData<NDIM, double> F_temp2(patch.getBox(), 1, F_ghost_cells);
+    double* const Q_temp2 = d_scratch_pool.getBuffer(5, Q_scratch_size);
+    double* const F_temp2 = d_scratch_pool.getBuffer(6, F_scratch_size);
 #endif
+    boost::array<double*, NDIM> q_half_temp;
+    Box<NDIM> q_half_scratch_box = patch.getBox();
+    q_half_scratch_box.upper() += IntVector<NDIM>(1);
+    const size_t q_half_scratch_size =
+        Box<NDIM>::grow(q_half_scratch_box, q_half_ghost_cells).size();
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        q_half_temp[axis] = d_scratch_pool.getBuffer(7 + axis, q_half_scratch_size);
+    }
 
     for (int depth = 0; depth < Q.getDepth(); ++depth)
     {
@@ -1182,17 +1299,17 @@ AdvectorExplicitPredictorPatchOps::predictWithSourceTerm(FaceData<NDIM, double>&
                                           F_ghost_cells(0),
                                           F_ghost_cells(1),
                                           Q.getPointer(depth),
-                                          Q_temp1.getPointer(0),
+                                          Q_temp1,
                                           F.getPointer(depth),
-                                          F_temp1.getPointer(0),
+                                          F_temp1,
                                           u_ADV_ghost_cells(0),
                                           u_ADV_ghost_cells(1),
                                           q_half_ghost_cells(0),
                                           q_half_ghost_cells(1),
                                           u_ADV.getPointer(0),
                                           u_ADV.getPointer(1),
-                                          q_half_temp.getPointer(0),
-                                          q_half_temp.getPointer(1),
+                                          q_half_temp[0],
+                                          q_half_temp[1],
                                           q_half.getPointer(0, depth),
                                           q_half.getPointer(1, depth));
 #endif
@@ -1214,11 +1331,11 @@ AdvectorExplicitPredictorPatchOps::predictWithSourceTerm(FaceData<NDIM, double>&
                                           F_ghost_cells(1),
                                           F_ghost_cells(2),
                                           Q.getPointer(depth),
-                                          Q_temp1.getPointer(0),
-                                          Q_temp2.getPointer(0),
+                                          Q_temp1,
+                                          Q_temp2,
                                           F.getPointer(depth),
-                                          F_temp1.getPointer(0),
-                                          F_temp2.getPointer(0),
+                                          F_temp1,
+                                          F_temp2,
                                           u_ADV_ghost_cells(0),
                                           u_ADV_ghost_cells(1),
                                           u_ADV_ghost_cells(2),
@@ -1228,9 +1345,9 @@ AdvectorExplicitPredictorPatchOps::predictWithSourceTerm(FaceData<NDIM, double>&
                                           u_ADV.getPointer(0),
                                           u_ADV.getPointer(1),
                                           u_ADV.getPointer(2),
-                                          q_half_temp.getPointer(0),
-                                          q_half_temp.getPointer(1),
-                                          q_half_temp.getPointer(2),
+                                          q_half_temp[0],
+                                          q_half_temp[1],
+                                          q_half_temp[2],
                                           q_half.getPointer(0, depth),
                                           q_half.getPointer(1, depth),
                                           q_half.getPointer(2, depth));
@@ -1251,20 +1368,20 @@ AdvectorExplicitPredictorPatchOps::predictWithSourceTerm(FaceData<NDIM, double>&
                                               F_ghost_cells(0),
                                               F_ghost_cells(1),
                                               Q.getPointer(depth),
-                                              Q_temp1.getPointer(0),
-                                              dQ.getPointer(0),
-                                              Q_L.getPointer(0),
-                                              Q_R.getPointer(0),
+                                              Q_temp1,
+                                              dQ,
+                                              Q_L,
+                                              Q_R,
                                               F.getPointer(depth),
-                                              F_temp1.getPointer(0),
+                                              F_temp1,
                                               u_ADV_ghost_cells(0),
                                               u_ADV_ghost_cells(1),
                                               q_half_ghost_cells(0),
                                               q_half_ghost_cells(1),
                                               u_ADV.getPointer(0),
                                               u_ADV.getPointer(1),
-                                              q_half_temp.getPointer(0),
-                                              q_half_temp.getPointer(1),
+                                              q_half_temp[0],
+                                              q_half_temp[1],
                                               q_half.getPointer(0, depth),
                                               q_half.getPointer(1, depth));
 #endif
@@ -1286,14 +1403,14 @@ AdvectorExplicitPredictorPatchOps::predictWithSourceTerm(FaceData<NDIM, double>&
                                               F_ghost_cells(1),
                                               F_ghost_cells(2),
                                               Q.getPointer(depth),
-                                              Q_temp1.getPointer(0),
-                                              Q_temp2.getPointer(0),
-                                              dQ.getPointer(0),
-                                              Q_L.getPointer(0),
-                                              Q_R.getPointer(0),
+                                              Q_temp1,
+                                              Q_temp2,
+                                              dQ,
+                                              Q_L,
+                                              Q_R,
                                               F.getPointer(depth),
-                                              F_temp1.getPointer(0),
-                                              F_temp2.getPointer(0),
+                                              F_temp1,
+                                              F_temp2,
                                               u_ADV_ghost_cells(0),
                                               u_ADV_ghost_cells(1),
                                               u_ADV_ghost_cells(2),
@@ -1303,9 +1420,9 @@ AdvectorExplicitPredictorPatchOps::predictWithSourceTerm(FaceData<NDIM, double>&
                                               u_ADV.getPointer(0),
                                               u_ADV.getPointer(1),
                                               u_ADV.getPointer(2),
-                                              q_half_temp.getPointer(0),
-                                              q_half_temp.getPointer(1),
-                                              q_half_temp.getPointer(2),
+                                              q_half_temp[0],
+                                              q_half_temp[1],
+                                              q_half_temp[2],
                                               q_half.getPointer(0, depth),
                                               q_half.getPointer(1, depth),
                                               q_half.getPointer(2, depth));
@@ -1313,14 +1430,44 @@ AdvectorExplicitPredictorPatchOps::predictWithSourceTerm(FaceData<NDIM, double>&
             break;
         case UNKNOWN_LIMITER_TYPE:
             TBOX_ERROR(d_object_name
-                       << "::predictWithSourceTerm(q_half, u_ADV, Q, F, patch, dt):\n"
+                       << "::predictWithSourceTermFortran(q_half, u_ADV, Q, F, patch, dt):\n"
                        << "  Limiter corresponding to d_limiter_type = " << d_limiter_type
                        << " not implemented");
             break;
         }
     }
     return;
-} // predictWithSourceTerm
+} // predictWithSourceTermFortran
+
+void AdvectorExplicitPredictorPatchOps::comparePredictorBackends(
+    const FaceData<NDIM, double>& q_half_cxx,
+    const FaceData<NDIM, double>& q_half_fortran,
+    const Patch<NDIM>& patch) const
+{
+    double max_diff = 0.0, max_val = 0.0;
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        for (FaceIterator<NDIM> ic(patch.getBox(), axis); ic; ic++)
+        {
+            const FaceIndex<NDIM>& i = ic();
+            for (int depth = 0; depth < q_half_cxx.getDepth(); ++depth)
+            {
+                const double q_cxx = q_half_cxx(i, depth);
+                const double q_fortran = q_half_fortran(i, depth);
+                max_diff = std::max(max_diff, std::abs(q_cxx - q_fortran));
+                max_val = std::max(max_val, std::abs(q_fortran));
+            }
+        }
+    }
+    if (max_diff > PREDICTOR_COMPARISON_TOL * std::max(1.0, max_val))
+    {
+        TBOX_WARNING(d_object_name << "::comparePredictorBackends():\n"
+                                   << "  C++ and Fortran predictors differ on patch "
+                                   << patch.getPatchNumber() << ": max |difference| = "
+                                   << max_diff << ", max |q_half| = " << max_val << "\n");
+    }
+    return;
+} // comparePredictorBackends
 
 void AdvectorExplicitPredictorPatchOps::getFromInput(Pointer<Database> db,
                                                      bool /*is_from_restart*/)
@@ -1336,6 +1483,37 @@ void AdvectorExplicitPredictorPatchOps::getFromInput(Pointer<Database> db,
 #if (NDIM == 3)
     if (db->keyExists("using_full_ctu")) d_using_full_ctu = db->getBool("using_full_ctu");
 #endif
+    if (db->keyExists("predictor_backend"))
+    {
+        const std::string predictor_backend = db->getString("predictor_backend");
+        if (predictor_backend == "CXX")
+        {
+            d_use_cxx_predictor = true;
+        }
+        else if (predictor_backend == "FORTRAN")
+        {
+            d_use_cxx_predictor = false;
+        }
+        else
+        {
+            TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                     << "  unknown predictor_backend: " << predictor_backend
+                                     << "\n"
+                                     << "  valid choices are: CXX, FORTRAN\n");
+        }
+    }
+    if (db->keyExists("compare_predictor_backends"))
+    {
+        d_compare_predictor_backends = db->getBool("compare_predictor_backends");
+    }
+    if (d_use_cxx_predictor && !AdvectorExplicitPredictorKernels::isSupported(d_limiter_type))
+    {
+        TBOX_WARNING(d_object_name << "::getFromInput():\n"
+                                   << "  no C++ predictor is available for limiter type "
+                                   << IBAMR::enum_to_string<LimiterType>(d_limiter_type)
+                                   << "\n"
+                                   << "  the Fortran predictor will be used instead.\n");
+    }
     return;
 } // getFromInput
 
@@ -38,6 +38,7 @@
 #include <string>
 
 #include "ibamr/ibamr_enums.h"
+#include "ibtk/PatchScratchPool.h"
 #include "tbox/Pointer.h"
 #include "tbox/Serializable.h"
 
@@ -98,6 +99,22 @@ namespace IBAMR
  * non-conservative form of the source term must be supplied to the predictor
  * in-order to obtain a formally consistent method.
  *
+ * Sample input:
+ * \verbatim
+ limiter_type = "MC_LIMITED"         // see IBAMR::LimiterType
+ using_full_ctu = TRUE               // 3D only
+ predictor_backend = "FORTRAN"       // or "CXX"
+ compare_predictor_backends = FALSE  // check the CXX predictor against FORTRAN
+ \endverbatim
+ *
+ * When \p predictor_backend is set to "CXX", the slope-limited predictors are
+ * evaluated by the C++ kernels provided by class
+ * IBAMR::AdvectorExplicitPredictorKernels.  The PPM-type predictors are always
+ * evaluated by the Fortran routines.  When \p compare_predictor_backends is
+ * TRUE, the Fortran predictor is additionally evaluated on each patch and a
+ * warning is issued if the two results differ; this is intended for debugging
+ * only.
+ *
  * \see IBAMR::AdvectorPredictorCorrectorHyperbolicPatchOps
  */
 class AdvectorExplicitPredictorPatchOps : public SAMRAI::tbox::Serializable
@@ -354,7 +371,9 @@ private:
     operator=(const AdvectorExplicitPredictorPatchOps& that);
 
     /*
-     * Private functions used to compute the predicted values/fluxes.
+     * Private functions used to compute the predicted values/fluxes.  The
+     * predict() and predictWithSourceTerm() functions dispatch to either the
+     * C++ or the Fortran implementation of the predictor.
      */
     void predict(SAMRAI::pdat::FaceData<NDIM, double>& q_half,
                  const SAMRAI::pdat::FaceData<NDIM, double>& u_ADV,
@@ -367,6 +386,31 @@ private:
                                const SAMRAI::pdat::CellData<NDIM, double>& F,
                                const SAMRAI::hier::Patch<NDIM>& patch,
                                double dt) const;
+    void predictCXX(SAMRAI::pdat::FaceData<NDIM, double>& q_half,
+                    const SAMRAI::pdat::FaceData<NDIM, double>& u_ADV,
+                    const SAMRAI::pdat::CellData<NDIM, double>& Q,
+                    const SAMRAI::pdat::CellData<NDIM, double>* F,
+                    const SAMRAI::hier::Patch<NDIM>& patch,
+                    double dt) const;
+    void predictFortran(SAMRAI::pdat::FaceData<NDIM, double>& q_half,
+                        const SAMRAI::pdat::FaceData<NDIM, double>& u_ADV,
+                        const SAMRAI::pdat::CellData<NDIM, double>& Q,
+                        const SAMRAI::hier::Patch<NDIM>& patch,
+                        double dt) const;
+    void predictWithSourceTermFortran(SAMRAI::pdat::FaceData<NDIM, double>& q_half,
+                                      const SAMRAI::pdat::FaceData<NDIM, double>& u_ADV,
+                                      const SAMRAI::pdat::CellData<NDIM, double>& Q,
+                                      const SAMRAI::pdat::CellData<NDIM, double>& F,
+                                      const SAMRAI::hier::Patch<NDIM>& patch,
+                                      double dt) const;
+
+    /*
+     * Compare the predicted values computed by the C++ and Fortran predictors
+     * on the interior faces of the patch, and issue a warning if they differ.
+     */
+    void comparePredictorBackends(const SAMRAI::pdat::FaceData<NDIM, double>& q_half_cxx,
+                                  const SAMRAI::pdat::FaceData<NDIM, double>& q_half_fortran,
+                                  const SAMRAI::hier::Patch<NDIM>& patch) const;
 
     /*
      * These private member functions read data from input and restart.  When
@@ -394,11 +438,23 @@ private:
      *                            computing numerical fluxes
      *    d_using_full_ctu ...... specifies whether full corner transport
      *                            upwinding is used for 3D computations
+     *    d_use_cxx_predictor ... specifies whether the C++ predictors are used
+     *                            when they are available
+     *    d_compare_predictor_backends ... specifies whether the results of the
+     *                            C++ predictors are checked against those of the
+     *                            Fortran predictors
      */
     LimiterType d_limiter_type;
 #if (NDIM == 3)
     bool d_using_full_ctu;
 #endif
+    bool d_use_cxx_predictor;
+    bool d_compare_predictor_backends;
+
+    /*
+     * Reusable storage for per-patch temporaries.
+     */
+    mutable IBTK::PatchScratchPool d_scratch_pool;
 };
 } // namespace IBAMR
 
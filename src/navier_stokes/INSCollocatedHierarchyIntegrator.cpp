@@ -1804,6 +1804,24 @@ void INSCollocatedHierarchyIntegrator::resetHierarchyConfigurationSpecialized(
     return;
 } // resetHierarchyConfigurationSpecialized
 
+void INSCollocatedHierarchyIntegrator::resetIntegratorToPreadvanceStateSpecialized()
+{
+    // Deallocate the solver vectors.
+    d_U_rhs_vec->deallocateVectorData();
+    d_U_adv_vec->deallocateVectorData();
+    d_N_vec->deallocateVectorData();
+    d_Phi_rhs_vec->deallocateVectorData();
+
+    // Deallocate the scratch and new data.
+    INSHierarchyIntegrator::resetIntegratorToPreadvanceStateSpecialized();
+    return;
+} // resetIntegratorToPreadvanceStateSpecialized
+
+bool INSCollocatedHierarchyIntegrator::canResetIntegratorToPreadvanceStateSpecialized() const
+{
+    return true;
+} // canResetIntegratorToPreadvanceStateSpecialized
+
 void INSCollocatedHierarchyIntegrator::applyGradientDetectorSpecialized(
     const Pointer<BasePatchHierarchy<NDIM> > hierarchy,
     const int level_number,
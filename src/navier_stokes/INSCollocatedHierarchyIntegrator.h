@@ -218,6 +218,19 @@ protected:
         int coarsest_level,
         int finest_level);
 
+    /*!
+     * Deallocate the solver vectors allocated by preprocessIntegrateHierarchy(),
+     * and reset the hierarchy integrator to the state at the beginning of the
+     * current time step.
+     */
+    void resetIntegratorToPreadvanceStateSpecialized();
+
+    /*!
+     * Indicate that the integrator can be reset to the state at the beginning
+     * of the current time step.
+     */
+    bool canResetIntegratorToPreadvanceStateSpecialized() const;
+
     /*!
      * Set integer tags to "one" in cells where refinement of the given level
      * should occur according to the magnitude of the fluid vorticity.
@@ -58,6 +58,7 @@
 #include "ibamr/ibamr_utilities.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/CartExtrapPhysBdryOp.h"
+#include "ibtk/PatchTaskExecutor.h"
 #include "tbox/Timer.h"
 #include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
@@ -309,6 +310,178 @@ static Timer* t_apply_convective_operator;
 static Timer* t_apply;
 static Timer* t_initialize_operator_state;
 static Timer* t_deallocate_operator_state;
+
+// Computes the convective derivative on a single patch from the face-centered
+// extrapolated values and fluxes.  Tasks are executed on each patch of a level
+// by PatchTaskExecutor::execute().
+class DifferenceTask
+{
+public:
+    DifferenceTask(const int N_idx,
+                   const int u_idx,
+                   const int u_extrap_idx,
+                   const int u_flux_idx,
+                   const ConvectiveDifferencingType difference_form)
+        : d_N_idx(N_idx), d_u_idx(u_idx), d_u_extrap_idx(u_extrap_idx), d_u_flux_idx(u_flux_idx),
+          d_difference_form(difference_form)
+    {
+    } // DifferenceTask
+
+    void operator()(const Pointer<Patch<NDIM> >& patch) const
+    {
+        const Box<NDIM>& patch_box = patch->getBox();
+        const IntVector<NDIM>& patch_lower = patch_box.lower();
+        const IntVector<NDIM>& patch_upper = patch_box.upper();
+
+        const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+        const double* const dx = patch_geom->getDx();
+
+        Pointer<CellData<NDIM, double> > N_data = patch->getPatchData(d_N_idx);
+        const IntVector<NDIM>& N_data_gcw = N_data->getGhostCellWidth();
+
+        if (d_difference_form == ADVECTIVE || d_difference_form == SKEW_SYMMETRIC)
+        {
+            Pointer<FaceData<NDIM, double> > u_ADV_data = patch->getPatchData(d_u_idx);
+            const IntVector<NDIM>& u_ADV_data_gcw = u_ADV_data->getGhostCellWidth();
+            Pointer<FaceData<NDIM, double> > u_extrap_data = patch->getPatchData(d_u_extrap_idx);
+            const IntVector<NDIM>& u_extrap_data_gcw = u_extrap_data->getGhostCellWidth();
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                ADVECT_DERIVATIVE_FC(
+                    dx,
+#if (NDIM == 2)
+                    patch_lower(0),
+                    patch_upper(0),
+                    patch_lower(1),
+                    patch_upper(1),
+                    //                      u_extrap_data_gcw(0), u_extrap_data_gcw(1),
+                    u_ADV_data_gcw(0),
+                    u_ADV_data_gcw(1),
+                    u_extrap_data_gcw(0),
+                    u_extrap_data_gcw(1),
+                    //                      u_extrap_data->getPointer(0,0),
+                    // u_extrap_data->getPointer(1,1),
+                    u_ADV_data->getPointer(0),
+                    u_ADV_data->getPointer(1),
+                    u_extrap_data->getPointer(0, axis),
+                    u_extrap_data->getPointer(1, axis),
+                    N_data_gcw(0),
+                    N_data_gcw(1),
+#endif
+#if (NDIM == 3)
+                    patch_lower(0),
+                    patch_upper(0),
+                    patch_lower(1),
+                    patch_upper(1),
+                    patch_lower(2),
+                    patch_upper(2),
+                    //                      u_extrap_data_gcw(0), u_extrap_data_gcw(1),
+                    // u_extrap_data_gcw(2),
+                    u_ADV_data_gcw(0),
+                    u_ADV_data_gcw(1),
+                    u_ADV_data_gcw(2),
+                    u_extrap_data_gcw(0),
+                    u_extrap_data_gcw(1),
+                    u_extrap_data_gcw(2),
+                    //                      u_extrap_data->getPointer(0,0),
+                    // u_extrap_data->getPointer(1,1),    u_extrap_data->getPointer(2,2),
+                    u_ADV_data->getPointer(0),
+                    u_ADV_data->getPointer(1),
+                    u_ADV_data->getPointer(2),
+                    u_extrap_data->getPointer(0, axis),
+                    u_extrap_data->getPointer(1, axis),
+                    u_extrap_data->getPointer(2, axis),
+                    N_data_gcw(0),
+                    N_data_gcw(1),
+                    N_data_gcw(2),
+#endif
+                    N_data->getPointer(axis));
+            }
+        }
+
+        if (d_difference_form == CONSERVATIVE)
+        {
+            Pointer<FaceData<NDIM, double> > u_flux_data = patch->getPatchData(d_u_flux_idx);
+            const IntVector<NDIM>& u_flux_data_gcw = u_flux_data->getGhostCellWidth();
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                static const double alpha = 1.0;
+                F_TO_C_DIV_FC(N_data->getPointer(axis),
+                              N_data_gcw.min(),
+                              alpha,
+#if (NDIM == 2)
+                              u_flux_data->getPointer(0, axis),
+                              u_flux_data->getPointer(1, axis),
+                              u_flux_data_gcw.min(),
+                              patch_lower(0),
+                              patch_upper(0),
+                              patch_lower(1),
+                              patch_upper(1),
+#endif
+#if (NDIM == 3)
+                              u_flux_data->getPointer(0, axis),
+                              u_flux_data->getPointer(1, axis),
+                              u_flux_data->getPointer(2, axis),
+                              u_flux_data_gcw.min(),
+                              patch_lower(0),
+                              patch_upper(0),
+                              patch_lower(1),
+                              patch_upper(1),
+                              patch_lower(2),
+                              patch_upper(2),
+#endif
+                              dx);
+            }
+        }
+
+        if (d_difference_form == SKEW_SYMMETRIC)
+        {
+            Pointer<FaceData<NDIM, double> > u_flux_data = patch->getPatchData(d_u_flux_idx);
+            const IntVector<NDIM>& u_flux_data_gcw = u_flux_data->getGhostCellWidth();
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                static const double alpha = 0.5;
+                static const double beta = 0.5;
+                F_TO_C_DIV_ADD_FC(N_data->getPointer(axis),
+                                  N_data_gcw.min(),
+                                  alpha,
+#if (NDIM == 2)
+                                  u_flux_data->getPointer(0, axis),
+                                  u_flux_data->getPointer(1, axis),
+                                  u_flux_data_gcw.min(),
+                                  beta,
+                                  N_data->getPointer(axis),
+                                  N_data_gcw.min(),
+                                  patch_lower(0),
+                                  patch_upper(0),
+                                  patch_lower(1),
+                                  patch_upper(1),
+#endif
+#if (NDIM == 3)
+                                  u_flux_data->getPointer(0, axis),
+                                  u_flux_data->getPointer(1, axis),
+                                  u_flux_data->getPointer(2, axis),
+                                  u_flux_data_gcw.min(),
+                                  beta,
+                                  N_data->getPointer(axis),
+                                  N_data_gcw.min(),
+                                  patch_lower(0),
+                                  patch_upper(0),
+                                  patch_lower(1),
+                                  patch_upper(1),
+                                  patch_lower(2),
+                                  patch_upper(2),
+#endif
+                                  dx);
+            }
+        }
+        return;
+    } // operator()
+
+private:
+    const int d_N_idx, d_u_idx, d_u_extrap_idx, d_u_flux_idx;
+    const ConvectiveDifferencingType d_difference_form;
+};
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -460,13 +633,14 @@ void INSCollocatedPPMConvectiveOperator::applyConvectiveOperator(const int U_idx
             TBOX_ASSERT(u_extrap_data_gcw.min() == u_extrap_data_gcw.max());
 #endif
             CellData<NDIM, double>& U0_data = *U_data;
-            CellData<NDIM, double> U1_data(patch_box, 1, U_data_gcw);
+            const size_t scratch_size = Box<NDIM>::grow(patch_box, U_data_gcw).size();
+            double* const U1 = d_scratch_pool.getBuffer(0, scratch_size);
+            double* const dU = d_scratch_pool.getBuffer(1, scratch_size);
+            double* const U_L = d_scratch_pool.getBuffer(2, scratch_size);
+            double* const U_R = d_scratch_pool.getBuffer(3, scratch_size);
 #if (NDIM == 3)
-            CellData<NDIM, double> U2_data(patch_box, 1, U_data_gcw);
+            double* const U2 = d_scratch_pool.getBuffer(4, scratch_size);
 #endif
-            CellData<NDIM, double> dU_data(patch_box, 1, U_data_gcw);
-            CellData<NDIM, double> U_L_data(patch_box, 1, U_data_gcw);
-            CellData<NDIM, double> U_R_data(patch_box, 1, U_data_gcw);
 
             // Extrapolate from cell centers to cell faces.
             for (unsigned int axis = 0; axis < NDIM; ++axis)
@@ -480,10 +654,10 @@ void INSCollocatedPPMConvectiveOperator::applyConvectiveOperator(const int U_idx
                     U_data_gcw(0),
                     U_data_gcw(1),
                     U0_data.getPointer(axis),
-                    U1_data.getPointer(),
-                    dU_data.getPointer(),
-                    U_L_data.getPointer(),
-                    U_R_data.getPointer(),
+                    U1,
+                    dU,
+                    U_L,
+                    U_R,
                     u_ADV_data_gcw(0),
                     u_ADV_data_gcw(1),
                     u_extrap_data_gcw(0),
@@ -504,11 +678,11 @@ void INSCollocatedPPMConvectiveOperator::applyConvectiveOperator(const int U_idx
                     U_data_gcw(1),
                     U_data_gcw(2),
                     U0_data.getPointer(axis),
-                    U1_data.getPointer(),
-                    U2_data.getPointer(),
-                    dU_data.getPointer(),
-                    U_L_data.getPointer(),
-                    U_R_data.getPointer(),
+                    U1,
+                    U2,
+                    dU,
+                    U_L,
+                    U_R,
                     u_ADV_data_gcw(0),
                     u_ADV_data_gcw(1),
                     u_ADV_data_gcw(2),
@@ -604,164 +778,11 @@ void INSCollocatedPPMConvectiveOperator::applyConvectiveOperator(const int U_idx
     }
 
     // Difference values on the patches.
+    const DifferenceTask difference_task(
+        N_idx, d_u_idx, d_u_extrap_idx, d_u_flux_idx, d_difference_form);
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            const Box<NDIM>& patch_box = patch->getBox();
-            const IntVector<NDIM>& patch_lower = patch_box.lower();
-            const IntVector<NDIM>& patch_upper = patch_box.upper();
-
-            const Pointer<CartesianPatchGeometry<NDIM> > patch_geom =
-                patch->getPatchGeometry();
-            const double* const dx = patch_geom->getDx();
-
-            Pointer<CellData<NDIM, double> > N_data = patch->getPatchData(N_idx);
-            const IntVector<NDIM>& N_data_gcw = N_data->getGhostCellWidth();
-
-            if (d_difference_form == ADVECTIVE || d_difference_form == SKEW_SYMMETRIC)
-            {
-                Pointer<FaceData<NDIM, double> > u_ADV_data = patch->getPatchData(d_u_idx);
-                const IntVector<NDIM>& u_ADV_data_gcw = u_ADV_data->getGhostCellWidth();
-                Pointer<FaceData<NDIM, double> > u_extrap_data =
-                    patch->getPatchData(d_u_extrap_idx);
-                const IntVector<NDIM>& u_extrap_data_gcw = u_extrap_data->getGhostCellWidth();
-                for (unsigned int axis = 0; axis < NDIM; ++axis)
-                {
-                    ADVECT_DERIVATIVE_FC(
-                        dx,
-#if (NDIM == 2)
-                        patch_lower(0),
-                        patch_upper(0),
-                        patch_lower(1),
-                        patch_upper(1),
-                        //                      u_extrap_data_gcw(0), u_extrap_data_gcw(1),
-                        u_ADV_data_gcw(0),
-                        u_ADV_data_gcw(1),
-                        u_extrap_data_gcw(0),
-                        u_extrap_data_gcw(1),
-                        //                      u_extrap_data->getPointer(0,0),
-                        // u_extrap_data->getPointer(1,1),
-                        u_ADV_data->getPointer(0),
-                        u_ADV_data->getPointer(1),
-                        u_extrap_data->getPointer(0, axis),
-                        u_extrap_data->getPointer(1, axis),
-                        N_data_gcw(0),
-                        N_data_gcw(1),
-#endif
-#if (NDIM == 3)
-                        patch_lower(0),
-                        patch_upper(0),
-                        patch_lower(1),
-                        patch_upper(1),
-                        patch_lower(2),
-                        patch_upper(2),
-                        //                      u_extrap_data_gcw(0), u_extrap_data_gcw(1),
-                        // u_extrap_data_gcw(2),
-                        u_ADV_data_gcw(0),
-                        u_ADV_data_gcw(1),
-                        u_ADV_data_gcw(2),
-                        u_extrap_data_gcw(0),
-                        u_extrap_data_gcw(1),
-                        u_extrap_data_gcw(2),
-                        //                      u_extrap_data->getPointer(0,0),
-                        // u_extrap_data->getPointer(1,1),    u_extrap_data->getPointer(2,2),
-                        u_ADV_data->getPointer(0),
-                        u_ADV_data->getPointer(1),
-                        u_ADV_data->getPointer(2),
-                        u_extrap_data->getPointer(0, axis),
-                        u_extrap_data->getPointer(1, axis),
-                        u_extrap_data->getPointer(2, axis),
-                        N_data_gcw(0),
-                        N_data_gcw(1),
-                        N_data_gcw(2),
-#endif
-                        N_data->getPointer(axis));
-                }
-            }
-
-            if (d_difference_form == CONSERVATIVE)
-            {
-                Pointer<FaceData<NDIM, double> > u_flux_data =
-                    patch->getPatchData(d_u_flux_idx);
-                const IntVector<NDIM>& u_flux_data_gcw = u_flux_data->getGhostCellWidth();
-                for (unsigned int axis = 0; axis < NDIM; ++axis)
-                {
-                    static const double alpha = 1.0;
-                    F_TO_C_DIV_FC(N_data->getPointer(axis),
-                                  N_data_gcw.min(),
-                                  alpha,
-#if (NDIM == 2)
-                                  u_flux_data->getPointer(0, axis),
-                                  u_flux_data->getPointer(1, axis),
-                                  u_flux_data_gcw.min(),
-                                  patch_lower(0),
-                                  patch_upper(0),
-                                  patch_lower(1),
-                                  patch_upper(1),
-#endif
-#if (NDIM == 3)
-                                  u_flux_data->getPointer(0, axis),
-                                  u_flux_data->getPointer(1, axis),
-                                  u_flux_data->getPointer(2, axis),
-                                  u_flux_data_gcw.min(),
-                                  patch_lower(0),
-                                  patch_upper(0),
-                                  patch_lower(1),
-                                  patch_upper(1),
-                                  patch_lower(2),
-                                  patch_upper(2),
-#endif
-                                  dx);
-                }
-            }
-
-            if (d_difference_form == SKEW_SYMMETRIC)
-            {
-                Pointer<FaceData<NDIM, double> > u_flux_data =
-                    patch->getPatchData(d_u_flux_idx);
-                const IntVector<NDIM>& u_flux_data_gcw = u_flux_data->getGhostCellWidth();
-                for (unsigned int axis = 0; axis < NDIM; ++axis)
-                {
-                    static const double alpha = 0.5;
-                    static const double beta = 0.5;
-                    F_TO_C_DIV_ADD_FC(N_data->getPointer(axis),
-                                      N_data_gcw.min(),
-                                      alpha,
-#if (NDIM == 2)
-                                      u_flux_data->getPointer(0, axis),
-                                      u_flux_data->getPointer(1, axis),
-                                      u_flux_data_gcw.min(),
-                                      beta,
-                                      N_data->getPointer(axis),
-                                      N_data_gcw.min(),
-                                      patch_lower(0),
-                                      patch_upper(0),
-                                      patch_lower(1),
-                                      patch_upper(1),
-#endif
-#if (NDIM == 3)
-                                      u_flux_data->getPointer(0, axis),
-                                      u_flux_data->getPointer(1, axis),
-                                      u_flux_data->getPointer(2, axis),
-                                      u_flux_data_gcw.min(),
-                                      beta,
-                                      N_data->getPointer(axis),
-                                      N_data_gcw.min(),
-                                      patch_lower(0),
-                                      patch_upper(0),
-                                      patch_lower(1),
-                                      patch_upper(1),
-                                      patch_lower(2),
-                                      patch_upper(2),
-#endif
-                                      dx);
-                }
-            }
-        }
+        PatchTaskExecutor::execute(difference_task, d_hierarchy->getPatchLevel(ln));
     }
     IBAMR_TIMER_STOP(t_apply_convective_operator);
     return;
@@ -831,6 +852,8 @@ void INSCollocatedPPMConvectiveOperator::initializeOperatorState(
                 level->allocatePatchData(d_u_flux_idx);
         }
     }
+    d_scratch_pool.reserve(
+        NDIM + 2, d_hierarchy, d_coarsest_ln, d_finest_ln, IntVector<NDIM>(GADVECTG));
     d_is_initialized = true;
 
     IBAMR_TIMER_STOP(t_initialize_operator_state);
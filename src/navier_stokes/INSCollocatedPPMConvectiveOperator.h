@@ -47,6 +47,7 @@
 #include "RefinePatchStrategy.h"
 #include "ibamr/ConvectiveOperator.h"
 #include "ibamr/ibamr_enums.h"
+#include "ibtk/PatchScratchPool.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 
@@ -218,6 +219,9 @@ private:
     SAMRAI::tbox::Pointer<SAMRAI::pdat::FaceVariable<NDIM, double> > d_u_extrap_var,
         d_u_flux_var;
     int d_u_extrap_idx, d_u_flux_idx;
+
+    // Reusable storage for per-patch temporaries.
+    IBTK::PatchScratchPool d_scratch_pool;
 };
 } // namespace IBAMR
 
@@ -51,6 +51,7 @@
 #include "VariableDatabase.h"
 #include "ibamr/ibamr_utilities.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
+#include "ibtk/PatchTaskExecutor.h"
 #include "tbox/Timer.h"
 #include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
@@ -218,6 +219,164 @@ static Timer* t_apply_convective_operator;
 static Timer* t_apply;
 static Timer* t_initialize_operator_state;
 static Timer* t_deallocate_operator_state;
+
+// Computes the convective derivative on a single patch.  Tasks are executed on
+// each patch of a level by PatchTaskExecutor::execute().
+class ConvectiveDerivativeTask
+{
+public:
+    ConvectiveDerivativeTask(const int N_idx,
+                             const int U_idx,
+                             const ConvectiveDifferencingType difference_form)
+        : d_N_idx(N_idx), d_U_idx(U_idx), d_difference_form(difference_form)
+    {
+    } // ConvectiveDerivativeTask
+
+    void operator()(const Pointer<Patch<NDIM> >& patch) const
+    {
+        const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+        const double* const dx = patch_geom->getDx();
+
+        const Box<NDIM>& patch_box = patch->getBox();
+        const IntVector<NDIM>& patch_lower = patch_box.lower();
+        const IntVector<NDIM>& patch_upper = patch_box.upper();
+
+        Pointer<SideData<NDIM, double> > N_data = patch->getPatchData(d_N_idx);
+        Pointer<SideData<NDIM, double> > U_data = patch->getPatchData(d_U_idx);
+
+        const IntVector<NDIM>& N_data_gcw = N_data->getGhostCellWidth();
+        const IntVector<NDIM>& U_data_gcw = U_data->getGhostCellWidth();
+
+        switch (d_difference_form)
+        {
+        case CONSERVATIVE:
+            NAVIER_STOKES_STAGGERED_DIV_DERIVATIVE_FC(dx,
+#if (NDIM == 2)
+                                                      patch_lower(0),
+                                                      patch_upper(0),
+                                                      patch_lower(1),
+                                                      patch_upper(1),
+                                                      U_data_gcw(0),
+                                                      U_data_gcw(1),
+                                                      U_data->getPointer(0),
+                                                      U_data->getPointer(1),
+                                                      N_data_gcw(0),
+                                                      N_data_gcw(1),
+                                                      N_data->getPointer(0),
+                                                      N_data->getPointer(1)
+#endif
+#if (NDIM == 3)
+                                                      patch_lower(0),
+                                                      patch_upper(0),
+                                                      patch_lower(1),
+                                                      patch_upper(1),
+                                                      patch_lower(2),
+                                                      patch_upper(2),
+                                                      U_data_gcw(0),
+                                                      U_data_gcw(1),
+                                                      U_data_gcw(2),
+                                                      U_data->getPointer(0),
+                                                      U_data->getPointer(1),
+                                                      U_data->getPointer(2),
+                                                      N_data_gcw(0),
+                                                      N_data_gcw(1),
+                                                      N_data_gcw(2),
+                                                      N_data->getPointer(0),
+                                                      N_data->getPointer(1),
+                                                      N_data->getPointer(2)
+#endif
+                                                      );
+            break;
+        case ADVECTIVE:
+            NAVIER_STOKES_STAGGERED_ADV_DERIVATIVE_FC(dx,
+#if (NDIM == 2)
+                                                      patch_lower(0),
+                                                      patch_upper(0),
+                                                      patch_lower(1),
+                                                      patch_upper(1),
+                                                      U_data_gcw(0),
+                                                      U_data_gcw(1),
+                                                      U_data->getPointer(0),
+                                                      U_data->getPointer(1),
+                                                      N_data_gcw(0),
+                                                      N_data_gcw(1),
+                                                      N_data->getPointer(0),
+                                                      N_data->getPointer(1)
+#endif
+#if (NDIM == 3)
+                                                      patch_lower(0),
+                                                      patch_upper(0),
+                                                      patch_lower(1),
+                                                      patch_upper(1),
+                                                      patch_lower(2),
+                                                      patch_upper(2),
+                                                      U_data_gcw(0),
+                                                      U_data_gcw(1),
+                                                      U_data_gcw(2),
+                                                      U_data->getPointer(0),
+                                                      U_data->getPointer(1),
+                                                      U_data->getPointer(2),
+                                                      N_data_gcw(0),
+                                                      N_data_gcw(1),
+                                                      N_data_gcw(2),
+                                                      N_data->getPointer(0),
+                                                      N_data->getPointer(1),
+                                                      N_data->getPointer(2)
+#endif
+                                                      );
+            break;
+        case SKEW_SYMMETRIC:
+            NAVIER_STOKES_STAGGERED_SKEW_SYM_DERIVATIVE_FC(dx,
+#if (NDIM == 2)
+                                                           patch_lower(0),
+                                                           patch_upper(0),
+                                                           patch_lower(1),
+                                                           patch_upper(1),
+                                                           U_data_gcw(0),
+                                                           U_data_gcw(1),
+                                                           U_data->getPointer(0),
+                                                           U_data->getPointer(1),
+                                                           N_data_gcw(0),
+                                                           N_data_gcw(1),
+                                                           N_data->getPointer(0),
+                                                           N_data->getPointer(1)
+#endif
+#if (NDIM == 3)
+                                                           patch_lower(0),
+                                                           patch_upper(0),
+                                                           patch_lower(1),
+                                                           patch_upper(1),
+                                                           patch_lower(2),
+                                                           patch_upper(2),
+                                                           U_data_gcw(0),
+                                                           U_data_gcw(1),
+                                                           U_data_gcw(2),
+                                                           U_data->getPointer(0),
+                                                           U_data->getPointer(1),
+                                                           U_data->getPointer(2),
+                                                           N_data_gcw(0),
+                                                           N_data_gcw(1),
+                                                           N_data_gcw(2),
+                                                           N_data->getPointer(0),
+                                                           N_data->getPointer(1),
+                                                           N_data->getPointer(2)
+#endif
+                                                           );
+            break;
+        default:
+            TBOX_ERROR(
+                "INSStaggeredCenteredConvectiveOperator::applyConvectiveOperator():\n"
+                << "  unsupported differencing form: "
+                << enum_to_string<ConvectiveDifferencingType>(d_difference_form) << " \n"
+                << "  valid choices are: ADVECTIVE, CONSERVATIVE, SKEW_SYMMETRIC\n");
+        }
+        return;
+    } // operator()
+
+private:
+    const int d_N_idx, d_U_idx;
+    const ConvectiveDifferencingType d_difference_form;
+};
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -324,151 +483,11 @@ void INSStaggeredCenteredConvectiveOperator::applyConvectiveOperator(const int U
     d_hier_bdry_fill->resetTransactionComponents(d_transaction_comps);
 
     // Compute the convective derivative.
+    const ConvectiveDerivativeTask convective_derivative_task(
+        N_idx, d_U_scratch_idx, d_difference_form);
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            const Pointer<CartesianPatchGeometry<NDIM> > patch_geom =
-                patch->getPatchGeometry();
-            const double* const dx = patch_geom->getDx();
-
-            const Box<NDIM>& patch_box = patch->getBox();
-            const IntVector<NDIM>& patch_lower = patch_box.lower();
-            const IntVector<NDIM>& patch_upper = patch_box.upper();
-
-            Pointer<SideData<NDIM, double> > N_data = patch->getPatchData(N_idx);
-            Pointer<SideData<NDIM, double> > U_data = patch->getPatchData(d_U_scratch_idx);
-
-            const IntVector<NDIM>& N_data_gcw = N_data->getGhostCellWidth();
-            const IntVector<NDIM>& U_data_gcw = U_data->getGhostCellWidth();
-
-            switch (d_difference_form)
-            {
-            case CONSERVATIVE:
-                NAVIER_STOKES_STAGGERED_DIV_DERIVATIVE_FC(dx,
-#if (NDIM == 2)
-                                                          patch_lower(0),
-                                                          patch_upper(0),
-                                                          patch_lower(1),
-                                                          patch_upper(1),
-                                                          U_data_gcw(0),
-                                                          U_data_gcw(1),
-                                                          U_data->getPointer(0),
-                                                          U_data->getPointer(1),
-                                                          N_data_gcw(0),
-                                                          N_data_gcw(1),
-                                                          N_data->getPointer(0),
-                                                          N_data->getPointer(1)
-#endif
-#if (NDIM == 3)
-                                                          patch_lower(0),
-                                                          patch_upper(0),
-                                                          patch_lower(1),
-                                                          patch_upper(1),
-                                                          patch_lower(2),
-                                                          patch_upper(2),
-                                                          U_data_gcw(0),
-                                                          U_data_gcw(1),
-                                                          U_data_gcw(2),
-                                                          U_data->getPointer(0),
-                                                          U_data->getPointer(1),
-                                                          U_data->getPointer(2),
-                                                          N_data_gcw(0),
-                                                          N_data_gcw(1),
-                                                          N_data_gcw(2),
-                                                          N_data->getPointer(0),
-                                                          N_data->getPointer(1),
-                                                          N_data->getPointer(2)
-#endif
-                                                          );
-                break;
-            case ADVECTIVE:
-                NAVIER_STOKES_STAGGERED_ADV_DERIVATIVE_FC(dx,
-#if (NDIM == 2)
-                                                          patch_lower(0),
-                                                          patch_upper(0),
-                                                          patch_lower(1),
-                                                          patch_upper(1),
-                                                          U_data_gcw(0),
-                                                          U_data_gcw(1),
-                                                          U_data->getPointer(0),
-                                                          U_data->getPointer(1),
-                                                          N_data_gcw(0),
-                                                          N_data_gcw(1),
-                                                          N_data->getPointer(0),
-                                                          N_data->getPointer(1)
-#endif
-#if (NDIM == 3)
-                                                          patch_lower(0),
-                                                          patch_upper(0),
-                                                          patch_lower(1),
-                                                          patch_upper(1),
-                                                          patch_lower(2),
-                                                          patch_upper(2),
-                                                          U_data_gcw(0),
-                                                          U_data_gcw(1),
-                                                          U_data_gcw(2),
-                                                          U_data->getPointer(0),
-                                                          U_data->getPointer(1),
-                                                          U_data->getPointer(2),
-                                                          N_data_gcw(0),
-                                                          N_data_gcw(1),
-                                                          N_data_gcw(2),
-                                                          N_data->getPointer(0),
-                                                          N_data->getPointer(1),
-                                                          N_data->getPointer(2)
-#endif
-                                                          );
-                break;
-            case SKEW_SYMMETRIC:
-                NAVIER_STOKES_STAGGERED_SKEW_SYM_DERIVATIVE_FC(dx,
-#if (NDIM == 2)
-                                                               patch_lower(0),
-                                                               patch_upper(0),
-                                                               patch_lower(1),
-                                                               patch_upper(1),
-                                                               U_data_gcw(0),
-                                                               U_data_gcw(1),
-                                                               U_data->getPointer(0),
-                                                               U_data->getPointer(1),
-                                                               N_data_gcw(0),
-                                                               N_data_gcw(1),
-                                                               N_data->getPointer(0),
-                                                               N_data->getPointer(1)
-#endif
-#if (NDIM == 3)
-                                                               patch_lower(0),
-                                                               patch_upper(0),
-                                                               patch_lower(1),
-                                                               patch_upper(1),
-                                                               patch_lower(2),
-                                                               patch_upper(2),
-                                                               U_data_gcw(0),
-                                                               U_data_gcw(1),
-                                                               U_data_gcw(2),
-                                                               U_data->getPointer(0),
-                                                               U_data->getPointer(1),
-                                                               U_data->getPointer(2),
-                                                               N_data_gcw(0),
-                                                               N_data_gcw(1),
-                                                               N_data_gcw(2),
-                                                               N_data->getPointer(0),
-                                                               N_data->getPointer(1),
-                                                               N_data->getPointer(2)
-#endif
-                                                               );
-                break;
-            default:
-                TBOX_ERROR(
-                    "INSStaggeredCenteredConvectiveOperator::applyConvectiveOperator():\n"
-                    << "  unsupported differencing form: "
-                    << enum_to_string<ConvectiveDifferencingType>(d_difference_form) << " \n"
-                    << "  valid choices are: ADVECTIVE, CONSERVATIVE, SKEW_SYMMETRIC\n");
-            }
-        }
+        PatchTaskExecutor::execute(convective_derivative_task, d_hierarchy->getPatchLevel(ln));
     }
 
     IBAMR_TIMER_STOP(t_apply_convective_operator);
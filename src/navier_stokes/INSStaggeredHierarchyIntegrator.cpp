@@ -452,6 +452,15 @@ INSStaggeredHierarchyIntegrator::INSStaggeredHierarchyIntegrator(
         d_regrid_projection_precond_type =
             input_db->getString("regrid_projection_precond_type");
 
+    // The regrid projection uses homogeneous Neumann boundary conditions for
+    // the projection potential Phi.
+    d_regrid_projection_bc_coef = new LocationIndexRobinBcCoefs<NDIM>();
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        d_regrid_projection_bc_coef->setBoundarySlope(2 * d, 0.0);
+        d_regrid_projection_bc_coef->setBoundarySlope(2 * d + 1, 0.0);
+    }
+
     // Check to make sure the time stepping types are supported.
     switch (d_viscous_time_stepping_type)
     {
@@ -558,6 +567,7 @@ INSStaggeredHierarchyIntegrator::INSStaggeredHierarchyIntegrator(
     d_Omega_var = new CellVariable<NDIM, double>(d_object_name + "::Omega", NDIM);
 #endif
     d_Div_U_var = new CellVariable<NDIM, double>(d_object_name + "::Div_U");
+    d_Phi_var = new CellVariable<NDIM, double>(d_object_name + "::Phi");
 
 #if (NDIM == 3)
     d_Omega_Norm_var = new CellVariable<NDIM, double>(d_object_name + "::|Omega|_2");
@@ -582,6 +592,9 @@ INSStaggeredHierarchyIntegrator::~INSStaggeredHierarchyIntegrator()
     d_fill_after_regrid_phys_bdry_bc_op = NULL;
     d_velocity_solver.setNull();
     d_pressure_solver.setNull();
+    d_regrid_projection_solver.setNull();
+    delete d_regrid_projection_bc_coef;
+    d_regrid_projection_bc_coef = NULL;
     if (d_U_rhs_vec) d_U_rhs_vec->freeVectorComponents();
     if (d_U_adv_vec) d_U_adv_vec->freeVectorComponents();
     if (d_N_vec) d_N_vec->freeVectorComponents();
@@ -852,6 +865,17 @@ void INSStaggeredHierarchyIntegrator::initializeHierarchyIntegrator(
                      "CONSERVATIVE_COARSEN",
                      "SPECIALIZED_LINEAR_REFINE");
 
+    // The regrid projection potential is maintained as the patch hierarchy
+    // evolves so that it may be used as the initial guess for the next regrid
+    // projection.
+    registerVariable(d_Phi_current_idx,
+                     d_Phi_new_idx,
+                     d_Phi_scratch_idx,
+                     d_Phi_var,
+                     cell_ghosts,
+                     "CONSERVATIVE_COARSEN",
+                     "LINEAR_REFINE");
+
     d_rho_var = INSHierarchyIntegrator::d_rho_var;
     if (INSHierarchyIntegrator::d_rho_var && !d_rho_var)
     {
@@ -1169,6 +1193,7 @@ void INSStaggeredHierarchyIntegrator::preprocessIntegrateHierarchy(const double
     // Set the initial guess.
     d_hier_sc_data_ops->copyData(d_U_new_idx, d_U_current_idx);
     d_hier_cc_data_ops->copyData(d_P_new_idx, d_P_current_idx);
+    d_hier_cc_data_ops->copyData(d_Phi_new_idx, d_Phi_current_idx);
 
     // Set up inhomogeneous BCs.
     d_stokes_solver->setHomogeneousBc(false);
@@ -2029,6 +2054,24 @@ void INSStaggeredHierarchyIntegrator::resetHierarchyConfigurationSpecialized(
     return;
 } // resetHierarchyConfigurationSpecialized
 
+void INSStaggeredHierarchyIntegrator::resetIntegratorToPreadvanceStateSpecialized()
+{
+    // Deallocate the solver vectors.
+    d_U_rhs_vec->deallocateVectorData();
+    d_U_adv_vec->deallocateVectorData();
+    d_N_vec->deallocateVectorData();
+    d_P_rhs_vec->deallocateVectorData();
+
+    // Deallocate the scratch and new data.
+    INSHierarchyIntegrator::resetIntegratorToPreadvanceStateSpecialized();
+    return;
+} // resetIntegratorToPreadvanceStateSpecialized
+
+bool INSStaggeredHierarchyIntegrator::canResetIntegratorToPreadvanceStateSpecialized() const
+{
+    return true;
+} // canResetIntegratorToPreadvanceStateSpecialized
+
 void INSStaggeredHierarchyIntegrator::applyGradientDetectorSpecialized(
     const Pointer<BasePatchHierarchy<NDIM> > hierarchy,
     const int level_number,
@@ -2196,9 +2239,24 @@ void INSStaggeredHierarchyIntegrator::regridProjection()
         d_object_name + "::rhs_vec", d_hierarchy, coarsest_ln, finest_ln);
     rhs_vec.addComponent(d_Div_U_var, d_Div_U_idx, wgt_cc_idx, d_hier_cc_data_ops);
 
-    // Setup the regrid Poisson solver.
-    Pointer<PoissonSolver> regrid_projection_solver =
-        CCPoissonSolverManager::getManager()->allocateSolver(
+    // Allocate temporary data.
+    ComponentSelector scratch_idxs;
+    scratch_idxs.setFlag(d_U_scratch_idx);
+    scratch_idxs.setFlag(d_P_scratch_idx);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        level->allocatePatchData(scratch_idxs, d_integrator_time);
+    }
+
+    // Setup the regrid Poisson solver.  The solver object is allocated only
+    // once, but its state is initialized and deallocated by every solve because
+    // it is bound to the patch levels of the current hierarchy configuration.
+    // The projection potential computed by the previous regrid projection,
+    // carried over to the new patch hierarchy, is used as the initial guess.
+    if (!d_regrid_projection_solver)
+    {
+        d_regrid_projection_solver = CCPoissonSolverManager::getManager()->allocateSolver(
             d_regrid_projection_solver_type,
             d_object_name + "::regrid_projection_solver",
             d_regrid_projection_solver_db,
@@ -2207,37 +2265,22 @@ void INSStaggeredHierarchyIntegrator::regridProjection()
             d_object_name + "::regrid_projection_precond",
             d_regrid_projection_precond_db,
             "regrid_projection_pc_");
+        LinearSolver* p_regrid_projection_solver =
+            dynamic_cast<LinearSolver*>(d_regrid_projection_solver.getPointer());
+        if (p_regrid_projection_solver)
+        {
+            p_regrid_projection_solver->setInitialGuessNonzero(true);
+            p_regrid_projection_solver->setNullspace(true);
+        }
+    }
     PoissonSpecifications regrid_projection_spec(d_object_name + "::regrid_projection_spec");
     regrid_projection_spec.setCZero();
     regrid_projection_spec.setDConstant(-1.0);
-    LocationIndexRobinBcCoefs<NDIM> Phi_bc_coef;
-    for (unsigned int d = 0; d < NDIM; ++d)
-    {
-        Phi_bc_coef.setBoundarySlope(2 * d, 0.0);
-        Phi_bc_coef.setBoundarySlope(2 * d + 1, 0.0);
-    }
-    regrid_projection_solver->setPoissonSpecifications(regrid_projection_spec);
-    regrid_projection_solver->setPhysicalBcCoef(&Phi_bc_coef);
-    regrid_projection_solver->setHomogeneousBc(true);
-    regrid_projection_solver->setSolutionTime(d_integrator_time);
-    regrid_projection_solver->setTimeInterval(d_integrator_time, d_integrator_time);
-    LinearSolver* p_regrid_projection_solver =
-        dynamic_cast<LinearSolver*>(regrid_projection_solver.getPointer());
-    if (p_regrid_projection_solver)
-    {
-        p_regrid_projection_solver->setInitialGuessNonzero(false);
-        p_regrid_projection_solver->setNullspace(true);
-    }
-
-    // Allocate temporary data.
-    ComponentSelector scratch_idxs;
-    scratch_idxs.setFlag(d_U_scratch_idx);
-    scratch_idxs.setFlag(d_P_scratch_idx);
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(scratch_idxs, d_integrator_time);
-    }
+    d_regrid_projection_solver->setPoissonSpecifications(regrid_projection_spec);
+    d_regrid_projection_solver->setPhysicalBcCoef(d_regrid_projection_bc_coef);
+    d_regrid_projection_solver->setHomogeneousBc(true);
+    d_regrid_projection_solver->setSolutionTime(d_integrator_time);
+    d_regrid_projection_solver->setTimeInterval(d_integrator_time, d_integrator_time);
 
     // Setup the right-hand-side vector for the projection-Poisson solve.
     d_hier_math_ops->div(d_Div_U_idx,
@@ -2255,16 +2298,19 @@ void INSStaggeredHierarchyIntegrator::regridProjection()
         (1.0 / volume) * d_hier_cc_data_ops->integral(d_Div_U_idx, wgt_cc_idx);
     d_hier_cc_data_ops->addScalar(d_Div_U_idx, d_Div_U_idx, -Div_U_mean);
 
-    // Solve the projection pressure-Poisson problem.
-    regrid_projection_solver->solveSystem(sol_vec, rhs_vec);
+    // Solve the projection pressure-Poisson problem, and store the projection
+    // potential for use by the next regrid projection.
+    d_hier_cc_data_ops->copyData(d_P_scratch_idx, d_Phi_current_idx);
+    d_regrid_projection_solver->solveSystem(sol_vec, rhs_vec);
+    d_hier_cc_data_ops->copyData(d_Phi_current_idx, d_P_scratch_idx);
     if (d_enable_logging)
         plog << d_object_name
              << "::regridProjection(): regrid projection solve number of iterations = "
-             << regrid_projection_solver->getNumIterations() << "\n";
+             << d_regrid_projection_solver->getNumIterations() << "\n";
     if (d_enable_logging)
         plog << d_object_name
              << "::regridProjection(): regrid projection solve residual norm        = "
-             << regrid_projection_solver->getResidualNorm() << "\n";
+             << d_regrid_projection_solver->getResidualNorm() << "\n";
 
     // Fill ghost cells for Phi, compute Grad Phi, and set U := U - Grad Phi
     typedef HierarchyGhostCellInterpolation::InterpolationTransactionComponent
@@ -2275,7 +2321,7 @@ void INSStaggeredHierarchyIntegrator::regridProjection()
                                                        DATA_COARSEN_TYPE,
                                                        d_bdry_extrap_type,
                                                        CONSISTENT_TYPE_2_BDRY,
-                                                       &Phi_bc_coef);
+                                                       d_regrid_projection_bc_coef);
     Pointer<HierarchyGhostCellInterpolation> Phi_bdry_bc_fill_op =
         new HierarchyGhostCellInterpolation();
     Phi_bdry_bc_fill_op->initializeOperatorState(Phi_bc_component, d_hierarchy);
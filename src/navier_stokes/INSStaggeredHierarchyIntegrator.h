@@ -80,6 +80,11 @@ namespace mesh
 template <int DIM>
 class GriddingAlgorithm;
 } // namespace mesh
+namespace solv
+{
+template <int DIM>
+class LocationIndexRobinBcCoefs;
+} // namespace solv
 } // namespace SAMRAI
 
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
@@ -251,6 +256,19 @@ protected:
         int coarsest_level,
         int finest_level);
 
+    /*!
+     * Deallocate the solver vectors allocated by preprocessIntegrateHierarchy(),
+     * and reset the hierarchy integrator to the state at the beginning of the
+     * current time step.
+     */
+    void resetIntegratorToPreadvanceStateSpecialized();
+
+    /*!
+     * Indicate that the integrator can be reset to the state at the beginning
+     * of the current time step.
+     */
+    bool canResetIntegratorToPreadvanceStateSpecialized() const;
+
     /*!
      * Set integer tags to "one" in cells where refinement of the given level
      * should occur according to the magnitude of the fluid vorticity.
@@ -358,6 +376,14 @@ private:
     SAMRAI::tbox::Pointer<StaggeredStokesSolver> d_stokes_solver;
     bool d_stokes_solver_needs_init;
 
+    /*
+     * Solver used to project the velocity field following regridding.  The
+     * solver object is retained, but its state is rebuilt for each solve.  The
+     * previous projection potential is used as the initial guess.
+     */
+    SAMRAI::tbox::Pointer<IBTK::PoissonSolver> d_regrid_projection_solver;
+    SAMRAI::solv::LocationIndexRobinBcCoefs<NDIM>* d_regrid_projection_bc_coef;
+
     /*!
      * Fluid solver variables.
      */
@@ -371,6 +397,7 @@ private:
 
     SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > d_Omega_var;
     SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > d_Div_U_var;
+    SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > d_Phi_var;
 
     SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > d_Omega_Norm_var;
     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > d_U_regrid_var;
@@ -393,6 +420,7 @@ private:
     int d_Q_current_idx, d_Q_new_idx, d_Q_scratch_idx;
     int d_N_old_current_idx, d_N_old_new_idx, d_N_old_scratch_idx;
     int d_rho_current_idx, d_rho_new_idx, d_rho_scratch_idx;
+    int d_Phi_current_idx, d_Phi_new_idx, d_Phi_scratch_idx;
 
     /*
      * Patch data descriptor indices for all "plot" variables managed by the
@@ -37,7 +37,6 @@
 
 #include "Box.h"
 #include "CartesianPatchGeometry.h"
-#include "FaceData.h"
 #include "IBAMR_config.h"
 #include "INSStaggeredPPMConvectiveOperator.h"
 #include "Index.h"
@@ -69,370 +68,76 @@ class RobinBcCoefStrategy;
 
 // FORTRAN ROUTINES
 #if (NDIM == 2)
-#define ADVECT_DERIVATIVE_FC IBAMR_FC_FUNC_(advect_derivative2d, ADVECT_DERIVATIVE2D)
-#define CONVECT_DERIVATIVE_FC IBAMR_FC_FUNC_(convect_derivative2d, CONVECT_DERIVATIVE2D)
-#define GODUNOV_EXTRAPOLATE_FC IBAMR_FC_FUNC_(godunov_extrapolate2d, GODUNOV_EXTRAPOLATE2D)
-#define NAVIER_STOKES_INTERP_COMPS_FC                                                         \
-    IBAMR_FC_FUNC_(navier_stokes_interp_comps2d, NAVIER_STOKES_INTERP_COMPS2D)
-#define NAVIER_STOKES_RESET_ADV_VELOCITY_FC                                                   \
-    IBAMR_FC_FUNC_(navier_stokes_reset_adv_velocity2d, NAVIER_STOKES_RESET_ADV_VELOCITY2D)
-#define SKEW_SYM_DERIVATIVE_FC IBAMR_FC_FUNC_(skew_sym_derivative2d, SKEW_SYM_DERIVATIVE2D)
+#define NAVIER_STOKES_STAGGERED_PPM_DERIVATIVE_FC                                             \
+    IBAMR_FC_FUNC_(navier_stokes_staggered_ppm_derivative2d,                                  \
+                   NAVIER_STOKES_STAGGERED_PPM_DERIVATIVE2D)
 #endif
 
 #if (NDIM == 3)
-#define ADVECT_DERIVATIVE_FC IBAMR_FC_FUNC_(advect_derivative3d, ADVECT_DERIVATIVE3D)
-#define CONVECT_DERIVATIVE_FC IBAMR_FC_FUNC_(convect_derivative3d, CONVECT_DERIVATIVE3D)
-#define GODUNOV_EXTRAPOLATE_FC IBAMR_FC_FUNC_(godunov_extrapolate3d, GODUNOV_EXTRAPOLATE3D)
-#define NAVIER_STOKES_INTERP_COMPS_FC                                                         \
-    IBAMR_FC_FUNC_(navier_stokes_interp_comps3d, NAVIER_STOKES_INTERP_COMPS3D)
-#define NAVIER_STOKES_RESET_ADV_VELOCITY_FC                                                   \
-    IBAMR_FC_FUNC_(navier_stokes_reset_adv_velocity3d, NAVIER_STOKES_RESET_ADV_VELOCITY3D)
-#define SKEW_SYM_DERIVATIVE_FC IBAMR_FC_FUNC_(skew_sym_derivative3d, SKEW_SYM_DERIVATIVE3D)
+#define NAVIER_STOKES_STAGGERED_PPM_DERIVATIVE_FC                                             \
+    IBAMR_FC_FUNC_(navier_stokes_staggered_ppm_derivative3d,                                  \
+                   NAVIER_STOKES_STAGGERED_PPM_DERIVATIVE3D)
 #endif
 
 extern "C" {
-void ADVECT_DERIVATIVE_FC(const double*,
+void NAVIER_STOKES_STAGGERED_PPM_DERIVATIVE_FC(const double*,
+                                               const int&,
 #if (NDIM == 2)
-                          const int&,
-                          const int&,
-                          const int&,
-                          const int&,
-                          const int&,
-                          const int&,
-                          const int&,
-                          const int&,
-                          const double*,
-                          const double*,
-                          const double*,
-                          const double*,
-                          const int&,
-                          const int&,
+                                               const int&,
+                                               const int&,
+                                               const int&,
+                                               const int&,
+                                               const int&,
+                                               const int&,
+                                               const double*,
+                                               const double*,
+                                               double*,
+                                               double*,
+                                               double*,
+                                               double*,
+                                               double*,
+                                               double*,
+                                               double*,
+                                               double*,
+                                               double*,
+                                               const int&,
+                                               const int&,
+                                               double*,
 #endif
 #if (NDIM == 3)
-                          const int&,
-                          const int&,
-                          const int&,
-                          const int&,
-                          const int&,
-                          const int&,
-                          const int&,
-                          const int&,
-                          const int&,
-                          const int&,
-                          const int&,
-                          const int&,
-                          const double*,
-                          const double*,
-                          const double*,
-                          const double*,
-                          const double*,
-                          const double*,
-                          const int&,
-                          const int&,
-                          const int&,
+                                               const int&,
+                                               const int&,
+                                               const int&,
+                                               const int&,
+                                               const int&,
+                                               const int&,
+                                               const int&,
+                                               const int&,
+                                               const int&,
+                                               const double*,
+                                               const double*,
+                                               const double*,
+                                               double*,
+                                               double*,
+                                               double*,
+                                               double*,
+                                               double*,
+                                               double*,
+                                               double*,
+                                               double*,
+                                               double*,
+                                               double*,
+                                               double*,
+                                               double*,
+                                               double*,
+                                               double*,
+                                               const int&,
+                                               const int&,
+                                               const int&,
+                                               double*,
+                                               double*,
 #endif
-                          double*);
-
-void CONVECT_DERIVATIVE_FC(const double*,
-#if (NDIM == 2)
-                           const int&,
-                           const int&,
-                           const int&,
-                           const int&,
-                           const int&,
-                           const int&,
-                           const int&,
-                           const int&,
-                           const double*,
-                           const double*,
-                           const double*,
-                           const double*,
-                           const int&,
-                           const int&,
-#endif
-#if (NDIM == 3)
-                           const int&,
-                           const int&,
-                           const int&,
-                           const int&,
-                           const int&,
-                           const int&,
-                           const int&,
-                           const int&,
-                           const int&,
-                           const int&,
-                           const int&,
-                           const int&,
-                           const double*,
-                           const double*,
-                           const double*,
-                           const double*,
-                           const double*,
-                           const double*,
-                           const int&,
-                           const int&,
-                           const int&,
-#endif
-                           double*);
-
-void GODUNOV_EXTRAPOLATE_FC(
-#if (NDIM == 2)
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const double*,
-    double*,
-    double*,
-    double*,
-    double*,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const double*,
-    const double*,
-    double*,
-    double*
-#endif
-#if (NDIM == 3)
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const double*,
-    double*,
-    double*,
-    double*,
-    double*,
-    double*,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const double*,
-    const double*,
-    const double*,
-    double*,
-    double*,
-    double*
-#endif
-    );
-
-void NAVIER_STOKES_INTERP_COMPS_FC(
-#if (NDIM == 2)
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const double*,
-    const double*,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    double*,
-    double*,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    double*,
-    double*
-#endif
-#if (NDIM == 3)
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const double*,
-    const double*,
-    const double*,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    double*,
-    double*,
-    double*,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    double*,
-    double*,
-    double*,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    double*,
-    double*,
-    double*
-#endif
-    );
-
-void NAVIER_STOKES_RESET_ADV_VELOCITY_FC(
-#if (NDIM == 2)
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    double*,
-    double*,
-    const int&,
-    const int&,
-    const double*,
-    const double*,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    double*,
-    double*,
-    const int&,
-    const int&,
-    const double*,
-    const double*
-#endif
-#if (NDIM == 3)
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    double*,
-    double*,
-    double*,
-    const int&,
-    const int&,
-    const int&,
-    const double*,
-    const double*,
-    const double*,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    double*,
-    double*,
-    double*,
-    const int&,
-    const int&,
-    const int&,
-    const double*,
-    const double*,
-    const double*,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    const int&,
-    double*,
-    double*,
-    double*,
-    const int&,
-    const int&,
-    const int&,
-    const double*,
-    const double*,
-    const double*
-#endif
-    );
-
-void SKEW_SYM_DERIVATIVE_FC(const double*,
-#if (NDIM == 2)
-                            const int&,
-                            const int&,
-                            const int&,
-                            const int&,
-                            const int&,
-                            const int&,
-                            const int&,
-                            const int&,
-                            const double*,
-                            const double*,
-                            const double*,
-                            const double*,
-                            const int&,
-                            const int&,
-#endif
-#if (NDIM == 3)
-                            const int&,
-                            const int&,
-                            const int&,
-                            const int&,
-                            const int&,
-                            const int&,
-                            const int&,
-                            const int&,
-                            const int&,
-                            const int&,
-                            const int&,
-                            const int&,
-                            const double*,
-                            const double*,
-                            const double*,
-                            const double*,
-                            const double*,
-                            const double*,
-                            const int&,
-                            const int&,
-                            const int&,
-#endif
-                            double*);
+                                               double*);
 }
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -557,6 +262,25 @@ void INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx,
     d_hier_bdry_fill->resetTransactionComponents(d_transaction_comps);
 
     // Compute the convective derivative.
+    int difference_form = -1;
+    switch (d_difference_form)
+    {
+    case ADVECTIVE:
+        difference_form = 0;
+        break;
+    case CONSERVATIVE:
+        difference_form = 1;
+        break;
+    case SKEW_SYMMETRIC:
+        difference_form = 2;
+        break;
+    default:
+        TBOX_ERROR("INSStaggeredPPMConvectiveOperator::applyConvectiveOperator():\n"
+                   << "  unsupported differencing form: "
+                   << enum_to_string<ConvectiveDifferencingType>(d_difference_form)
+                   << " \n"
+                   << "  valid choices are: ADVECTIVE, CONSERVATIVE, SKEW_SYMMETRIC\n");
+    }
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
@@ -575,387 +299,93 @@ void INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx,
             Pointer<SideData<NDIM, double> > N_data = patch->getPatchData(N_idx);
             Pointer<SideData<NDIM, double> > U_data = patch->getPatchData(d_U_scratch_idx);
 
-            const IntVector<NDIM> ghosts = IntVector<NDIM>(1);
-            boost::array<Box<NDIM>, NDIM> side_boxes;
-            boost::array<Pointer<FaceData<NDIM, double> >, NDIM> U_adv_data;
-            boost::array<Pointer<FaceData<NDIM, double> >, NDIM> U_half_data;
-            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            // The predicted face values are computed one pencil at a time and
+            // the derivative is evaluated directly from them, so the only
+            // patch-sized temporaries are the predicted values themselves.
+            boost::array<boost::array<double*, NDIM>, NDIM> U_half;
+            for (unsigned int comp = 0; comp < NDIM; ++comp)
             {
-                side_boxes[axis] = SideGeometry<NDIM>::toSideBox(patch_box, axis);
-                U_adv_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
-                U_half_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
-            }
-#if (NDIM == 2)
-            NAVIER_STOKES_INTERP_COMPS_FC(patch_lower(0),
-                                          patch_upper(0),
-                                          patch_lower(1),
-                                          patch_upper(1),
-                                          U_data->getGhostCellWidth()(0),
-                                          U_data->getGhostCellWidth()(1),
-                                          U_data->getPointer(0),
-                                          U_data->getPointer(1),
-                                          side_boxes[0].lower(0),
-                                          side_boxes[0].upper(0),
-                                          side_boxes[0].lower(1),
-                                          side_boxes[0].upper(1),
-                                          U_adv_data[0]->getGhostCellWidth()(0),
-                                          U_adv_data[0]->getGhostCellWidth()(1),
-                                          U_adv_data[0]->getPointer(0),
-                                          U_adv_data[0]->getPointer(1),
-                                          side_boxes[1].lower(0),
-                                          side_boxes[1].upper(0),
-                                          side_boxes[1].lower(1),
-                                          side_boxes[1].upper(1),
-                                          U_adv_data[1]->getGhostCellWidth()(0),
-                                          U_adv_data[1]->getGhostCellWidth()(1),
-                                          U_adv_data[1]->getPointer(0),
-                                          U_adv_data[1]->getPointer(1));
-#endif
-#if (NDIM == 3)
-            NAVIER_STOKES_INTERP_COMPS_FC(patch_lower(0),
-                                          patch_upper(0),
-                                          patch_lower(1),
-                                          patch_upper(1),
-                                          patch_lower(2),
-                                          patch_upper(2),
-                                          U_data->getGhostCellWidth()(0),
-                                          U_data->getGhostCellWidth()(1),
-                                          U_data->getGhostCellWidth()(2),
-                                          U_data->getPointer(0),
-                                          U_data->getPointer(1),
-                                          U_data->getPointer(2),
-                                          side_boxes[0].lower(0),
-                                          side_boxes[0].upper(0),
-                                          side_boxes[0].lower(1),
-                                          side_boxes[0].upper(1),
-                                          side_boxes[0].lower(2),
-                                          side_boxes[0].upper(2),
-                                          U_adv_data[0]->getGhostCellWidth()(0),
-                                          U_adv_data[0]->getGhostCellWidth()(1),
-                                          U_adv_data[0]->getGhostCellWidth()(2),
-                                          U_adv_data[0]->getPointer(0),
-                                          U_adv_data[0]->getPointer(1),
-                                          U_adv_data[0]->getPointer(2),
-                                          side_boxes[1].lower(0),
-                                          side_boxes[1].upper(0),
-                                          side_boxes[1].lower(1),
-                                          side_boxes[1].upper(1),
-                                          side_boxes[1].lower(2),
-                                          side_boxes[1].upper(2),
-                                          U_adv_data[1]->getGhostCellWidth()(0),
-                                          U_adv_data[1]->getGhostCellWidth()(1),
-                                          U_adv_data[1]->getGhostCellWidth()(2),
-                                          U_adv_data[1]->getPointer(0),
-                                          U_adv_data[1]->getPointer(1),
-                                          U_adv_data[1]->getPointer(2),
-                                          side_boxes[2].lower(0),
-                                          side_boxes[2].upper(0),
-                                          side_boxes[2].lower(1),
-                                          side_boxes[2].upper(1),
-                                          side_boxes[2].lower(2),
-                                          side_boxes[2].upper(2),
-                                          U_adv_data[2]->getGhostCellWidth()(0),
-                                          U_adv_data[2]->getGhostCellWidth()(1),
-                                          U_adv_data[2]->getGhostCellWidth()(2),
-                                          U_adv_data[2]->getPointer(0),
-                                          U_adv_data[2]->getPointer(1),
-                                          U_adv_data[2]->getPointer(2));
-#endif
-            for (unsigned int axis = 0; axis < NDIM; ++axis)
-            {
-                Pointer<SideData<NDIM, double> > dU_data = new SideData<NDIM, double>(
-                    U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_L_data = new SideData<NDIM, double>(
-                    U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_R_data = new SideData<NDIM, double>(
-                    U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_scratch1_data = new SideData<NDIM, double>(
-                    U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-#if (NDIM == 3)
-                Pointer<SideData<NDIM, double> > U_scratch2_data = new SideData<NDIM, double>(
-                    U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-#endif
-#if (NDIM == 2)
-                GODUNOV_EXTRAPOLATE_FC(side_boxes[axis].lower(0),
-                                       side_boxes[axis].upper(0),
-                                       side_boxes[axis].lower(1),
-                                       side_boxes[axis].upper(1),
-                                       U_data->getGhostCellWidth()(0),
-                                       U_data->getGhostCellWidth()(1),
-                                       U_data->getPointer(axis),
-                                       U_scratch1_data->getPointer(axis),
-                                       dU_data->getPointer(axis),
-                                       U_L_data->getPointer(axis),
-                                       U_R_data->getPointer(axis),
-                                       U_adv_data[axis]->getGhostCellWidth()(0),
-                                       U_adv_data[axis]->getGhostCellWidth()(1),
-                                       U_half_data[axis]->getGhostCellWidth()(0),
-                                       U_half_data[axis]->getGhostCellWidth()(1),
-                                       U_adv_data[axis]->getPointer(0),
-                                       U_adv_data[axis]->getPointer(1),
-                                       U_half_data[axis]->getPointer(0),
-                                       U_half_data[axis]->getPointer(1));
-#endif
-#if (NDIM == 3)
-                GODUNOV_EXTRAPOLATE_FC(side_boxes[axis].lower(0),
-                                       side_boxes[axis].upper(0),
-                                       side_boxes[axis].lower(1),
-                                       side_boxes[axis].upper(1),
-                                       side_boxes[axis].lower(2),
-                                       side_boxes[axis].upper(2),
-                                       U_data->getGhostCellWidth()(0),
-                                       U_data->getGhostCellWidth()(1),
-                                       U_data->getGhostCellWidth()(2),
-                                       U_data->getPointer(axis),
-                                       U_scratch1_data->getPointer(axis),
-                                       U_scratch2_data->getPointer(axis),
-                                       dU_data->getPointer(axis),
-                                       U_L_data->getPointer(axis),
-                                       U_R_data->getPointer(axis),
-                                       U_adv_data[axis]->getGhostCellWidth()(0),
-                                       U_adv_data[axis]->getGhostCellWidth()(1),
-                                       U_adv_data[axis]->getGhostCellWidth()(2),
-                                       U_half_data[axis]->getGhostCellWidth()(0),
-                                       U_half_data[axis]->getGhostCellWidth()(1),
-                                       U_half_data[axis]->getGhostCellWidth()(2),
-                                       U_adv_data[axis]->getPointer(0),
-                                       U_adv_data[axis]->getPointer(1),
-                                       U_adv_data[axis]->getPointer(2),
-                                       U_half_data[axis]->getPointer(0),
-                                       U_half_data[axis]->getPointer(1),
-                                       U_half_data[axis]->getPointer(2));
-#endif
-            }
-#if (NDIM == 2)
-            NAVIER_STOKES_RESET_ADV_VELOCITY_FC(side_boxes[0].lower(0),
-                                                side_boxes[0].upper(0),
-                                                side_boxes[0].lower(1),
-                                                side_boxes[0].upper(1),
-                                                U_adv_data[0]->getGhostCellWidth()(0),
-                                                U_adv_data[0]->getGhostCellWidth()(1),
-                                                U_adv_data[0]->getPointer(0),
-                                                U_adv_data[0]->getPointer(1),
-                                                U_half_data[0]->getGhostCellWidth()(0),
-                                                U_half_data[0]->getGhostCellWidth()(1),
-                                                U_half_data[0]->getPointer(0),
-                                                U_half_data[0]->getPointer(1),
-                                                side_boxes[1].lower(0),
-                                                side_boxes[1].upper(0),
-                                                side_boxes[1].lower(1),
-                                                side_boxes[1].upper(1),
-                                                U_adv_data[1]->getGhostCellWidth()(0),
-                                                U_adv_data[1]->getGhostCellWidth()(1),
-                                                U_adv_data[1]->getPointer(0),
-                                                U_adv_data[1]->getPointer(1),
-                                                U_half_data[1]->getGhostCellWidth()(0),
-                                                U_half_data[1]->getGhostCellWidth()(1),
-                                                U_half_data[1]->getPointer(0),
-                                                U_half_data[1]->getPointer(1));
-#endif
-#if (NDIM == 3)
-            NAVIER_STOKES_RESET_ADV_VELOCITY_FC(side_boxes[0].lower(0),
-                                                side_boxes[0].upper(0),
-                                                side_boxes[0].lower(1),
-                                                side_boxes[0].upper(1),
-                                                side_boxes[0].lower(2),
-                                                side_boxes[0].upper(2),
-                                                U_adv_data[0]->getGhostCellWidth()(0),
-                                                U_adv_data[0]->getGhostCellWidth()(1),
-                                                U_adv_data[0]->getGhostCellWidth()(2),
-                                                U_adv_data[0]->getPointer(0),
-                                                U_adv_data[0]->getPointer(1),
-                                                U_adv_data[0]->getPointer(2),
-                                                U_half_data[0]->getGhostCellWidth()(0),
-                                                U_half_data[0]->getGhostCellWidth()(1),
-                                                U_half_data[0]->getGhostCellWidth()(2),
-                                                U_half_data[0]->getPointer(0),
-                                                U_half_data[0]->getPointer(1),
-                                                U_half_data[0]->getPointer(2),
-                                                side_boxes[1].lower(0),
-                                                side_boxes[1].upper(0),
-                                                side_boxes[1].lower(1),
-                                                side_boxes[1].upper(1),
-                                                side_boxes[1].lower(2),
-                                                side_boxes[1].upper(2),
-                                                U_adv_data[1]->getGhostCellWidth()(0),
-                                                U_adv_data[1]->getGhostCellWidth()(1),
-                                                U_adv_data[1]->getGhostCellWidth()(2),
-                                                U_adv_data[1]->getPointer(0),
-                                                U_adv_data[1]->getPointer(1),
-                                                U_adv_data[1]->getPointer(2),
-                                                U_half_data[1]->getGhostCellWidth()(0),
-                                                U_half_data[1]->getGhostCellWidth()(1),
-                                                U_half_data[1]->getGhostCellWidth()(2),
-                                                U_half_data[1]->getPointer(0),
-                                                U_half_data[1]->getPointer(1),
-                                                U_half_data[1]->getPointer(2),
-                                                side_boxes[2].lower(0),
-                                                side_boxes[2].upper(0),
-                                                side_boxes[2].lower(1),
-                                                side_boxes[2].upper(1),
-                                                side_boxes[2].lower(2),
-                                                side_boxes[2].upper(2),
-                                                U_adv_data[2]->getGhostCellWidth()(0),
-                                                U_adv_data[2]->getGhostCellWidth()(1),
-                                                U_adv_data[2]->getGhostCellWidth()(2),
-                                                U_adv_data[2]->getPointer(0),
-                                                U_adv_data[2]->getPointer(1),
-                                                U_adv_data[2]->getPointer(2),
-                                                U_half_data[2]->getGhostCellWidth()(0),
-                                                U_half_data[2]->getGhostCellWidth()(1),
-                                                U_half_data[2]->getGhostCellWidth()(2),
-                                                U_half_data[2]->getPointer(0),
-                                                U_half_data[2]->getPointer(1),
-                                                U_half_data[2]->getPointer(2));
-#endif
-            for (unsigned int axis = 0; axis < NDIM; ++axis)
-            {
-                switch (d_difference_form)
+                const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(patch_box, comp);
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
                 {
-                case CONSERVATIVE:
-#if (NDIM == 2)
-                    CONVECT_DERIVATIVE_FC(dx,
-                                          side_boxes[axis].lower(0),
-                                          side_boxes[axis].upper(0),
-                                          side_boxes[axis].lower(1),
-                                          side_boxes[axis].upper(1),
-                                          U_adv_data[axis]->getGhostCellWidth()(0),
-                                          U_adv_data[axis]->getGhostCellWidth()(1),
-                                          U_half_data[axis]->getGhostCellWidth()(0),
-                                          U_half_data[axis]->getGhostCellWidth()(1),
-                                          U_adv_data[axis]->getPointer(0),
-                                          U_adv_data[axis]->getPointer(1),
-                                          U_half_data[axis]->getPointer(0),
-                                          U_half_data[axis]->getPointer(1),
-                                          N_data->getGhostCellWidth()(0),
-                                          N_data->getGhostCellWidth()(1),
-                                          N_data->getPointer(axis));
-#endif
-#if (NDIM == 3)
-                    CONVECT_DERIVATIVE_FC(dx,
-                                          side_boxes[axis].lower(0),
-                                          side_boxes[axis].upper(0),
-                                          side_boxes[axis].lower(1),
-                                          side_boxes[axis].upper(1),
-                                          side_boxes[axis].lower(2),
-                                          side_boxes[axis].upper(2),
-                                          U_adv_data[axis]->getGhostCellWidth()(0),
-                                          U_adv_data[axis]->getGhostCellWidth()(1),
-                                          U_adv_data[axis]->getGhostCellWidth()(2),
-                                          U_half_data[axis]->getGhostCellWidth()(0),
-                                          U_half_data[axis]->getGhostCellWidth()(1),
-                                          U_half_data[axis]->getGhostCellWidth()(2),
-                                          U_adv_data[axis]->getPointer(0),
-                                          U_adv_data[axis]->getPointer(1),
-                                          U_adv_data[axis]->getPointer(2),
-                                          U_half_data[axis]->getPointer(0),
-                                          U_half_data[axis]->getPointer(1),
-                                          U_half_data[axis]->getPointer(2),
-                                          N_data->getGhostCellWidth()(0),
-                                          N_data->getGhostCellWidth()(1),
-                                          N_data->getGhostCellWidth()(2),
-                                          N_data->getPointer(axis));
-#endif
-                    break;
-                case ADVECTIVE:
-#if (NDIM == 2)
-                    ADVECT_DERIVATIVE_FC(dx,
-                                         side_boxes[axis].lower(0),
-                                         side_boxes[axis].upper(0),
-                                         side_boxes[axis].lower(1),
-                                         side_boxes[axis].upper(1),
-                                         U_adv_data[axis]->getGhostCellWidth()(0),
-                                         U_adv_data[axis]->getGhostCellWidth()(1),
-                                         U_half_data[axis]->getGhostCellWidth()(0),
-                                         U_half_data[axis]->getGhostCellWidth()(1),
-                                         U_adv_data[axis]->getPointer(0),
-                                         U_adv_data[axis]->getPointer(1),
-                                         U_half_data[axis]->getPointer(0),
-                                         U_half_data[axis]->getPointer(1),
-                                         N_data->getGhostCellWidth()(0),
-                                         N_data->getGhostCellWidth()(1),
-                                         N_data->getPointer(axis));
-#endif
-#if (NDIM == 3)
-                    ADVECT_DERIVATIVE_FC(dx,
-                                         side_boxes[axis].lower(0),
-                                         side_boxes[axis].upper(0),
-                                         side_boxes[axis].lower(1),
-                                         side_boxes[axis].upper(1),
-                                         side_boxes[axis].lower(2),
-                                         side_boxes[axis].upper(2),
-                                         U_adv_data[axis]->getGhostCellWidth()(0),
-                                         U_adv_data[axis]->getGhostCellWidth()(1),
-                                         U_adv_data[axis]->getGhostCellWidth()(2),
-                                         U_half_data[axis]->getGhostCellWidth()(0),
-                                         U_half_data[axis]->getGhostCellWidth()(1),
-                                         U_half_data[axis]->getGhostCellWidth()(2),
-                                         U_adv_data[axis]->getPointer(0),
-                                         U_adv_data[axis]->getPointer(1),
-                                         U_adv_data[axis]->getPointer(2),
-                                         U_half_data[axis]->getPointer(0),
-                                         U_half_data[axis]->getPointer(1),
-                                         U_half_data[axis]->getPointer(2),
-                                         N_data->getGhostCellWidth()(0),
-                                         N_data->getGhostCellWidth()(1),
-                                         N_data->getGhostCellWidth()(2),
-                                         N_data->getPointer(axis));
+                    const Box<NDIM> face_box = SideGeometry<NDIM>::toSideBox(side_box, axis);
+                    U_half[comp][axis] =
+                        d_scratch_pool.getBuffer(comp * NDIM + axis, face_box.size());
+                }
+            }
+            const IntVector<NDIM>& U_ghosts = U_data->getGhostCellWidth();
+#if !defined(NDEBUG)
+            TBOX_ASSERT(U_ghosts.min() >= GADVECTG);
 #endif
-                    break;
-                case SKEW_SYMMETRIC:
+            const size_t pencil_size =
+                patch_box.numberCells().max() + 2 * (U_ghosts.max() + 1);
+            double* const U_pencil = d_scratch_pool.getBuffer(NDIM * NDIM, pencil_size);
+            double* const U_adv_pencil =
+                d_scratch_pool.getBuffer(NDIM * NDIM + 1, pencil_size);
+            double* const dU_pencil = d_scratch_pool.getBuffer(NDIM * NDIM + 2, pencil_size);
+            double* const U_L_pencil = d_scratch_pool.getBuffer(NDIM * NDIM + 3, pencil_size);
+            double* const U_R_pencil = d_scratch_pool.getBuffer(NDIM * NDIM + 4, pencil_size);
 #if (NDIM == 2)
-                    SKEW_SYM_DERIVATIVE_FC(dx,
-                                           side_boxes[axis].lower(0),
-                                           side_boxes[axis].upper(0),
-                                           side_boxes[axis].lower(1),
-                                           side_boxes[axis].upper(1),
-                                           U_adv_data[axis]->getGhostCellWidth()(0),
-                                           U_adv_data[axis]->getGhostCellWidth()(1),
-                                           U_half_data[axis]->getGhostCellWidth()(0),
-                                           U_half_data[axis]->getGhostCellWidth()(1),
-                                           U_adv_data[axis]->getPointer(0),
-                                           U_adv_data[axis]->getPointer(1),
-                                           U_half_data[axis]->getPointer(0),
-                                           U_half_data[axis]->getPointer(1),
-                                           N_data->getGhostCellWidth()(0),
-                                           N_data->getGhostCellWidth()(1),
-                                           N_data->getPointer(axis));
+            NAVIER_STOKES_STAGGERED_PPM_DERIVATIVE_FC(dx,
+                                                      difference_form,
+                                                      patch_lower(0),
+                                                      patch_upper(0),
+                                                      patch_lower(1),
+                                                      patch_upper(1),
+                                                      U_ghosts(0),
+                                                      U_ghosts(1),
+                                                      U_data->getPointer(0),
+                                                      U_data->getPointer(1),
+                                                      U_half[0][0],
+                                                      U_half[0][1],
+                                                      U_half[1][0],
+                                                      U_half[1][1],
+                                                      U_pencil,
+                                                      U_adv_pencil,
+                                                      dU_pencil,
+                                                      U_L_pencil,
+                                                      U_R_pencil,
+                                                      N_data->getGhostCellWidth()(0),
+                                                      N_data->getGhostCellWidth()(1),
+                                                      N_data->getPointer(0),
+                                                      N_data->getPointer(1));
 #endif
 #if (NDIM == 3)
-                    SKEW_SYM_DERIVATIVE_FC(dx,
-                                           side_boxes[axis].lower(0),
-                                           side_boxes[axis].upper(0),
-                                           side_boxes[axis].lower(1),
-                                           side_boxes[axis].upper(1),
-                                           side_boxes[axis].lower(2),
-                                           side_boxes[axis].upper(2),
-                                           U_adv_data[axis]->getGhostCellWidth()(0),
-                                           U_adv_data[axis]->getGhostCellWidth()(1),
-                                           U_adv_data[axis]->getGhostCellWidth()(2),
-                                           U_half_data[axis]->getGhostCellWidth()(0),
-                                           U_half_data[axis]->getGhostCellWidth()(1),
-                                           U_half_data[axis]->getGhostCellWidth()(2),
-                                           U_adv_data[axis]->getPointer(0),
-                                           U_adv_data[axis]->getPointer(1),
-                                           U_adv_data[axis]->getPointer(2),
-                                           U_half_data[axis]->getPointer(0),
-                                           U_half_data[axis]->getPointer(1),
-                                           U_half_data[axis]->getPointer(2),
-                                           N_data->getGhostCellWidth()(0),
-                                           N_data->getGhostCellWidth()(1),
-                                           N_data->getGhostCellWidth()(2),
-                                           N_data->getPointer(axis));
+            NAVIER_STOKES_STAGGERED_PPM_DERIVATIVE_FC(dx,
+                                                      difference_form,
+                                                      patch_lower(0),
+                                                      patch_upper(0),
+                                                      patch_lower(1),
+                                                      patch_upper(1),
+                                                      patch_lower(2),
+                                                      patch_upper(2),
+                                                      U_ghosts(0),
+                                                      U_ghosts(1),
+                                                      U_ghosts(2),
+                                                      U_data->getPointer(0),
+                                                      U_data->getPointer(1),
+                                                      U_data->getPointer(2),
+                                                      U_half[0][0],
+                                                      U_half[0][1],
+                                                      U_half[0][2],
+                                                      U_half[1][0],
+                                                      U_half[1][1],
+                                                      U_half[1][2],
+                                                      U_half[2][0],
+                                                      U_half[2][1],
+                                                      U_half[2][2],
+                                                      U_pencil,
+                                                      U_adv_pencil,
+                                                      dU_pencil,
+                                                      U_L_pencil,
+                                                      U_R_pencil,
+                                                      N_data->getGhostCellWidth()(0),
+                                                      N_data->getGhostCellWidth()(1),
+                                                      N_data->getGhostCellWidth()(2),
+                                                      N_data->getPointer(0),
+                                                      N_data->getPointer(1),
+                                                      N_data->getPointer(2));
 #endif
-                    break;
-                default:
-                    TBOX_ERROR(
-                        "INSStaggeredPPMConvectiveOperator::applyConvectiveOperator():\n"
-                        << "  unsupported differencing form: "
-                        << enum_to_string<ConvectiveDifferencingType>(d_difference_form)
-                        << " \n"
-                        << "  valid choices are: ADVECTIVE, CONSERVATIVE, SKEW_SYMMETRIC\n");
-                }
-            }
         }
     }
 
@@ -1014,6 +444,8 @@ void INSStaggeredPPMConvectiveOperator::initializeOperatorState(
             level->allocatePatchData(d_U_scratch_idx);
         }
     }
+    d_scratch_pool.reserve(
+        NDIM * NDIM + 5, d_hierarchy, d_coarsest_ln, d_finest_ln, IntVector<NDIM>(GADVECTG));
     d_is_initialized = true;
 
     IBAMR_TIMER_STOP(t_initialize_operator_state);
@@ -45,6 +45,7 @@
 #include "ibamr/StaggeredStokesPhysicalBoundaryHelper.h"
 #include "ibamr/ibamr_enums.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/PatchScratchPool.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 
@@ -206,6 +207,9 @@ private:
     // Scratch data.
     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > d_U_var;
     int d_U_scratch_idx;
+
+    // Reusable storage for per-patch temporaries.
+    IBTK::PatchScratchPool d_scratch_pool;
 };
 } // namespace IBAMR
 
@@ -884,17 +884,13 @@ void INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const
             // Compute the xsPPM7 discretization.
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
-                Pointer<SideData<NDIM, double> > dU_data = new SideData<NDIM, double>(
-                    U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_L_data = new SideData<NDIM, double>(
-                    U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_R_data = new SideData<NDIM, double>(
-                    U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_scratch1_data = new SideData<NDIM, double>(
-                    U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
+                const size_t scratch_size = U_data->getArrayData(axis).getBox().size();
+                double* const dU = d_scratch_pool.getBuffer(0, scratch_size);
+                double* const U_L = d_scratch_pool.getBuffer(1, scratch_size);
+                double* const U_R = d_scratch_pool.getBuffer(2, scratch_size);
+                double* const U_scratch1 = d_scratch_pool.getBuffer(3, scratch_size);
 #if (NDIM == 3)
-                Pointer<SideData<NDIM, double> > U_scratch2_data = new SideData<NDIM, double>(
-                    U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
+                double* const U_scratch2 = d_scratch_pool.getBuffer(4, scratch_size);
 #endif
 #if (NDIM == 2)
                 GODUNOV_EXTRAPOLATE_FC(side_boxes[axis].lower(0),
@@ -904,10 +900,10 @@ void INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const
                                        U_data->getGhostCellWidth()(0),
                                        U_data->getGhostCellWidth()(1),
                                        U_data->getPointer(axis),
-                                       U_scratch1_data->getPointer(axis),
-                                       dU_data->getPointer(axis),
-                                       U_L_data->getPointer(axis),
-                                       U_R_data->getPointer(axis),
+                                       U_scratch1,
+                                       dU,
+                                       U_L,
+                                       U_R,
                                        U_adv_data[axis]->getGhostCellWidth()(0),
                                        U_adv_data[axis]->getGhostCellWidth()(1),
                                        U_half_data[axis]->getGhostCellWidth()(0),
@@ -928,11 +924,11 @@ void INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const
                                        U_data->getGhostCellWidth()(1),
                                        U_data->getGhostCellWidth()(2),
                                        U_data->getPointer(axis),
-                                       U_scratch1_data->getPointer(axis),
-                                       U_scratch2_data->getPointer(axis),
-                                       dU_data->getPointer(axis),
-                                       U_L_data->getPointer(axis),
-                                       U_R_data->getPointer(axis),
+                                       U_scratch1,
+                                       U_scratch2,
+                                       dU,
+                                       U_L,
+                                       U_R,
                                        U_adv_data[axis]->getGhostCellWidth()(0),
                                        U_adv_data[axis]->getGhostCellWidth()(1),
                                        U_adv_data[axis]->getGhostCellWidth()(2),
@@ -1287,6 +1283,8 @@ void INSStaggeredStabilizedPPMConvectiveOperator::initializeOperatorState(
             level->allocatePatchData(d_U_scratch_idx);
         }
     }
+    d_scratch_pool.reserve(
+        NDIM + 2, d_hierarchy, d_coarsest_ln, d_finest_ln, IntVector<NDIM>(GADVECTG));
     d_is_initialized = true;
 
     IBAMR_TIMER_STOP(t_initialize_operator_state);
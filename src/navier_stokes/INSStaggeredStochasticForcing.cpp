@@ -154,18 +154,6 @@ inline Box<NDIM> compute_tangential_extension(const Box<NDIM>& box, const int da
     extended_box.upper()(data_axis) += 1;
     return extended_box;
 } // compute_tangential_extension
-
-void genrandn(ArrayData<NDIM, double>& data, const Box<NDIM>& box)
-{
-    for (int depth = 0; depth < data.getDepth(); ++depth)
-    {
-        for (Box<NDIM>::Iterator i(box); i; i++)
-        {
-            RNG::genrandn(&data(i(), depth));
-        }
-    }
-    return;
-} // genrandn
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -176,9 +164,9 @@ INSStaggeredStochasticForcing::INSStaggeredStochasticForcing(
     const INSStaggeredHierarchyIntegrator* const fluid_solver)
     : d_object_name(object_name), d_fluid_solver(fluid_solver),
       d_stress_tensor_type(UNCORRELATED), d_std(std::numeric_limits<double>::quiet_NaN()),
-      d_num_rand_vals(0), d_weights(), d_velocity_bc_scaling(NDIM == 2 ? 2.0 : 5.0 / 3.0),
-      d_traction_bc_scaling(0.0), d_context(NULL), d_W_cc_var(NULL), d_W_cc_idx(-1),
-      d_W_cc_idxs(),
+      d_num_rand_vals(0), d_weights(), d_rng_stream(0),
+      d_velocity_bc_scaling(NDIM == 2 ? 2.0 : 5.0 / 3.0), d_traction_bc_scaling(0.0),
+      d_context(NULL), d_W_cc_var(NULL), d_W_cc_idx(-1), d_W_cc_idxs(),
 #if (NDIM == 2)
       d_W_nc_var(NULL), d_W_nc_idx(-1), d_W_nc_idxs()
 #endif
@@ -214,6 +202,10 @@ INSStaggeredStochasticForcing::INSStaggeredStochasticForcing(
             d_traction_bc_scaling = input_db->getDouble("traction_bc_scaling");
     }
 
+    // Reserve random number streams for the cell-centered components and the
+    // node- or edge-centered components of each random stress tensor.
+    d_rng_stream = RNG::allocateStreams((NDIM + 1) * d_num_rand_vals);
+
     // Setup variables and variable context objects.
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
     d_context = var_db->getContext(d_object_name + "::CONTEXT");
@@ -293,8 +285,10 @@ void INSStaggeredStochasticForcing::setDataOnPatchHierarchy(
         // Generate random components.
         if (cycle_num == 0)
         {
+            const unsigned int step = d_fluid_solver->getIntegratorStep();
             for (int k = 0; k < d_num_rand_vals; ++k)
             {
+                const unsigned int stream = d_rng_stream + (NDIM + 1) * k;
                 for (int level_num = coarsest_ln; level_num <= finest_ln; ++level_num)
                 {
                     Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_num);
@@ -303,20 +297,31 @@ void INSStaggeredStochasticForcing::setDataOnPatchHierarchy(
                         Pointer<Patch<NDIM> > patch = level->getPatch(p());
                         Pointer<CellData<NDIM, double> > W_cc_data =
                             patch->getPatchData(d_W_cc_idxs[k]);
-                        genrandn(W_cc_data->getArrayData(), W_cc_data->getBox());
+                        RNG::genrandn(W_cc_data->getArrayData(),
+                                      W_cc_data->getBox(),
+                                      stream,
+                                      step,
+                                      level_num);
 #if (NDIM == 2)
                         Pointer<NodeData<NDIM, double> > W_nc_data =
                             patch->getPatchData(d_W_nc_idxs[k]);
-                        genrandn(W_nc_data->getArrayData(),
-                                 NodeGeometry<NDIM>::toNodeBox(W_nc_data->getBox()));
+                        RNG::genrandn(W_nc_data->getArrayData(),
+                                      NodeGeometry<NDIM>::toNodeBox(W_nc_data->getBox()),
+                                      stream + 1,
+                                      step,
+                                      level_num);
 #endif
 #if (NDIM == 3)
                         Pointer<EdgeData<NDIM, double> > W_ec_data =
                             patch->getPatchData(d_W_ec_idxs[k]);
                         for (int d = 0; d < NDIM; ++d)
                         {
-                            genrandn(W_ec_data->getArrayData(d),
-                                     EdgeGeometry<NDIM>::toEdgeBox(W_ec_data->getBox(), d));
+                            RNG::genrandn(
+                                W_ec_data->getArrayData(d),
+                                EdgeGeometry<NDIM>::toEdgeBox(W_ec_data->getBox(), d),
+                                stream + 1 + d,
+                                step,
+                                level_num);
                         }
 #endif
                     }
@@ -57,6 +57,19 @@ namespace IBAMR
  * \brief Class PETScKrylovStaggeredStokesSolver is an extension of class
  * PETScKrylovLinearSolver that provides an implementation of the
  * StaggeredStokesSolver interface.
+ *
+ * Successive timesteps typically require the solution of closely related Stokes
+ * systems.  Setting the input database key recycled_subspace_size to a positive
+ * value retains a small subspace of previous solutions between solves and uses
+ * it to construct improved initial guesses; see
+ * IBTK::PETScKrylovLinearSolver::setRecycledSubspaceSize().
+ *
+ * When this solver is allocated by StaggeredStokesSolverManager, setting the
+ * input database key use_assembled_operator to TRUE applies the Stokes
+ * operator via an assembled PETSc Mat on single-level hierarchies; see
+ * StaggeredStokesOperator::setUseAssembledOperator().  Matrix-based
+ * preconditioners (e.g., PCFIELDSPLIT or algebraic multigrid) for the same
+ * level matrix are available via StaggeredStokesPETScLevelSolver.
  */
 class PETScKrylovStaggeredStokesSolver
     : public IBTK::PETScKrylovLinearSolver,
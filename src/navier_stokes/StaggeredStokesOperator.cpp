@@ -40,16 +40,24 @@
 #include "LocationIndexRobinBcCoefs.h"
 #include "MultiblockDataTranslator.h"
 #include "PatchHierarchy.h"
+#include "PatchLevel.h"
 #include "RobinBcCoefStrategy.h"
 #include "SAMRAIVectorReal.h"
 #include "SideVariable.h"
 #include "StaggeredStokesOperator.h"
+#include "VariableDatabase.h"
+#include "ibamr/StaggeredStokesPETScMatUtilities.h"
+#include "ibamr/StaggeredStokesPETScVecUtilities.h"
 #include "ibamr/ibamr_utilities.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/CellNoCornersFillPattern.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/SideNoCornersFillPattern.h"
+#include "petscsys.h"
 #include "tbox/Database.h"
+#include "tbox/MathUtilities.h"
+#include "tbox/SAMRAI_MPI.h"
 #include "tbox/Timer.h"
 #include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
@@ -102,7 +110,13 @@ StaggeredStokesOperator::StaggeredStokesOperator(const std::string& object_name,
       d_bc_helper(Pointer<StaggeredStokesPhysicalBoundaryHelper>(NULL)),
       d_U_fill_pattern(NULL), d_P_fill_pattern(NULL), d_transaction_comps(),
       d_hier_bdry_fill(Pointer<HierarchyGhostCellInterpolation>(NULL)),
-      d_no_fill(Pointer<HierarchyGhostCellInterpolation>(NULL)), d_x(NULL), d_b(NULL)
+      d_no_fill(Pointer<HierarchyGhostCellInterpolation>(NULL)), d_x(NULL), d_b(NULL),
+      d_use_assembled_op(false), d_assembled_op_enabled(false), d_assembled_op_valid(false),
+      d_assembled_op_bcs_checked(false), d_assembled_op_bcs_supported(false),
+      d_assembled_op_C(0.0), d_assembled_op_D(0.0), d_context(NULL), d_num_dofs_per_proc(),
+      d_u_dof_index_idx(-1), d_p_dof_index_idx(-1), d_u_dof_index_var(NULL),
+      d_p_dof_index_var(NULL), d_petsc_mat(NULL), d_petsc_x(NULL), d_petsc_y(NULL),
+      d_data_synch_sched(NULL)
 {
     // Setup a default boundary condition object that specifies homogeneous
     // Dirichlet boundary conditions for the velocity and homogeneous Neumann
@@ -182,6 +196,7 @@ void StaggeredStokesOperator::setPhysicalBcCoefs(
     {
         d_P_bc_coef = d_default_P_bc_coef;
     }
+    d_assembled_op_bcs_checked = false;
     return;
 } // setPhysicalBcCoefs
 
@@ -195,11 +210,48 @@ void StaggeredStokesOperator::setPhysicalBoundaryHelper(
     return;
 } // setPhysicalBoundaryHelper
 
+void StaggeredStokesOperator::setUseAssembledOperator(const bool use_assembled_op)
+{
+    d_use_assembled_op = use_assembled_op;
+    if (!d_use_assembled_op || d_u_dof_index_var) return;
+
+    // Construct the DOF index variable/context.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    d_context = var_db->getContext(d_object_name + "::CONTEXT");
+    d_u_dof_index_var = new SideVariable<NDIM, int>(d_object_name + "::u_dof_index");
+    if (var_db->checkVariableExists(d_u_dof_index_var->getName()))
+    {
+        d_u_dof_index_var = var_db->getVariable(d_u_dof_index_var->getName());
+        d_u_dof_index_idx = var_db->mapVariableAndContextToIndex(d_u_dof_index_var, d_context);
+        var_db->removePatchDataIndex(d_u_dof_index_idx);
+    }
+    d_u_dof_index_idx =
+        var_db->registerVariableAndContext(d_u_dof_index_var, d_context, SIDEG);
+    d_p_dof_index_var = new CellVariable<NDIM, int>(d_object_name + "::p_dof_index");
+    if (var_db->checkVariableExists(d_p_dof_index_var->getName()))
+    {
+        d_p_dof_index_var = var_db->getVariable(d_p_dof_index_var->getName());
+        d_p_dof_index_idx = var_db->mapVariableAndContextToIndex(d_p_dof_index_var, d_context);
+        var_db->removePatchDataIndex(d_p_dof_index_idx);
+    }
+    d_p_dof_index_idx =
+        var_db->registerVariableAndContext(d_p_dof_index_var, d_context, CELLG);
+    return;
+} // setUseAssembledOperator
+
 void StaggeredStokesOperator::apply(SAMRAIVectorReal<NDIM, double>& x,
                                     SAMRAIVectorReal<NDIM, double>& y)
 {
     IBAMR_TIMER_START(t_apply);
 
+    // Use the assembled form of the operator when possible.
+    if (d_assembled_op_enabled && canApplyAssembledOperator())
+    {
+        applyAssembledOperator(x, y);
+        IBAMR_TIMER_STOP(t_apply);
+        return;
+    }
+
     // Get the vector components.
     const int U_idx = x.getComponentDescriptorIndex(0);
     const int P_idx = x.getComponentDescriptorIndex(1);
@@ -336,6 +388,36 @@ StaggeredStokesOperator::initializeOperatorState(const SAMRAIVectorReal<NDIM, do
     }
 #endif
 
+    // Setup the data required to apply the assembled form of the operator.
+    // Composite-grid operators are always applied matrix-free.
+    d_assembled_op_enabled = d_use_assembled_op && in.getCoarsestLevelNumber() == 0 &&
+                             in.getFinestLevelNumber() == 0;
+    if (d_assembled_op_enabled)
+    {
+        Pointer<PatchLevel<NDIM> > level = in.getPatchHierarchy()->getPatchLevel(0);
+        if (!level->checkAllocated(d_u_dof_index_idx))
+            level->allocatePatchData(d_u_dof_index_idx);
+        if (!level->checkAllocated(d_p_dof_index_idx))
+            level->allocatePatchData(d_p_dof_index_idx);
+        StaggeredStokesPETScVecUtilities::constructPatchLevelDOFIndices(
+            d_num_dofs_per_proc, d_u_dof_index_idx, d_p_dof_index_idx, level);
+        int ierr;
+        const int mpi_rank = SAMRAI_MPI::getRank();
+        ierr = VecCreateMPI(
+            PETSC_COMM_WORLD, d_num_dofs_per_proc[mpi_rank], PETSC_DETERMINE, &d_petsc_x);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecCreateMPI(
+            PETSC_COMM_WORLD, d_num_dofs_per_proc[mpi_rank], PETSC_DETERMINE, &d_petsc_y);
+        IBTK_CHKERRQ(ierr);
+        d_data_synch_sched = StaggeredStokesPETScVecUtilities::constructDataSynchSchedule(
+            out.getComponentDescriptorIndex(0), out.getComponentDescriptorIndex(1), level);
+
+        // The matrix itself is assembled lazily, once the problem coefficients
+        // are known.
+        d_assembled_op_valid = false;
+        d_assembled_op_bcs_checked = false;
+    }
+
     // Indicate the operator is initialized.
     d_is_initialized = true;
 
@@ -359,6 +441,30 @@ void StaggeredStokesOperator::deallocateOperatorState()
     d_U_fill_pattern.setNull();
     d_P_fill_pattern.setNull();
 
+    // Deallocate the assembled form of the operator.
+    if (d_assembled_op_enabled)
+    {
+        int ierr;
+        if (d_petsc_mat)
+        {
+            ierr = MatDestroy(&d_petsc_mat);
+            IBTK_CHKERRQ(ierr);
+        }
+        ierr = VecDestroy(&d_petsc_x);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecDestroy(&d_petsc_y);
+        IBTK_CHKERRQ(ierr);
+        d_data_synch_sched.setNull();
+        d_num_dofs_per_proc.clear();
+        Pointer<PatchLevel<NDIM> > level = d_x->getPatchHierarchy()->getPatchLevel(0);
+        if (level->checkAllocated(d_u_dof_index_idx))
+            level->deallocatePatchData(d_u_dof_index_idx);
+        if (level->checkAllocated(d_p_dof_index_idx))
+            level->deallocatePatchData(d_p_dof_index_idx);
+        d_assembled_op_enabled = false;
+        d_assembled_op_valid = false;
+    }
+
     // Delete the solution and rhs vectors.
     d_x->resetLevels(d_x->getCoarsestLevelNumber(),
                      std::min(d_x->getFinestLevelNumber(),
@@ -384,6 +490,96 @@ void StaggeredStokesOperator::deallocateOperatorState()
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+bool StaggeredStokesOperator::canApplyAssembledOperator()
+{
+    // The assembled operator only treats constant coefficients and
+    // homogeneous boundary conditions.
+    if (!d_homogeneous_bc || d_U_problem_coefs.cIsVariable() ||
+        !d_U_problem_coefs.dIsConstant())
+    {
+        return false;
+    }
+
+    // The assembled operator also only treats Dirichlet velocity boundary
+    // conditions, in which case the pressure boundary conditions do not
+    // enter the discretization.  Traction and open boundaries are handled
+    // matrix-free.  This check is collective, and so it is performed only
+    // once per initialization or change of the boundary condition objects.
+    if (!d_assembled_op_bcs_checked)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_x->getPatchHierarchy()->getPatchLevel(0);
+        d_assembled_op_bcs_supported =
+            StaggeredStokesPETScMatUtilities::hasDirichletVelocityBcs(
+                d_U_bc_coefs, d_solution_time, level);
+        d_assembled_op_bcs_checked = true;
+    }
+    return d_assembled_op_bcs_supported;
+} // canApplyAssembledOperator
+
+void StaggeredStokesOperator::applyAssembledOperator(SAMRAIVectorReal<NDIM, double>& x,
+                                                     SAMRAIVectorReal<NDIM, double>& y)
+{
+    int ierr;
+    Pointer<PatchLevel<NDIM> > level = x.getPatchHierarchy()->getPatchLevel(0);
+
+    // (Re-)compute the matrix values if the problem coefficients have changed
+    // since the matrix was last assembled.  The nonzero structure of the
+    // matrix is reused whenever possible.
+    const double C = d_U_problem_coefs.cIsConstant() ? d_U_problem_coefs.getCConstant() : 0.0;
+    const double D = d_U_problem_coefs.getDConstant();
+    if (!d_assembled_op_valid || !MathUtilities<double>::equalEps(C, d_assembled_op_C) ||
+        !MathUtilities<double>::equalEps(D, d_assembled_op_D))
+    {
+        if (d_petsc_mat)
+        {
+            StaggeredStokesPETScMatUtilities::resetPatchLevelMACStokesOpValues(
+                d_petsc_mat,
+                d_U_problem_coefs,
+                d_U_bc_coefs,
+                d_solution_time,
+                d_num_dofs_per_proc,
+                d_u_dof_index_idx,
+                d_p_dof_index_idx,
+                level);
+        }
+        else
+        {
+            StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(
+                d_petsc_mat,
+                d_U_problem_coefs,
+                d_U_bc_coefs,
+                d_solution_time,
+                d_num_dofs_per_proc,
+                d_u_dof_index_idx,
+                d_p_dof_index_idx,
+                level);
+        }
+        d_assembled_op_C = C;
+        d_assembled_op_D = D;
+        d_assembled_op_valid = true;
+    }
+
+    // Compute the action of the operator via a sparse matrix-vector product.
+    StaggeredStokesPETScVecUtilities::copyToPatchLevelVec(d_petsc_x,
+                                                          x.getComponentDescriptorIndex(0),
+                                                          d_u_dof_index_idx,
+                                                          x.getComponentDescriptorIndex(1),
+                                                          d_p_dof_index_idx,
+                                                          level);
+    ierr = MatMult(d_petsc_mat, d_petsc_x, d_petsc_y);
+    IBTK_CHKERRQ(ierr);
+    const Pointer<RefineSchedule<NDIM> > no_ghost_fill_sched(NULL);
+    StaggeredStokesPETScVecUtilities::copyFromPatchLevelVec(d_petsc_y,
+                                                            y.getComponentDescriptorIndex(0),
+                                                            d_u_dof_index_idx,
+                                                            y.getComponentDescriptorIndex(1),
+                                                            d_p_dof_index_idx,
+                                                            level,
+                                                            d_data_synch_sched,
+                                                            no_ghost_fill_sched);
+    return;
+} // applyAssembledOperator
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBAMR
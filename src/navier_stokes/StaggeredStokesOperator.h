@@ -38,13 +38,19 @@
 #include <string>
 #include <vector>
 
+#include "CellVariable.h"
 #include "IntVector.h"
 #include "PoissonSpecifications.h"
+#include "RefineSchedule.h"
 #include "SAMRAIVectorReal.h"
+#include "SideVariable.h"
+#include "VariableContext.h"
 #include "VariableFillPattern.h"
 #include "ibamr/StaggeredStokesPhysicalBoundaryHelper.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/LinearOperator.h"
+#include "petscmat.h"
+#include "petscvec.h"
 #include "tbox/Pointer.h"
 
 namespace SAMRAI
@@ -68,6 +74,17 @@ namespace IBAMR
  * This class is intended to be used with an iterative (Krylov or Newton-Krylov)
  * incompressible flow solver.
  *
+ * By default, the operator is applied matrix-free.  When
+ * setUseAssembledOperator() is used to enable it, the operator is instead
+ * assembled into a parallel PETSc Mat (see StaggeredStokesPETScMatUtilities)
+ * and applied via a sparse matrix-vector product.  The assembled form is
+ * currently only used for single-level hierarchies, constant problem
+ * coefficients, and homogeneous Dirichlet velocity boundary conditions; in all
+ * other cases (e.g. traction or open boundaries), the operator falls back to
+ * the matrix-free implementation.  The matrix is
+ * assembled once per call to initializeOperatorState(), and its values are
+ * updated in place when the problem coefficients change.
+ *
  * \see INSStaggeredHierarchyIntegrator
  */
 class StaggeredStokesOperator : public IBTK::LinearOperator
@@ -124,6 +141,15 @@ public:
     virtual void setPhysicalBoundaryHelper(
         SAMRAI::tbox::Pointer<StaggeredStokesPhysicalBoundaryHelper> bc_helper);
 
+    /*!
+     * \brief Set whether to apply the operator via an assembled PETSc Mat
+     * rather than matrix-free.
+     *
+     * \note This setting takes effect the next time initializeOperatorState()
+     * is called.
+     */
+    virtual void setUseAssembledOperator(bool use_assembled_op);
+
     /*!
      * \name Linear operator functionality.
      */
@@ -226,6 +252,19 @@ protected:
     // Scratch data.
     SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_x, d_b;
 
+    // Assembled operator data.
+    bool d_use_assembled_op, d_assembled_op_enabled, d_assembled_op_valid;
+    bool d_assembled_op_bcs_checked, d_assembled_op_bcs_supported;
+    double d_assembled_op_C, d_assembled_op_D;
+    SAMRAI::tbox::Pointer<SAMRAI::hier::VariableContext> d_context;
+    std::vector<int> d_num_dofs_per_proc;
+    int d_u_dof_index_idx, d_p_dof_index_idx;
+    SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, int> > d_u_dof_index_var;
+    SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, int> > d_p_dof_index_var;
+    Mat d_petsc_mat;
+    Vec d_petsc_x, d_petsc_y;
+    SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > d_data_synch_sched;
+
 private:
     /*!
      * \brief Default constructor.
@@ -253,6 +292,20 @@ private:
      * \return A reference to this object.
      */
     StaggeredStokesOperator& operator=(const StaggeredStokesOperator& that);
+
+    /*!
+     * \brief Determine whether the assembled form of the operator can be used
+     * to compute y=Ax for the current problem specification.
+     *
+     * \note This is a collective operation.
+     */
+    bool canApplyAssembledOperator();
+
+    /*!
+     * \brief Compute y=Ax using the assembled form of the operator.
+     */
+    void applyAssembledOperator(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                                SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& y);
 };
 } // namespace IBAMR
 
@@ -82,31 +82,21 @@ inline Box<NDIM> compute_tangential_extension(const Box<NDIM>& box, const int da
     extended_box.upper()(data_axis) += 1;
     return extended_box;
 } // compute_tangential_extension
-}
 
-/////////////////////////////// PUBLIC ///////////////////////////////////////
+// Sizes of the finite difference stencils used to discretize the MAC Stokes
+// operator.
+static const int uu_stencil_sz = 2 * NDIM + 1;
+static const int up_stencil_sz = 2;
+static const int pu_stencil_sz = 2 * NDIM;
 
-void StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(
-    Mat& mat,
-    const PoissonSpecifications& u_problem_coefs,
-    const std::vector<RobinBcCoefStrategy<NDIM>*>& u_bc_coefs,
-    double data_time,
-    const std::vector<int>& num_dofs_per_proc,
-    int u_dof_index_idx,
-    int p_dof_index_idx,
-    Pointer<PatchLevel<NDIM> > patch_level)
-{
-    int ierr;
-    if (mat)
-    {
-        ierr = MatDestroy(&mat);
-        IBTK_CHKERRQ(ierr);
-    }
+typedef boost::array<Index<NDIM>, uu_stencil_sz> UUStencil;
+typedef boost::array<boost::array<Index<NDIM>, up_stencil_sz>, NDIM> UPStencil;
+typedef boost::array<Index<NDIM>, pu_stencil_sz> PUStencil;
 
-    // Setup the finite difference stencils.
-    static const int uu_stencil_sz = 2 * NDIM + 1;
-    boost::array<Index<NDIM>, uu_stencil_sz> uu_stencil(
-        array_constant<Index<NDIM>, uu_stencil_sz>(Index<NDIM>(0)));
+inline void
+setup_mac_stokes_stencils(UUStencil& uu_stencil, UPStencil& up_stencil, PUStencil& pu_stencil)
+{
+    uu_stencil = array_constant<Index<NDIM>, uu_stencil_sz>(Index<NDIM>(0));
     for (unsigned int axis = 0, uu_stencil_index = 1; axis < NDIM; ++axis)
     {
         for (int side = 0; side <= 1; ++side, ++uu_stencil_index)
@@ -114,10 +104,8 @@ void StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(
             uu_stencil[uu_stencil_index](axis) = (side == 0 ? -1 : +1);
         }
     }
-    static const int up_stencil_sz = 2;
-    boost::array<boost::array<Index<NDIM>, up_stencil_sz>, NDIM> up_stencil(
-        array_constant<boost::array<Index<NDIM>, up_stencil_sz>, NDIM>(
-            array_constant<Index<NDIM>, up_stencil_sz>(Index<NDIM>(0))));
+    up_stencil = array_constant<boost::array<Index<NDIM>, up_stencil_sz>, NDIM>(
+        array_constant<Index<NDIM>, up_stencil_sz>(Index<NDIM>(0)));
     for (unsigned int axis = 0; axis < NDIM; ++axis)
     {
         for (int side = 0; side <= 1; ++side)
@@ -125,9 +113,7 @@ void StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(
             up_stencil[axis][side](axis) = (side == 0 ? -1 : 0);
         }
     }
-    static const int pu_stencil_sz = 4;
-    boost::array<Index<NDIM>, pu_stencil_sz> pu_stencil(
-        array_constant<Index<NDIM>, pu_stencil_sz>(Index<NDIM>(0)));
+    pu_stencil = array_constant<Index<NDIM>, pu_stencil_sz>(Index<NDIM>(0));
     for (unsigned int axis = 0, pu_stencil_index = 0; axis < NDIM; ++axis)
     {
         for (int side = 0; side <= 1; ++side, ++pu_stencil_index)
@@ -135,6 +121,25 @@ void StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(
             pu_stencil[pu_stencil_index](axis) = (side == 0 ? 0 : +1);
         }
     }
+    return;
+} // setup_mac_stokes_stencils
+
+// Set the values of a matrix whose nonzero structure has already been
+// determined, and assemble it.
+void set_mac_stokes_op_values(Mat& mat,
+                              const PoissonSpecifications& u_problem_coefs,
+                              const std::vector<RobinBcCoefStrategy<NDIM>*>& u_bc_coefs,
+                              const double data_time,
+                              const std::vector<int>& num_dofs_per_proc,
+                              const int u_dof_index_idx,
+                              const int p_dof_index_idx,
+                              Pointer<PatchLevel<NDIM> > patch_level)
+{
+    int ierr;
+    UUStencil uu_stencil;
+    UPStencil up_stencil;
+    PUStencil pu_stencil;
+    setup_mac_stokes_stencils(uu_stencil, up_stencil, pu_stencil);
 
     // Determine the index ranges.
     const int mpi_rank = SAMRAI_MPI::getRank();
@@ -142,110 +147,9 @@ void StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(
     const int ilower =
         std::accumulate(num_dofs_per_proc.begin(), num_dofs_per_proc.begin() + mpi_rank, 0);
     const int iupper = ilower + nlocal;
-    const int ntotal = std::accumulate(num_dofs_per_proc.begin(), num_dofs_per_proc.end(), 0);
-
-    // Determine the non-zero structure of the matrix.
-    std::vector<int> d_nnz(nlocal, 0), o_nnz(nlocal, 0);
-    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
-    {
-        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
-        const Box<NDIM>& patch_box = patch->getBox();
-        Pointer<SideData<NDIM, int> > u_dof_index_data = patch->getPatchData(u_dof_index_idx);
-        Pointer<CellData<NDIM, int> > p_dof_index_data = patch->getPatchData(p_dof_index_idx);
-        for (unsigned int axis = 0; axis < NDIM; ++axis)
-        {
-            for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, axis)); b; b++)
-            {
-                const CellIndex<NDIM>& ic = b();
-                const SideIndex<NDIM> is(ic, axis, SideIndex<NDIM>::Lower);
-                const int u_dof_index = (*u_dof_index_data)(is);
-                if (UNLIKELY(ilower > u_dof_index || u_dof_index >= iupper)) continue;
-                const int u_local_idx = u_dof_index - ilower;
-                d_nnz[u_local_idx] += 1;
-                for (unsigned int d = 0, uu_stencil_index = 1; d < NDIM; ++d)
-                {
-                    for (int side = 0; side <= 1; ++side, ++uu_stencil_index)
-                    {
-                        const int uu_dof_index =
-                            (*u_dof_index_data)(is + uu_stencil[uu_stencil_index]);
-                        if (LIKELY(uu_dof_index >= ilower && uu_dof_index < iupper))
-                        {
-                            d_nnz[u_local_idx] += 1;
-                        }
-                        else
-                        {
-                            o_nnz[u_local_idx] += 1;
-                        }
-                    }
-                }
-                for (int side = 0, up_stencil_index = 0; side <= 1; ++side, ++up_stencil_index)
-                {
-                    const int up_dof_index =
-                        (*p_dof_index_data)(ic + up_stencil[axis][up_stencil_index]);
-                    if (LIKELY(up_dof_index >= ilower && up_dof_index < iupper))
-                    {
-                        d_nnz[u_local_idx] += 1;
-                    }
-                    else
-                    {
-                        o_nnz[u_local_idx] += 1;
-                    }
-                }
-                d_nnz[u_local_idx] = std::min(nlocal, d_nnz[u_local_idx]);
-                o_nnz[u_local_idx] = std::min(ntotal - nlocal, o_nnz[u_local_idx]);
-            }
-        }
-        for (Box<NDIM>::Iterator b(CellGeometry<NDIM>::toCellBox(patch_box)); b; b++)
-        {
-            const CellIndex<NDIM>& ic = b();
-            const int p_dof_index = (*p_dof_index_data)(ic);
-            if (UNLIKELY(ilower > p_dof_index || p_dof_index >= iupper)) continue;
-            const int p_local_idx = p_dof_index - ilower;
-            d_nnz[p_local_idx] += 1;
-            for (unsigned int axis = 0, pu_stencil_index = 0; axis < NDIM; ++axis)
-            {
-                for (int side = 0; side <= 1; ++side, ++pu_stencil_index)
-                {
-                    const int pu_dof_index = (*u_dof_index_data)(SideIndex<NDIM>(
-                        ic + pu_stencil[pu_stencil_index], axis, SideIndex<NDIM>::Lower));
-                    if (LIKELY(pu_dof_index >= ilower && pu_dof_index < iupper))
-                    {
-                        d_nnz[p_local_idx] += 1;
-                    }
-                    else
-                    {
-                        o_nnz[p_local_idx] += 1;
-                    }
-                }
-            }
-            d_nnz[p_local_idx] = std::min(nlocal, d_nnz[p_local_idx]);
-            o_nnz[p_local_idx] = std::min(ntotal - nlocal, o_nnz[p_local_idx]);
-        }
-    }
-
-    // Create an empty matrix.
-    ierr = MatCreateAIJ(PETSC_COMM_WORLD,
-                        nlocal,
-                        nlocal,
-                        PETSC_DETERMINE,
-                        PETSC_DETERMINE,
-                        PETSC_DEFAULT,
-                        &d_nnz[0],
-                        PETSC_DEFAULT,
-                        &o_nnz[0],
-                        &mat);
-    IBTK_CHKERRQ(ierr);
-
-// Set some general matrix options.
-#if !defined(NDEBUG)
-    ierr = MatSetOption(mat, MAT_NEW_NONZERO_LOCATION_ERR, PETSC_TRUE);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatSetOption(mat, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_TRUE);
-    IBTK_CHKERRQ(ierr);
-#endif
 
     // Set the matrix coefficients.
-    const double C = u_problem_coefs.getCConstant();
+    const double C = u_problem_coefs.cIsConstant() ? u_problem_coefs.getCConstant() : 0.0;
     const double D = u_problem_coefs.getDConstant();
     for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
     {
@@ -269,10 +173,9 @@ void StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(
             for (unsigned int d = 0; d < NDIM; ++d)
             {
                 const double dx_sq = dx[d] * dx[d];
-                uu_mat_vals[2 * d + 1] -= 0.5 * D / dx_sq; // lower off-diagonal
-                uu_mat_vals[2 * d + 2] -= 0.5 * D / dx_sq; // upper off-diagonal
-                uu_mat_vals[0] += 0.5 * D / dx_sq;         // diagonal
-                uu_mat_vals[0] += 0.5 * D / dx_sq;         // diagonal
+                uu_mat_vals[2 * d + 1] += D / dx_sq; // lower off-diagonal
+                uu_mat_vals[2 * d + 2] += D / dx_sq; // upper off-diagonal
+                uu_mat_vals[0] -= 2.0 * D / dx_sq;   // diagonal
             }
             for (int uu_stencil_index = 0; uu_stencil_index < uu_stencil_sz;
                  ++uu_stencil_index)
@@ -586,8 +489,288 @@ void StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(
     ierr = MatAssemblyEnd(mat, MAT_FINAL_ASSEMBLY);
     IBTK_CHKERRQ(ierr);
     return;
+} // set_mac_stokes_op_values
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+void StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(
+    Mat& mat,
+    const PoissonSpecifications& u_problem_coefs,
+    const std::vector<RobinBcCoefStrategy<NDIM>*>& u_bc_coefs,
+    double data_time,
+    const std::vector<int>& num_dofs_per_proc,
+    int u_dof_index_idx,
+    int p_dof_index_idx,
+    Pointer<PatchLevel<NDIM> > patch_level)
+{
+    int ierr;
+    if (mat)
+    {
+        ierr = MatDestroy(&mat);
+        IBTK_CHKERRQ(ierr);
+    }
+
+    // Setup the finite difference stencils.
+    UUStencil uu_stencil;
+    UPStencil up_stencil;
+    PUStencil pu_stencil;
+    setup_mac_stokes_stencils(uu_stencil, up_stencil, pu_stencil);
+
+    // Determine the index ranges.
+    const int mpi_rank = SAMRAI_MPI::getRank();
+    const int nlocal = num_dofs_per_proc[mpi_rank];
+    const int ilower =
+        std::accumulate(num_dofs_per_proc.begin(), num_dofs_per_proc.begin() + mpi_rank, 0);
+    const int iupper = ilower + nlocal;
+    const int ntotal = std::accumulate(num_dofs_per_proc.begin(), num_dofs_per_proc.end(), 0);
+
+    // Determine the non-zero structure of the matrix.
+    std::vector<int> d_nnz(nlocal, 0), o_nnz(nlocal, 0);
+    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        Pointer<SideData<NDIM, int> > u_dof_index_data = patch->getPatchData(u_dof_index_idx);
+        Pointer<CellData<NDIM, int> > p_dof_index_data = patch->getPatchData(p_dof_index_idx);
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, axis)); b; b++)
+            {
+                const CellIndex<NDIM>& ic = b();
+                const SideIndex<NDIM> is(ic, axis, SideIndex<NDIM>::Lower);
+                const int u_dof_index = (*u_dof_index_data)(is);
+                if (UNLIKELY(ilower > u_dof_index || u_dof_index >= iupper)) continue;
+                const int u_local_idx = u_dof_index - ilower;
+                d_nnz[u_local_idx] += 1;
+                for (unsigned int d = 0, uu_stencil_index = 1; d < NDIM; ++d)
+                {
+                    for (int side = 0; side <= 1; ++side, ++uu_stencil_index)
+                    {
+                        const int uu_dof_index =
+                            (*u_dof_index_data)(is + uu_stencil[uu_stencil_index]);
+                        if (LIKELY(uu_dof_index >= ilower && uu_dof_index < iupper))
+                        {
+                            d_nnz[u_local_idx] += 1;
+                        }
+                        else
+                        {
+                            o_nnz[u_local_idx] += 1;
+                        }
+                    }
+                }
+                for (int side = 0, up_stencil_index = 0; side <= 1; ++side, ++up_stencil_index)
+                {
+                    const int up_dof_index =
+                        (*p_dof_index_data)(ic + up_stencil[axis][up_stencil_index]);
+                    if (LIKELY(up_dof_index >= ilower && up_dof_index < iupper))
+                    {
+                        d_nnz[u_local_idx] += 1;
+                    }
+                    else
+                    {
+                        o_nnz[u_local_idx] += 1;
+                    }
+                }
+                d_nnz[u_local_idx] = std::min(nlocal, d_nnz[u_local_idx]);
+                o_nnz[u_local_idx] = std::min(ntotal - nlocal, o_nnz[u_local_idx]);
+            }
+        }
+        for (Box<NDIM>::Iterator b(CellGeometry<NDIM>::toCellBox(patch_box)); b; b++)
+        {
+            const CellIndex<NDIM>& ic = b();
+            const int p_dof_index = (*p_dof_index_data)(ic);
+            if (UNLIKELY(ilower > p_dof_index || p_dof_index >= iupper)) continue;
+            const int p_local_idx = p_dof_index - ilower;
+            d_nnz[p_local_idx] += 1;
+            for (unsigned int axis = 0, pu_stencil_index = 0; axis < NDIM; ++axis)
+            {
+                for (int side = 0; side <= 1; ++side, ++pu_stencil_index)
+                {
+                    const int pu_dof_index = (*u_dof_index_data)(SideIndex<NDIM>(
+                        ic + pu_stencil[pu_stencil_index], axis, SideIndex<NDIM>::Lower));
+                    if (LIKELY(pu_dof_index >= ilower && pu_dof_index < iupper))
+                    {
+                        d_nnz[p_local_idx] += 1;
+                    }
+                    else
+                    {
+                        o_nnz[p_local_idx] += 1;
+                    }
+                }
+            }
+            d_nnz[p_local_idx] = std::min(nlocal, d_nnz[p_local_idx]);
+            o_nnz[p_local_idx] = std::min(ntotal - nlocal, o_nnz[p_local_idx]);
+        }
+    }
+
+    // Create an empty matrix.
+    ierr = MatCreateAIJ(PETSC_COMM_WORLD,
+                        nlocal,
+                        nlocal,
+                        PETSC_DETERMINE,
+                        PETSC_DETERMINE,
+                        PETSC_DEFAULT,
+                        &d_nnz[0],
+                        PETSC_DEFAULT,
+                        &o_nnz[0],
+                        &mat);
+    IBTK_CHKERRQ(ierr);
+
+// Set some general matrix options.
+#if !defined(NDEBUG)
+    ierr = MatSetOption(mat, MAT_NEW_NONZERO_LOCATION_ERR, PETSC_TRUE);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatSetOption(mat, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_TRUE);
+    IBTK_CHKERRQ(ierr);
+#endif
+
+    // Set the matrix coefficients and assemble the matrix.
+    set_mac_stokes_op_values(mat,
+                             u_problem_coefs,
+                             u_bc_coefs,
+                             data_time,
+                             num_dofs_per_proc,
+                             u_dof_index_idx,
+                             p_dof_index_idx,
+                             patch_level);
+    return;
 } // constructPatchLevelMACStokesOp
 
+void StaggeredStokesPETScMatUtilities::resetPatchLevelMACStokesOpValues(
+    Mat& mat,
+    const PoissonSpecifications& u_problem_coefs,
+    const std::vector<RobinBcCoefStrategy<NDIM>*>& u_bc_coefs,
+    double data_time,
+    const std::vector<int>& num_dofs_per_proc,
+    int u_dof_index_idx,
+    int p_dof_index_idx,
+    Pointer<PatchLevel<NDIM> > patch_level)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(mat);
+#endif
+    // Zero out the existing values.  The nonzero structure of the matrix is
+    // retained, so that the numeric values can be reset without repeating the
+    // preallocation.
+    int ierr = MatZeroEntries(mat);
+    IBTK_CHKERRQ(ierr);
+    set_mac_stokes_op_values(mat,
+                             u_problem_coefs,
+                             u_bc_coefs,
+                             data_time,
+                             num_dofs_per_proc,
+                             u_dof_index_idx,
+                             p_dof_index_idx,
+                             patch_level);
+    return;
+} // resetPatchLevelMACStokesOpValues
+
+bool StaggeredStokesPETScMatUtilities::hasDirichletVelocityBcs(
+    const std::vector<RobinBcCoefStrategy<NDIM>*>& u_bc_coefs,
+    double data_time,
+    Pointer<PatchLevel<NDIM> > patch_level)
+{
+    bool all_dirichlet = true;
+    for (PatchLevel<NDIM>::Iterator p(patch_level); p && all_dirichlet; p++)
+    {
+        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
+        Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+        const double* const dx = pgeom->getDx();
+        const double* const patch_x_lower = pgeom->getXLower();
+        const double* const patch_x_upper = pgeom->getXUpper();
+        const IntVector<NDIM>& ratio_to_level_zero = pgeom->getRatio();
+        Array<Array<bool> > touches_regular_bdry(NDIM), touches_periodic_bdry(NDIM);
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            touches_regular_bdry[axis].resizeArray(2);
+            touches_periodic_bdry[axis].resizeArray(2);
+            for (int upperlower = 0; upperlower < 2; ++upperlower)
+            {
+                touches_regular_bdry[axis][upperlower] =
+                    pgeom->getTouchesRegularBoundary(axis, upperlower);
+                touches_periodic_bdry[axis][upperlower] =
+                    pgeom->getTouchesPeriodicBoundary(axis, upperlower);
+            }
+        }
+
+        // Evaluate the boundary condition coefficients at the same locations
+        // used by set_mac_stokes_op_values().
+        const Array<BoundaryBox<NDIM> > physical_codim1_boxes =
+            PhysicalBoundaryUtilities::getPhysicalBoundaryCodim1Boxes(*patch);
+        const int n_physical_codim1_boxes = physical_codim1_boxes.size();
+        for (unsigned int axis = 0; axis < NDIM && all_dirichlet; ++axis)
+        {
+            for (int n = 0; n < n_physical_codim1_boxes && all_dirichlet; ++n)
+            {
+                const BoundaryBox<NDIM>& bdry_box = physical_codim1_boxes[n];
+                const unsigned int bdry_normal_axis = bdry_box.getLocationIndex() / 2;
+                const BoundaryBox<NDIM> trimmed_bdry_box =
+                    PhysicalBoundaryUtilities::trimBoundaryCodim1Box(bdry_box, *patch);
+                const Box<NDIM> side_bdry_box =
+                    PhysicalBoundaryUtilities::makeSideBoundaryCodim1Box(trimmed_bdry_box);
+                Box<NDIM> bc_coef_box = side_bdry_box;
+                if (bdry_normal_axis != axis)
+                {
+                    bc_coef_box = compute_tangential_extension(side_bdry_box, axis);
+                }
+
+                Pointer<ArrayData<NDIM, double> > acoef_data =
+                    new ArrayData<NDIM, double>(bc_coef_box, 1);
+                Pointer<ArrayData<NDIM, double> > bcoef_data =
+                    new ArrayData<NDIM, double>(bc_coef_box, 1);
+                Pointer<ArrayData<NDIM, double> > gcoef_data;
+
+                // Tangential velocity components are located at positions
+                // that are shifted relative to the cell centers.
+                if (bdry_normal_axis != axis)
+                {
+                    boost::array<double, NDIM> shifted_patch_x_lower, shifted_patch_x_upper;
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        shifted_patch_x_lower[d] = patch_x_lower[d];
+                        shifted_patch_x_upper[d] = patch_x_upper[d];
+                    }
+                    shifted_patch_x_lower[axis] -= 0.5 * dx[axis];
+                    shifted_patch_x_upper[axis] -= 0.5 * dx[axis];
+                    patch->setPatchGeometry(
+                        new CartesianPatchGeometry<NDIM>(ratio_to_level_zero,
+                                                         touches_regular_bdry,
+                                                         touches_periodic_bdry,
+                                                         dx,
+                                                         shifted_patch_x_lower.data(),
+                                                         shifted_patch_x_upper.data()));
+                }
+                ExtendedRobinBcCoefStrategy* extended_bc_coef =
+                    dynamic_cast<ExtendedRobinBcCoefStrategy*>(u_bc_coefs[axis]);
+                if (extended_bc_coef)
+                {
+                    extended_bc_coef->clearTargetPatchDataIndex();
+                    extended_bc_coef->setHomogeneousBc(true);
+                }
+                u_bc_coefs[axis]->setBcCoefs(acoef_data,
+                                             bcoef_data,
+                                             gcoef_data,
+                                             NULL,
+                                             *patch,
+                                             trimmed_bdry_box,
+                                             data_time);
+                patch->setPatchGeometry(pgeom);
+
+                for (Box<NDIM>::Iterator bc(bc_coef_box); bc && all_dirichlet; bc++)
+                {
+                    const Index<NDIM>& i = bc();
+                    const double& a = (*acoef_data)(i, 0);
+                    const double& b = (*bcoef_data)(i, 0);
+                    all_dirichlet = MathUtilities<double>::equalEps(a, 1.0) &&
+                                    MathUtilities<double>::equalEps(b, 0.0);
+                }
+            }
+        }
+    }
+    return SAMRAI_MPI::minReduction(all_dirichlet ? 1 : 0) == 1;
+} // hasDirichletVelocityBcs
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
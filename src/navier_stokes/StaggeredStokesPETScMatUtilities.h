@@ -87,6 +87,40 @@ public:
         int p_dof_index_idx,
         SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
 
+    /*!
+     * \brief Reset the values of a parallel PETSc Mat object previously
+     * generated by constructPatchLevelMACStokesOp() without reallocating it.
+     *
+     * The nonzero structure of the matrix is retained, so only the numerical
+     * values are recomputed.  This is appropriate when the problem
+     * coefficients (e.g. the time step size) change but the DOF indices on the
+     * SAMRAI::hier::PatchLevel do not.
+     */
+    static void resetPatchLevelMACStokesOpValues(
+        Mat& mat,
+        const SAMRAI::solv::PoissonSpecifications& u_problem_coefs,
+        const std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*>& u_bc_coefs,
+        double data_time,
+        const std::vector<int>& num_dofs_per_proc,
+        int u_dof_index_idx,
+        int p_dof_index_idx,
+        SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
+
+    /*!
+     * \brief Determine whether the velocity boundary conditions are Dirichlet
+     * conditions (a = 1, b = 0) along all physical boundaries of the
+     * SAMRAI::hier::PatchLevel.
+     *
+     * The matrices generated by constructPatchLevelMACStokesOp() only treat
+     * such boundary conditions.
+     *
+     * \note This is a collective operation.
+     */
+    static bool hasDirichletVelocityBcs(
+        const std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*>& u_bc_coefs,
+        double data_time,
+        SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
+
     //\}
 
 protected:
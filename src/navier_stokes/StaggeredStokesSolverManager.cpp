@@ -50,6 +50,7 @@
 #include "ibtk/KrylovLinearSolver.h"
 #include "ibtk/LinearOperator.h"
 #include "ibtk/LinearSolver.h"
+#include "tbox/Database.h"
 #include "tbox/PIO.h"
 #include "tbox/ShutdownRegistry.h"
 #include "tbox/Utilities.h"
@@ -111,7 +112,13 @@ allocate_petsc_krylov_solver(const std::string& object_name,
 {
     Pointer<PETScKrylovStaggeredStokesSolver> krylov_solver =
         new PETScKrylovStaggeredStokesSolver(object_name, input_db, default_options_prefix);
-    krylov_solver->setOperator(new StaggeredStokesOperator(object_name + "::StokesOperator"));
+    Pointer<StaggeredStokesOperator> stokes_op =
+        new StaggeredStokesOperator(object_name + "::StokesOperator");
+    if (input_db && input_db->keyExists("use_assembled_operator"))
+    {
+        stokes_op->setUseAssembledOperator(input_db->getBool("use_assembled_operator"));
+    }
+    krylov_solver->setOperator(stokes_op);
     return krylov_solver;
 } // allocate_petsc_krylov_solver
 
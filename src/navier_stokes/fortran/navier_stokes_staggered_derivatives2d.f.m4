@@ -319,3 +319,418 @@ c
       end
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Compute the xsPPM7-based Godunov convective derivative of a
+c     staggered velocity field in a single pass over the patch.
+c
+c     NOTES:
+c
+c     The face-centered predicted values are computed one pencil at a
+c     time, so that the limited slopes and the left/right interpolants
+c     never occupy more than a single pencil of scratch storage, and the
+c     advection velocities are computed on the fly instead of being
+c     interpolated into and copied between separate face-centered
+c     arrays.  The derivative is then evaluated directly from the
+c     predicted values of all of the velocity components.
+c
+c     The results agree bit for bit with those of the separate
+c     godunov_extrapolate2d, navier_stokes_reset_adv_velocity2d, and
+c     advect/convect/skew_sym_derivative2d sequence when the compiler
+c     does not contract floating-point operations.  When fused
+c     multiply-adds are generated (e.g., with -march=native), the two
+c     may differ at the level of round-off.
+c
+c     U_half00 and U_half01 are face-centered staggered grid values
+c     (without ghost cells) for the control volumes centered about the
+c     x components of the velocity, and U_half10 and U_half11 are the
+c     corresponding values for the y components.  These arrays, along
+c     with the pencil scratch arrays, are used as workspace.
+c
+c     difference_form is 0 for the advective form, 1 for the
+c     conservative form, and 2 for the skew-symmetric form of the
+c     convective derivative.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine navier_stokes_staggered_ppm_derivative2d(
+     &     dx,difference_form,
+     &     patch_ifirst0,patch_ilast0,
+     &     patch_ifirst1,patch_ilast1,
+     &     n_U_gc0,n_U_gc1,
+     &     U0,U1,
+     &     U_half00,U_half01,
+     &     U_half10,U_half11,
+     &     Q_pencil,u_pencil,
+     &     dQ_pencil,Q_L_pencil,Q_R_pencil,
+     &     n_N_gc0,n_N_gc1,
+     &     N0,N1)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER difference_form
+
+      INTEGER patch_ifirst0,patch_ilast0
+      INTEGER patch_ifirst1,patch_ilast1
+
+      INTEGER n_U_gc0,n_U_gc1
+      INTEGER n_N_gc0,n_N_gc1
+
+      REAL dx(0:NDIM-1)
+
+      REAL U0(
+     &     SIDE2d0VECG(patch_ifirst,patch_ilast,n_U_gc)
+     &     )
+      REAL U1(
+     &     SIDE2d1VECG(patch_ifirst,patch_ilast,n_U_gc)
+     &     )
+c
+c     Scratch.
+c
+      REAL U_half00(patch_ifirst0:patch_ilast0+2,
+     &              patch_ifirst1:patch_ilast1)
+      REAL U_half01(patch_ifirst1:patch_ilast1+1,
+     &              patch_ifirst0:patch_ilast0+1)
+      REAL U_half10(patch_ifirst0:patch_ilast0+1,
+     &              patch_ifirst1:patch_ilast1+1)
+      REAL U_half11(patch_ifirst1:patch_ilast1+2,
+     &              patch_ifirst0:patch_ilast0)
+
+      REAL Q_pencil(*),u_pencil(*)
+      REAL dQ_pencil(*),Q_L_pencil(*),Q_R_pencil(*)
+c
+c     Output.
+c
+      REAL N0(
+     &     SIDE2d0VECG(patch_ifirst,patch_ilast,n_N_gc)
+     &     )
+      REAL N1(
+     &     SIDE2d1VECG(patch_ifirst,patch_ilast,n_N_gc)
+     &     )
+c
+c     Local variables.
+c
+      INTEGER i0,i1
+      INTEGER f0,l0,f1,l1
+      REAL U,V
+      REAL Qx0,Qx1
+      REAL QUx0,QVx1
+c
+c     Predict the x component of the velocity on the faces of the
+c     control volumes centered about the x component of the velocity.
+c
+      f0 = patch_ifirst0
+      l0 = patch_ilast0+1
+      f1 = patch_ifirst1
+      l1 = patch_ilast1
+
+      do i1 = f1,l1
+         do i0 = f0,l0+1
+            u_pencil(i0-f0+1) = 0.5d0*(U0(i0-1,i1)+U0(i0,i1))
+         enddo
+         call navier_stokes_xsppm7_pencil2d(
+     &        f0,l0,n_U_gc0,
+     &        U0(f0-n_U_gc0,i1),u_pencil,
+     &        dQ_pencil,Q_L_pencil,Q_R_pencil,
+     &        U_half00(f0,i1))
+      enddo
+
+      do i0 = f0,l0
+         do i1 = f1-n_U_gc1,l1+n_U_gc1
+            Q_pencil(i1-f1+n_U_gc1+1) = U0(i0,i1)
+         enddo
+         do i1 = f1,l1+1
+            u_pencil(i1-f1+1) = 0.5d0*(U1(i0-1,i1)+U1(i0,i1))
+         enddo
+         call navier_stokes_xsppm7_pencil2d(
+     &        f1,l1,n_U_gc1,
+     &        Q_pencil,u_pencil,
+     &        dQ_pencil,Q_L_pencil,Q_R_pencil,
+     &        U_half01(f1,i0))
+      enddo
+c
+c     Predict the y component of the velocity on the faces of the
+c     control volumes centered about the y component of the velocity.
+c
+      f0 = patch_ifirst0
+      l0 = patch_ilast0
+      f1 = patch_ifirst1
+      l1 = patch_ilast1+1
+
+      do i1 = f1,l1
+         do i0 = f0,l0+1
+            u_pencil(i0-f0+1) = 0.5d0*(U0(i0,i1-1)+U0(i0,i1))
+         enddo
+         call navier_stokes_xsppm7_pencil2d(
+     &        f0,l0,n_U_gc0,
+     &        U1(f0-n_U_gc0,i1),u_pencil,
+     &        dQ_pencil,Q_L_pencil,Q_R_pencil,
+     &        U_half10(f0,i1))
+      enddo
+
+      do i0 = f0,l0
+         do i1 = f1-n_U_gc1,l1+n_U_gc1
+            Q_pencil(i1-f1+n_U_gc1+1) = U1(i0,i1)
+         enddo
+         do i1 = f1,l1+1
+            u_pencil(i1-f1+1) = 0.5d0*(U1(i0,i1-1)+U1(i0,i1))
+         enddo
+         call navier_stokes_xsppm7_pencil2d(
+     &        f1,l1,n_U_gc1,
+     &        Q_pencil,u_pencil,
+     &        dQ_pencil,Q_L_pencil,Q_R_pencil,
+     &        U_half11(f1,i0))
+      enddo
+c
+c     Compute the convective derivative of the x component of the
+c     velocity.  The advection velocity on the y faces of the x control
+c     volumes is the predicted y velocity on the x faces of the y control
+c     volumes.
+c
+      f0 = patch_ifirst0
+      l0 = patch_ilast0+1
+      f1 = patch_ifirst1
+      l1 = patch_ilast1
+
+      if (difference_form .eq. 0) then
+         do i1 = f1,l1
+            do i0 = f0,l0
+               U = 0.5d0*(U_half00(i0+1,i1)+U_half00(i0,i1))
+               Qx0 = (U_half00(i0+1,i1)-U_half00(i0,i1))/dx(0)
+               V = 0.5d0*(U_half10(i0,i1+1)+U_half10(i0,i1))
+               Qx1 = (U_half01(i1+1,i0)-U_half01(i1,i0))/dx(1)
+               N0(i0,i1) = U*Qx0 + V*Qx1
+            enddo
+         enddo
+      elseif (difference_form .eq. 1) then
+         do i1 = f1,l1
+            do i0 = f0,l0
+               QUx0 = (U_half00(i0+1,i1)*U_half00(i0+1,i1)-
+     &              U_half00(i0,i1)*U_half00(i0,i1))/dx(0)
+               QVx1 = (U_half10(i0,i1+1)*U_half01(i1+1,i0)-
+     &              U_half10(i0,i1)*U_half01(i1,i0))/dx(1)
+               N0(i0,i1) = QUx0 + QVx1
+            enddo
+         enddo
+      else
+         do i1 = f1,l1
+            do i0 = f0,l0
+               U = 0.5d0*(U_half00(i0+1,i1)+U_half00(i0,i1))
+               Qx0 = (U_half00(i0+1,i1)-U_half00(i0,i1))/dx(0)
+               QUx0 = (U_half00(i0+1,i1)*U_half00(i0+1,i1)-
+     &              U_half00(i0,i1)*U_half00(i0,i1))/dx(0)
+               V = 0.5d0*(U_half10(i0,i1+1)+U_half10(i0,i1))
+               Qx1 = (U_half01(i1+1,i0)-U_half01(i1,i0))/dx(1)
+               QVx1 = (U_half10(i0,i1+1)*U_half01(i1+1,i0)-
+     &              U_half10(i0,i1)*U_half01(i1,i0))/dx(1)
+               N0(i0,i1) = 0.5d0*(U*Qx0+QUx0) + 0.5d0*(V*Qx1+QVx1)
+            enddo
+         enddo
+      endif
+c
+c     Compute the convective derivative of the y component of the
+c     velocity.
+c
+      f0 = patch_ifirst0
+      l0 = patch_ilast0
+      f1 = patch_ifirst1
+      l1 = patch_ilast1+1
+
+      if (difference_form .eq. 0) then
+         do i1 = f1,l1
+            do i0 = f0,l0
+               U = 0.5d0*(U_half01(i1,i0+1)+U_half01(i1,i0))
+               Qx0 = (U_half10(i0+1,i1)-U_half10(i0,i1))/dx(0)
+               V = 0.5d0*(U_half11(i1+1,i0)+U_half11(i1,i0))
+               Qx1 = (U_half11(i1+1,i0)-U_half11(i1,i0))/dx(1)
+               N1(i0,i1) = U*Qx0 + V*Qx1
+            enddo
+         enddo
+      elseif (difference_form .eq. 1) then
+         do i1 = f1,l1
+            do i0 = f0,l0
+               QUx0 = (U_half01(i1,i0+1)*U_half10(i0+1,i1)-
+     &              U_half01(i1,i0)*U_half10(i0,i1))/dx(0)
+               QVx1 = (U_half11(i1+1,i0)*U_half11(i1+1,i0)-
+     &              U_half11(i1,i0)*U_half11(i1,i0))/dx(1)
+               N1(i0,i1) = QUx0 + QVx1
+            enddo
+         enddo
+      else
+         do i1 = f1,l1
+            do i0 = f0,l0
+               U = 0.5d0*(U_half01(i1,i0+1)+U_half01(i1,i0))
+               Qx0 = (U_half10(i0+1,i1)-U_half10(i0,i1))/dx(0)
+               QUx0 = (U_half01(i1,i0+1)*U_half10(i0+1,i1)-
+     &              U_half01(i1,i0)*U_half10(i0,i1))/dx(0)
+               V = 0.5d0*(U_half11(i1+1,i0)+U_half11(i1,i0))
+               Qx1 = (U_half11(i1+1,i0)-U_half11(i1,i0))/dx(1)
+               QVx1 = (U_half11(i1+1,i0)*U_half11(i1+1,i0)-
+     &              U_half11(i1,i0)*U_half11(i1,i0))/dx(1)
+               N1(i0,i1) = 0.5d0*(U*Qx0+QUx0) + 0.5d0*(V*Qx1+QVx1)
+            enddo
+         enddo
+      endif
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Extrapolate face centered values along a single pencil of cells
+c     using the xsPPM7 scheme of Rider, Greenough, and Kamm, and upwind
+c     the left and right states using the advection velocity u.
+c
+c     The slope, interpolation, and upwinding loops are written as
+c     separate unit-stride sweeps so that they may be vectorized; only
+c     the monotonicity fix-up is evaluated element-by-element.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine navier_stokes_xsppm7_pencil2d(
+     &     ifirst,ilast,nQgc,
+     &     Q,u,
+     &     dQ,Q_L,Q_R,
+     &     qhalf)
+c
+      implicit none
+c
+c     Functions.
+c
+      REAL median,sign_eps,WENO5_interp
+c
+c     Input.
+c
+      INTEGER ifirst,ilast,nQgc
+
+      REAL Q(ifirst-nQgc:ilast+nQgc)
+      REAL u(ifirst:ilast+1)
+c
+c     Scratch.
+c
+      REAL dQ(ifirst-2:ilast+2)
+      REAL Q_L(ifirst-1:ilast+1)
+      REAL Q_R(ifirst-1:ilast+1)
+c
+c     Output.
+c
+      REAL qhalf(ifirst:ilast+1)
+c
+c     Local variables.
+c
+      INTEGER ic,i
+      REAL QQ,QQ_L,QQ_R
+      REAL QQ_star_L,QQ_star_R
+      REAL QQ_WENO(-2:2)
+      REAL QQ_WENO_L,QQ_WENO_R
+      REAL QQ_4th_L,QQ_4th_R
+      REAL dQQ_C,dQQ_L,dQQ_R,dQQ
+      REAL P0,P1,P2
+c
+c     Compute the limited slopes.
+c
+      do ic = ifirst-2,ilast+2
+         dQQ_C = 0.5d0*(Q(ic+1)-Q(ic-1))
+         dQQ_L =       (Q(ic  )-Q(ic-1))
+         dQQ_R =       (Q(ic+1)-Q(ic  ))
+         if (dQQ_R*dQQ_L .gt. 1.d-12) then
+            dQQ = min(abs(dQQ_C),2.d0*abs(dQQ_L),2.d0*abs(dQQ_R))*
+     c           sign(1.d0,dQQ_C)
+         else
+            dQQ = 0.d0
+         endif
+         dQ(ic) = dQQ
+      enddo
+c
+c     Compute a 7th order interpolation.
+c
+      do ic = ifirst-1,ilast+1
+         Q_L(ic) = (1.d0/420.d0)*(
+     &        -   3.d0*Q(ic+3)
+     &        +  25.d0*Q(ic+2)
+     &        - 101.d0*Q(ic+1)
+     &        + 319.d0*Q(ic  )
+     &        + 214.d0*Q(ic-1)
+     &        -  38.d0*Q(ic-2)
+     &        +   4.d0*Q(ic-3))
+         Q_R(ic) = (1.d0/420.d0)*(
+     &        -   3.d0*Q(ic-3)
+     &        +  25.d0*Q(ic-2)
+     &        - 101.d0*Q(ic-1)
+     &        + 319.d0*Q(ic  )
+     &        + 214.d0*Q(ic+1)
+     &        -  38.d0*Q(ic+2)
+     &        +   4.d0*Q(ic+3))
+      enddo
+c
+c     Check for extrema or violations of monotonicity.
+c
+      do ic = ifirst-1,ilast+1
+         QQ   = Q  (ic)
+         QQ_L = Q_L(ic)
+         QQ_R = Q_R(ic)
+         call monotonize(
+     &        Q(ic-1),
+     &        QQ_L,QQ_R,QQ_star_L,QQ_star_R)
+         if ( ((QQ_star_L-QQ_L)**2.d0 .ge. 1.d-12) .or.
+     &        ((QQ_star_R-QQ_R)**2.d0 .ge. 1.d-12) ) then
+            do i = -2,2
+               QQ_WENO(i) = Q(ic-i)
+            enddo
+            QQ_WENO_L = WENO5_interp(QQ_WENO)
+            do i = -2,2
+               QQ_WENO(i) = Q(ic+i)
+            enddo
+            QQ_WENO_R = WENO5_interp(QQ_WENO)
+            if ( ((QQ_star_L-QQ)**2.d0 .le. 1.d-12) .or.
+     &           ((QQ_star_R-QQ)**2.d0 .le. 1.d-12) ) then
+               QQ_WENO_L = median(QQ,QQ_WENO_L,QQ_L)
+               QQ_WENO_R = median(QQ,QQ_WENO_R,QQ_R)
+               call monotonize(
+     &              Q(ic-1),
+     &              QQ_WENO_L,QQ_WENO_R,QQ_star_L,QQ_star_R)
+            else
+               QQ_4th_L = 0.5d0*(Q(ic-1)+Q(ic  )) -
+     &              (1.d0/6.d0)*(dQ(ic  )-dQ(ic-1))
+               QQ_4th_R = 0.5d0*(Q(ic  )+Q(ic+1)) -
+     &              (1.d0/6.d0)*(dQ(ic+1)-dQ(ic  ))
+               QQ_4th_L = median(QQ_4th_L,QQ_WENO_L,QQ_L)
+               QQ_4th_R = median(QQ_4th_R,QQ_WENO_R,QQ_R)
+               call monotonize(
+     &              Q(ic-1),
+     &              QQ_4th_L,QQ_4th_R,QQ_star_L,QQ_star_R)
+            endif
+            Q_L(ic) = median(QQ_WENO_L,QQ_star_L,QQ_L)
+            Q_R(ic) = median(QQ_WENO_R,QQ_star_R,QQ_R)
+         endif
+      enddo
+c
+c     Compute the upwinded face values.
+c
+      do ic = ifirst-1,ilast
+         QQ        = Q  (ic  )
+         QQ_star_L = Q_L(ic  )
+         QQ_star_R = Q_R(ic  )
+         P0 = 1.5d0*QQ-0.25d0*(QQ_star_L+QQ_star_R)
+         P1 = QQ_star_R-QQ_star_L
+         P2 = 3.d0*(QQ_star_L+QQ_star_R)-6.d0*QQ
+         QQ_L = P0 + 0.5d0*P1 + 0.25d0*P2
+
+         QQ        = Q  (ic+1)
+         QQ_star_L = Q_L(ic+1)
+         QQ_star_R = Q_R(ic+1)
+         P0 = 1.5d0*QQ-0.25d0*(QQ_star_L+QQ_star_R)
+         P1 = QQ_star_R-QQ_star_L
+         P2 = 3.d0*(QQ_star_L+QQ_star_R)-6.d0*QQ
+         QQ_R = P0 - 0.5d0*P1 + 0.25d0*P2
+
+         qhalf(ic+1) =
+     &        0.5d0*(QQ_L+QQ_R)+
+     &        sign_eps(u(ic+1))*0.5d0*(QQ_L-QQ_R)
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
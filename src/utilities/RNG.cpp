@@ -1,6 +1,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <math.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <time.h>
 #include <iosfwd>
@@ -10,10 +11,13 @@
 #include <set>
 #include <vector>
 
+#include "ArrayData.h"
+#include "Box.h"
 #include "ibamr/RNG.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "mpi.h"
 #include "tbox/PIO.h"
+#include "tbox/Utilities.h"
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -219,6 +223,76 @@ double InvNormDist(double p)
 }
 }
 
+/*
+** Counter-based generator state: the global seed shared by all MPI processes
+** and the next unallocated stream identifier.
+*/
+namespace
+{
+static uint32_t s_global_seed = 4357;
+static unsigned int s_next_stream = 0;
+
+/*
+** Philox-4x32-10 block cipher (Salmon et al., "Parallel random numbers: as
+** easy as 1, 2, 3", SC11).  Maps a 128-bit counter and a 64-bit key to 128
+** pseudorandom bits.
+*/
+inline void philox4x32(uint32_t ctr[4], uint32_t key[2])
+{
+    static const uint32_t M0 = 0xD2511F53, M1 = 0xCD9E8D57;
+    static const uint32_t W0 = 0x9E3779B9, W1 = 0xBB67AE85;
+    for (int round = 0; round < 10; ++round)
+    {
+        if (round > 0)
+        {
+            key[0] += W0;
+            key[1] += W1;
+        }
+        const uint64_t p0 = static_cast<uint64_t>(M0) * ctr[0];
+        const uint64_t p1 = static_cast<uint64_t>(M1) * ctr[2];
+        const uint32_t hi0 = static_cast<uint32_t>(p0 >> 32), lo0 = static_cast<uint32_t>(p0);
+        const uint32_t hi1 = static_cast<uint32_t>(p1 >> 32), lo1 = static_cast<uint32_t>(p1);
+        ctr[0] = hi1 ^ ctr[1] ^ key[0];
+        ctr[1] = lo1;
+        ctr[2] = hi0 ^ ctr[3] ^ key[1];
+        ctr[3] = lo0;
+    }
+    return;
+} // philox4x32
+
+/*
+** Convert two 32-bit integers to a double in the open interval (0,1) with
+** 53 bits of precision.
+*/
+inline double to_open_unit_interval(const uint32_t a, const uint32_t b)
+{
+    static const double two_pow_minus_53 = 1.0 / 9007199254740992.0;
+    const double x = static_cast<double>(a >> 5) * 67108864.0 + static_cast<double>(b >> 6);
+    return (x + 0.5) * two_pow_minus_53;
+} // to_open_unit_interval
+
+/*
+** Generate a pair of independent standard normal variates for the given
+** counter and key using the Box-Muller transform.
+*/
+inline void gen_normal_pair(double* const z0,
+                            double* const z1,
+                            const uint32_t ctr_in[4],
+                            const uint32_t key_in[2])
+{
+    static const double two_pi = 6.283185307179586476925286766559;
+    uint32_t ctr[4] = { ctr_in[0], ctr_in[1], ctr_in[2], ctr_in[3] };
+    uint32_t key[2] = { key_in[0], key_in[1] };
+    philox4x32(ctr, key);
+    const double u0 = to_open_unit_interval(ctr[0], ctr[1]);
+    const double u1 = to_open_unit_interval(ctr[2], ctr[3]);
+    const double r = sqrt(-2.0 * log(u0));
+    *z0 = r * cos(two_pi * u1);
+    *z1 = r * sin(two_pi * u1);
+    return;
+} // gen_normal_pair
+}
+
 void RNG::genrandn(double* result)
 {
     double val;
@@ -257,6 +331,11 @@ void RNG::parallel_seed(int global_seed)
         std::cout << "\nGlobal seed = " << seed << "\n\n";
     }
 
+    // The counter-based generator uses the same seed on all MPI processes.
+    int shared_seed = seed;
+    if (size > 1) MPI_Bcast(&shared_seed, 1, MPI_INT, mpi_root, MPI_COMM_WORLD);
+    s_global_seed = static_cast<uint32_t>(shared_seed);
+
     if (size > 1)
     {
         // This is based on Mike Lijewski's code in LLNS/main.cpp
@@ -306,6 +385,81 @@ void RNG::parallel_seed(int global_seed)
     return;
 } // parallel_seed
 
+unsigned int RNG::allocateStreams(const unsigned int num_streams)
+{
+    const unsigned int stream = s_next_stream;
+    s_next_stream += num_streams;
+    return stream;
+} // allocateStreams
+
+void RNG::genrandn(ArrayData<NDIM, double>& data,
+                   const Box<NDIM>& box,
+                   const unsigned int stream,
+                   const unsigned int step,
+                   const int level_num)
+{
+    const int depth = data.getDepth();
+#if !defined(NDEBUG)
+    TBOX_ASSERT(data.getBox().contains(box));
+    TBOX_ASSERT(stream < (1U << 16));
+    TBOX_ASSERT(level_num >= 0 && level_num < (1 << 8));
+    TBOX_ASSERT(depth <= (1 << 8));
+#endif
+    if (box.empty()) return;
+
+    // The key identifies the realization (seed and time step) and the counter
+    // identifies the random variate within that realization.  Each generator
+    // call produces two variates, which are used for consecutive data depths.
+    const uint32_t key[2] = { s_global_seed, static_cast<uint32_t>(step) };
+    const Box<NDIM>& data_box = data.getBox();
+    int stride[NDIM];
+    stride[0] = 1;
+    for (unsigned int d = 1; d < NDIM; ++d)
+    {
+        stride[d] = stride[d - 1] * (data_box.upper(d - 1) - data_box.lower(d - 1) + 1);
+    }
+    const int ilower = box.lower(0), iupper = box.upper(0);
+    const int n_pairs = (depth + 1) / 2;
+    for (int pair = 0; pair < n_pairs; ++pair)
+    {
+        const int d0 = 2 * pair, d1 = 2 * pair + 1;
+        double* const data0 = data.getPointer(d0);
+        double* const data1 = d1 < depth ? data.getPointer(d1) : NULL;
+        uint32_t ctr[4];
+        ctr[3] = (static_cast<uint32_t>(stream) << 16) |
+                 (static_cast<uint32_t>(level_num) << 8) | static_cast<uint32_t>(pair);
+#if (NDIM == 2)
+        ctr[2] = 0;
+#endif
+#if (NDIM == 3)
+        for (int k = box.lower(2); k <= box.upper(2); ++k)
+        {
+            ctr[2] = static_cast<uint32_t>(k);
+#endif
+            for (int j = box.lower(1); j <= box.upper(1); ++j)
+            {
+                ctr[1] = static_cast<uint32_t>(j);
+                int offset = (ilower - data_box.lower(0));
+                offset += (j - data_box.lower(1)) * stride[1];
+#if (NDIM == 3)
+                offset += (k - data_box.lower(2)) * stride[2];
+#endif
+                for (int i = ilower; i <= iupper; ++i, ++offset)
+                {
+                    ctr[0] = static_cast<uint32_t>(i);
+                    double z0, z1;
+                    gen_normal_pair(&z0, &z1, ctr, key);
+                    data0[offset] = z0;
+                    if (data1) data1[offset] = z1;
+                }
+            }
+#if (NDIM == 3)
+        }
+#endif
+    }
+    return;
+} // genrandn
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
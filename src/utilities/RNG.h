@@ -1,6 +1,24 @@
 #ifndef included_RNG
 #define included_RNG
 
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+namespace SAMRAI
+{
+namespace hier
+{
+template <int DIM>
+class Box;
+} // namespace hier
+namespace pdat
+{
+template <int DIM, class TYPE>
+class ArrayData;
+} // namespace pdat
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
 namespace IBAMR
 {
 /*!
@@ -18,6 +36,35 @@ public:
 
     static void parallel_seed(int global_seed);
 
+    /*!
+     * \brief Reserve \a num_streams consecutive stream identifiers for use
+     * with the counter-based generator and return the first one.
+     *
+     * Objects that are constructed in the same order on all MPI processes
+     * obtain the same stream identifiers on all processes.
+     */
+    static unsigned int allocateStreams(unsigned int num_streams);
+
+    /*!
+     * \brief Fill \a data on \a box with standard normal random variates
+     * generated by a counter-based (Philox-4x32-10) generator.
+     *
+     * Each value is a function only of the global seed set by
+     * parallel_seed(), the time step number \a step, the stream identifier
+     * \a stream, the patch level number \a level_num, the cell index, and the
+     * data depth.  Consequently, the generated values are independent of the
+     * parallel decomposition and of the order in which patches are visited,
+     * and the routine may safely be called concurrently.
+     *
+     * \note Stream identifiers must be smaller than 2^16 and level numbers
+     * and data depths must be smaller than 2^8.
+     */
+    static void genrandn(SAMRAI::pdat::ArrayData<NDIM, double>& data,
+                         const SAMRAI::hier::Box<NDIM>& box,
+                         unsigned int stream,
+                         unsigned int step,
+                         int level_num);
+
 private:
     RNG();
     RNG(RNG&);